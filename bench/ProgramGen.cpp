@@ -0,0 +1,280 @@
+#include "ProgramGen.hpp"
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace miniml::bench {
+
+namespace {
+
+struct GType {
+  enum Kind { Int, Bool, Tuple } k = Int;
+  std::vector<GType> elems;
+
+  bool operator==(const GType& o) const { return k == o.k && elems == o.elems; }
+};
+
+// Type-directed generator. Only monomorphic Int / Bool / tuple bindings
+// enter 'scope_'; polymorphic helpers are used through fixed templates.
+// Int expressions only ever add or subtract literals, so values stay small
+// and no program can overflow or divide by zero. Every random draw is its
+// own statement: the order of operands of '+' is unspecified.
+class Gen {
+ public:
+  explicit Gen(std::uint64_t seed) : rng_(seed) {}
+
+  std::string program(const GenOptions& o) {
+    switch (o.shape) {
+      case ProgramShape::DeepLets: deepLets(o.size); break;
+      case ProgramShape::WideTuples: wideTuples(o.size); break;
+      case ProgramShape::Polymorphic: polymorphic(o.size); break;
+      case ProgramShape::Curried: curried(o.size); break;
+      case ProgramShape::Mixed: {
+        int part = o.size / 4 > 0 ? o.size / 4 : 1;
+        polymorphic(part);
+        deepLets(part);
+        wideTuples(part);
+        curried(part);
+        break;
+      }
+    }
+    return out_ + expr(intType(), 3) + "\n";
+  }
+
+ private:
+  std::mt19937_64 rng_;   // mt19937_64 output is fixed by the standard; distributions are not
+  std::string out_;
+  std::vector<std::pair<std::string, GType>> scope_;
+  int fresh_ = 0;
+  bool helpers_ = false;
+
+  int below(int n) { return static_cast<int>(rng_() % static_cast<std::uint64_t>(n)); }
+  bool chance(int percent) { return below(100) < percent; }
+  std::string name(const char* prefix) { return prefix + std::to_string(fresh_++); }
+
+  static GType intType() { return GType{}; }
+  static GType boolType() { return GType{GType::Bool, {}}; }
+
+  GType randomType(int depth) {
+    int r = below(100);
+    if (r < 45 || depth <= 0) return r % 2 ? intType() : boolType();
+    if (r < 80) return intType();
+    GType t{GType::Tuple, {}};
+    int width = 2 + below(2);
+    for (int i = 0; i < width; ++i) t.elems.push_back(randomType(depth - 1));
+    return t;
+  }
+
+  void bind(const std::string& x, const std::string& rhs, const GType& t) {
+    out_ += "let " + x + " = " + rhs + " in\n";
+    scope_.emplace_back(x, t);
+  }
+
+  // a random visible variable of type t, or "" if there is none
+  std::string variable(const GType& t) {
+    std::vector<const std::string*> found;
+    for (auto& [x, xt] : scope_)
+      if (xt == t) found.push_back(&x);
+    if (found.empty()) return "";
+    return *found[below(static_cast<int>(found.size()))];
+  }
+
+  std::string literal(const GType& t) {
+    switch (t.k) {
+      case GType::Int: return std::to_string(below(100));
+      case GType::Bool: return chance(50) ? "true" : "false";
+      case GType::Tuple: {
+        std::string s = "(";
+        for (size_t i = 0; i < t.elems.size(); ++i) s += (i ? ", " : "") + literal(t.elems[i]);
+        return s + ")";
+      }
+    }
+    return "0";
+  }
+
+  std::string expr(const GType& t, int depth) {
+    if (depth <= 0 || chance(25)) {
+      auto v = chance(70) ? variable(t) : "";
+      return v.empty() ? literal(t) : v;
+    }
+    int r = below(100);
+    if (r < 10) {
+      auto c = expr(boolType(), depth - 1);
+      auto a = expr(t, depth - 1);
+      auto b = expr(t, depth - 1);
+      return "(if " + c + " then " + a + " else " + b + ")";
+    }
+    if (r < 18) {
+      auto x = name("l");
+      auto xt = randomType(1);
+      auto rhs = expr(xt, depth - 1);
+      scope_.emplace_back(x, xt);
+      auto body = expr(t, depth - 1);
+      scope_.pop_back();
+      return "(let " + x + " = " + rhs + " in " + body + ")";
+    }
+    switch (t.k) {
+      case GType::Int: {
+        auto a = expr(t, depth - 1);
+        const char* op = chance(50) ? " + " : " - ";
+        return "(" + a + op + std::to_string(below(10)) + ")";
+      }
+      case GType::Bool: {
+        static const char* const rel[] = {" < ", " <= ", " > ", " >= "};
+        const char* op;
+        std::string a, b;
+        if (r < 45) {
+          a = expr(intType(), depth - 1);
+          op = rel[below(4)];
+          b = expr(intType(), depth - 1);
+        } else if (r < 65) {
+          auto ot = randomType(1);
+          a = expr(ot, depth - 1);
+          op = chance(50) ? " = " : " <> ";
+          b = expr(ot, depth - 1);
+        } else if (r < 85) {
+          a = expr(t, depth - 1);
+          op = chance(50) ? " && " : " || ";
+          b = expr(t, depth - 1);
+        } else {
+          return "(not " + expr(t, depth - 1) + ")";
+        }
+        return "(" + a + op + b + ")";
+      }
+      case GType::Tuple: {
+        std::string s = "(";
+        for (size_t i = 0; i < t.elems.size(); ++i) s += (i ? ", " : "") + expr(t.elems[i], depth - 1);
+        return s + ")";
+      }
+    }
+    return literal(t);
+  }
+
+  void deepLets(int n) {
+    for (int i = 0; i < n; ++i) {
+      auto t = randomType(1);
+      auto x = name("v");
+      bind(x, expr(t, 2), t);
+    }
+  }
+
+  void wideTuples(int n) {
+    int width = n > 2 ? n : 2;
+    GType t{GType::Tuple, {}};
+    for (int i = 0; i < width; ++i) t.elems.push_back(randomType(1));
+    std::vector<std::string> ws;
+    for (int k = 0; k < 3; ++k) {
+      ws.push_back(name("w"));
+      bind(ws.back(), expr(t, 1), t);
+    }
+    GType nested{GType::Tuple, {t, t}};
+    bind(name("w"), "(" + ws[0] + ", " + ws[1] + ")", nested);
+    bind(name("b"), "((" + ws[0] + " = " + ws[1] + ") || (" + ws[1] + " <> " + ws[2] + "))", boolType());
+  }
+
+  void defineHelpers() {
+    if (helpers_) return;
+    helpers_ = true;
+    out_ += "let id = \\x -> x in\n"
+            "let const = \\x -> \\y -> x in\n"
+            "let pair = \\x -> \\y -> (x, y) in\n"
+            "let twice = \\f -> \\x -> f (f x) in\n"
+            "let compose = \\f -> \\g -> \\x -> f (g x) in\n"
+            "let flip = \\f -> \\x -> \\y -> f y x in\n";
+  }
+
+  void polymorphic(int n) {
+    defineHelpers();
+    std::vector<std::string> ids;   // local polymorphic identities
+    for (int i = 0; i < n; ++i) {
+      if (i % 10 == 0) {
+        auto h = name("h");
+        out_ += "let " + h + " = " +
+                (ids.empty() ? std::string("compose id id") : "compose " + ids[below(static_cast<int>(ids.size()))] + " id") +
+                " in\n";
+        ids.push_back(h);
+      }
+      auto a = randomType(1), b = randomType(1);
+      auto ea = "(" + expr(a, 1) + ")", eb = "(" + expr(b, 1) + ")";
+      auto z = name("z");
+      auto p = name("p");
+      switch (below(9)) {
+        case 0: bind(p, "id " + ea, a); break;
+        case 1: bind(p, "const " + ea + " " + eb, a); break;
+        case 2: bind(p, "pair " + ea + " " + eb, GType{GType::Tuple, {a, b}}); break;
+        case 3: bind(p, "flip pair " + ea + " " + eb, GType{GType::Tuple, {b, a}}); break;
+        case 4: bind(p, "flip const " + ea + " " + eb, b); break;
+        case 5: bind(p, "twice id " + ea, a); break;
+        case 6: bind(p, "twice (\\" + z + " -> " + z + " + 1) (" + expr(intType(), 1) + ")", intType()); break;
+        case 7:
+          bind(p, "compose (\\" + z + " -> not " + z + ") (\\" + z + " -> " + z + ") (" + expr(boolType(), 1) + ")",
+               boolType());
+          break;
+        default: bind(p, ids[below(static_cast<int>(ids.size()))] + " " + ea, a); break;
+      }
+    }
+  }
+
+  void curried(int n) {
+    int arity = n > 1 ? n : 1;
+    auto f = name("f");
+    std::vector<GType> params;
+    std::string lam, body;
+    for (int i = 0; i < arity; ++i) {
+      params.push_back(i % 3 == 2 ? boolType() : intType());
+      auto a = f + "_a" + std::to_string(i);
+      lam += "\\" + a + " -> ";
+      body += (i ? " + " : "") + (params.back().k == GType::Bool ? "(if " + a + " then 1 else 0)" : a);
+    }
+    out_ += "let " + f + " = " + lam + "(" + body + ") in\n";
+
+    // full calls, and partial applications completed later
+    int calls = arity / 4 + 1;
+    for (int c = 0; c < calls; ++c) {
+      int cut = below(arity + 1);
+      std::string partial = f;
+      for (int i = 0; i < cut; ++i) partial += " (" + expr(params[i], 1) + ")";
+      std::string call;
+      if (cut > 0 && cut < arity) {
+        auto g = name("g");
+        out_ += "let " + g + " = " + partial + " in\n";
+        call = g;
+      } else {
+        call = partial;
+      }
+      for (int i = cut; i < arity; ++i) call += " (" + expr(params[i], 1) + ")";
+      // not added to the scope: results sum their arguments, reusing them would grow exponentially
+      out_ += "let " + name("c") + " = " + call + " in\n";
+    }
+  }
+};
+
+} // namespace
+
+std::string generateProgram(const GenOptions& opts) {
+  return Gen(opts.seed).program(opts);
+}
+
+const char* shapeName(ProgramShape shape) {
+  switch (shape) {
+    case ProgramShape::DeepLets: return "deep-lets";
+    case ProgramShape::WideTuples: return "wide-tuples";
+    case ProgramShape::Polymorphic: return "polymorphic";
+    case ProgramShape::Curried: return "curried";
+    case ProgramShape::Mixed: return "mixed";
+  }
+  return "?";
+}
+
+bool parseShape(const std::string& name, ProgramShape& out) {
+  for (auto s : {ProgramShape::DeepLets, ProgramShape::WideTuples, ProgramShape::Polymorphic,
+                 ProgramShape::Curried, ProgramShape::Mixed}) {
+    if (name == shapeName(s)) {
+      out = s;
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace miniml::bench
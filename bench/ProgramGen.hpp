@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Deterministic generator for large, well-typed MiniML programs. The same
+// shape, size and seed always give the same text, on every platform.
+namespace miniml::bench {
+
+    enum class ProgramShape {
+        DeepLets,     // a chain of 'size' lets, each using earlier bindings
+        WideTuples,   // tuples of width 'size', built, nested and compared
+        Polymorphic,  // id/const/pair/twice/compose instantiated at many types, 'size' uses
+        Curried,      // a 'size'-argument curried function, called fully and partially
+        Mixed,        // all of the above, 'size' split between them
+    };
+
+    struct GenOptions {
+        ProgramShape shape = ProgramShape::Mixed;
+        int size = 100;
+        std::uint64_t seed = 1;
+    };
+
+    std::string generateProgram(const GenOptions& opts);
+
+    // "deep-lets", "wide-tuples", "polymorphic", "curried", "mixed"
+    const char* shapeName(ProgramShape shape);
+    bool parseShape(const std::string& name, ProgramShape& out);
+
+} // namespace miniml::bench
@@ -0,0 +1,68 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "types/Type.hpp"
+
+// Inputs for the microbenchmarks, parameterized on size and shape.
+namespace miniml::bench {
+
+    enum class Shape {
+        NestedLets,   // let x0 = 1 in let x1 = x0 + 1 in ... x(n-1): scope / env depth
+        AppChain,     // let f = \x -> x + 1 in f (f (... (f 0))): n applications
+        WideTuple,    // let t = (0, 1, ..., n-1) in t = t: tuple width
+    };
+
+    inline std::string source(Shape shape, int n) {
+        std::string s;
+        switch (shape) {
+            case Shape::NestedLets:
+                s = "let x0 = 1 in\n";
+                for (int i = 1; i < n; ++i)
+                    s += "let x" + std::to_string(i) + " = x" + std::to_string(i - 1) + " + 1 in\n";
+                return s + "x" + std::to_string(n - 1) + "\n";
+            case Shape::AppChain:
+                s = "let f = \\x -> x + 1 in\n";
+                for (int i = 0; i < n; ++i) s += "f (";
+                s += "0";
+                return s + std::string(n, ')') + "\n";
+            case Shape::WideTuple:
+                s = "let t = (0";
+                for (int i = 1; i < n; ++i) s += ", " + std::to_string(i);
+                return s + ") in t = t\n";
+        }
+        return s;
+    }
+
+    // a0 -> a1 -> ... -> a(n-1) -> Int over fresh variables starting at 'firstVar'
+    inline TypePtr arrowChain(int n, int firstVar) {
+        TypePtr t = Type::tInt();
+        for (int i = n - 1; i >= 0; --i) t = Type::tFun(Type::tVar(firstVar + i), t);
+        return t;
+    }
+
+    // Int -> Int -> ... -> Int with n arguments
+    inline TypePtr intArrowChain(int n) {
+        TypePtr t = Type::tInt();
+        for (int i = 0; i < n; ++i) t = Type::tFun(Type::tInt(), t);
+        return t;
+    }
+
+    // (a0, ..., a(n-1)) over fresh variables starting at 'firstVar'
+    inline TypePtr varTuple(int n, int firstVar) {
+        std::vector<TypePtr> es;
+        for (int i = 0; i < n; ++i) es.push_back(Type::tVar(firstVar + i));
+        return Type::tTuple(std::move(es));
+    }
+
+    // (Int, ..., Int) with n elements
+    inline TypePtr intTuple(int n) {
+        return Type::tTuple(std::vector<TypePtr>(n, Type::tInt()));
+    }
+
+} // namespace miniml::bench
+
+// Register 'bm' (taking a Shape) for every shape at sizes 8 .. 512.
+#define MINIML_BENCH_SHAPES(bm)                                                                      \
+    BENCHMARK_CAPTURE(bm, lets, miniml::bench::Shape::NestedLets)->RangeMultiplier(4)->Range(8, 512); \
+    BENCHMARK_CAPTURE(bm, apps, miniml::bench::Shape::AppChain)->RangeMultiplier(4)->Range(8, 512);   \
+    BENCHMARK_CAPTURE(bm, tuple, miniml::bench::Shape::WideTuple)->RangeMultiplier(4)->Range(8, 512)
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "Programs.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "semantic/Escape.hpp"
+#include "semantic/LastUse.hpp"
+#include "evaluator/Eval.hpp"
+#include "driver/Engine.hpp"
+
+using namespace miniml;
+using bench::Shape;
+
+// As minimlc runs it: escape and last-use analysis first, then the tree-walking evaluator.
+static void BM_Eval(benchmark::State& state, Shape shape) {
+    auto ast = parse_to_ast(bench::source(shape, static_cast<int>(state.range(0))), "<bench>");
+    analyzeEscapes(ast);
+    analyzeLastUses(ast);
+    auto env = prelude();
+    for (auto _ : state) benchmark::DoNotOptimize(eval(ast, env));
+}
+MINIML_BENCH_SHAPES(BM_Eval);
+
+// Throughput of one Engine script on many inputs, by worker threads; ideally
+// items/s grows with the thread count.
+static void BM_EngineRunAll(benchmark::State& state) {
+    Engine engine("let twice = \\f -> \\x -> f (f x) in \\n -> twice twice twice (\\k -> k + n) n");
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 256; ++i) inputs.push_back(std::to_string(i));
+    for (auto _ : state) benchmark::DoNotOptimize(engine.runAll(inputs, static_cast<unsigned>(state.range(0))));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+}
+BENCHMARK(BM_EngineRunAll)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+#include "Programs.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "semantic/ScopeCheck.hpp"
+
+using namespace miniml;
+using bench::Shape;
+
+static void BM_Lex(benchmark::State& state, Shape shape) {
+    auto code = bench::source(shape, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        antlr4::ANTLRInputStream input(code);
+        MiniMLLexer lexer(&input);
+        antlr4::CommonTokenStream tokens(&lexer);
+        tokens.fill();
+        benchmark::DoNotOptimize(tokens.size());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * code.size()));
+}
+
+static void BM_ParseToAst(benchmark::State& state, Shape shape) {
+    auto code = bench::source(shape, static_cast<int>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(parse_to_ast(code, "<bench>"));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * code.size()));
+}
+
+static void BM_ScopeCheck(benchmark::State& state, Shape shape) {
+    auto ast = parse_to_ast(bench::source(shape, static_cast<int>(state.range(0))), "<bench>");
+    for (auto _ : state) {
+        ScopeChecker checker;
+        checker.check(ast);
+    }
+}
+
+MINIML_BENCH_SHAPES(BM_Lex);
+MINIML_BENCH_SHAPES(BM_ParseToAst);
+MINIML_BENCH_SHAPES(BM_ScopeCheck);
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include "Programs.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "types/Constraints.hpp"
+#include "types/Infer.hpp"
+#include "types/Unify.hpp"
+
+using namespace miniml;
+using bench::Shape;
+
+static const SrcLoc kBench{"<bench>", 1, 1};
+
+// a0 -> ... -> Int  ~  Int -> ... -> Int
+static void BM_UnifyArrows(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    auto poly = bench::arrowChain(n, 1 << 20);
+    auto mono = bench::intArrowChain(n);
+    for (auto _ : state) benchmark::DoNotOptimize(unify(poly, mono, kBench));
+}
+BENCHMARK(BM_UnifyArrows)->RangeMultiplier(4)->Range(8, 512);
+
+// (a0, ..., a(n-1))  ~  (Int, ..., Int)
+static void BM_UnifyTuples(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    auto poly = bench::varTuple(n, 1 << 20);
+    auto mono = bench::intTuple(n);
+    for (auto _ : state) benchmark::DoNotOptimize(unify(poly, mono, kBench));
+}
+BENCHMARK(BM_UnifyTuples)->RangeMultiplier(4)->Range(8, 512);
+
+// [ai := Int] applied to a0 -> ... -> Int
+static void BM_SubstApply(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    int base = 1 << 20;
+    Subst s;
+    for (int i = 0; i < n; ++i) s.m[base + i] = Type::tInt();
+    auto t = bench::arrowChain(n, base);
+    for (auto _ : state) benchmark::DoNotOptimize(s.apply(t));
+}
+BENCHMARK(BM_SubstApply)->RangeMultiplier(4)->Range(8, 512);
+
+// [bi := Int] ∘ [ai := bi -> bi], both of size n
+static void BM_SubstCompose(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    int a = 1 << 20, b = a + n;
+    Subst inner, outer;
+    for (int i = 0; i < n; ++i) {
+        inner.m[a + i] = Type::tFun(Type::tVar(b + i), Type::tVar(b + i));
+        outer.m[b + i] = Type::tInt();
+    }
+    for (auto _ : state) {
+        Subst s = outer;
+        s.compose(inner);
+        benchmark::DoNotOptimize(s.m.size());
+    }
+}
+BENCHMARK(BM_SubstCompose)->RangeMultiplier(4)->Range(8, 512);
+
+// generalize a0 -> ... -> Int under an environment of n monomorphic bindings
+static void BM_Generalize(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    int base = 1 << 20;
+    TypeEnv gamma;
+    for (int i = 0; i < n; ++i) gamma["x" + std::to_string(i)] = TypeScheme{{}, Type::tVar(base + 2 * i)};
+    auto t = bench::arrowChain(2 * n, base);   // every other variable is free in gamma
+    for (auto _ : state) benchmark::DoNotOptimize(generalize(gamma, t));
+}
+BENCHMARK(BM_Generalize)->RangeMultiplier(4)->Range(8, 512);
+
+static void BM_Infer(benchmark::State& state, Shape shape) {
+    auto ast = parse_to_ast(bench::source(shape, static_cast<int>(state.range(0))), "<bench>");
+    TypeEnv gamma;
+    for (auto _ : state) benchmark::DoNotOptimize(infer(ast, gamma));
+}
+MINIML_BENCH_SHAPES(BM_Infer);
+
+static void BM_InferConstraints(benchmark::State& state, Shape shape) {
+    auto ast = parse_to_ast(bench::source(shape, static_cast<int>(state.range(0))), "<bench>");
+    TypeEnv gamma;
+    for (auto _ : state) benchmark::DoNotOptimize(inferConstraints(ast, gamma));
+}
+MINIML_BENCH_SHAPES(BM_InferConstraints);
@@ -0,0 +1,153 @@
+// miniml_bench_corpus: time minimlc end to end on a corpus of programs and
+// compare with a stored baseline.
+//
+//   miniml_bench_corpus --minimlc <path> --baseline <file.json>
+//                       [--repeat <n>] [--threshold <fraction>] [--min-delta-ms <ms>]
+//                       [--update] [--out <results.json>] <program.ml>...
+//
+// Every program is run --repeat times (default 5); the median wall time is
+// compared with the baseline. A program regresses when its median exceeds
+// the baseline by more than --threshold (default 0.25) AND by more than
+// --min-delta-ms (default 5), so that noise on tiny programs does not fail
+// the run. Programs without a baseline entry are reported, not failed.
+// --update stores this run's medians in the baseline. Exit status: 0 ok,
+// 1 regression or failed run, 2 usage error.
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static std::string quote(const std::string& s) {
+    std::string q = "'";
+    for (char c : s) {
+        if (c == '\'') q += "'\\''";
+        else q += c;
+    }
+    return q + "'";
+}
+
+static std::string baseName(const std::string& path) {
+    auto slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+// program name -> median ms, from a file written by writeResults
+static std::map<std::string, double> readBaseline(const std::string& path) {
+    std::map<std::string, double> out;
+    std::ifstream in(path);
+    if (!in) return out;
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    std::string text = ss.str();
+    static const std::regex entry(R"re("([^"]+)"\s*:\s*\{\s*"median_ms"\s*:\s*([0-9.eE+-]+))re");
+    for (std::sregex_iterator it(text.begin(), text.end(), entry), end; it != end; ++it)
+        out[(*it)[1]] = std::stod((*it)[2]);
+    return out;
+}
+
+static void writeResults(const std::string& path, const std::map<std::string, double>& medians) {
+    std::ofstream out(path);
+    if (!out) throw std::runtime_error("Cannot write file: " + path);
+    out << "{\n  \"programs\": {";
+    bool first = true;
+    for (auto& [name, ms] : medians) {
+        out << (first ? "\n" : ",\n") << "    \"" << name << "\": {\"median_ms\": " << ms << "}";
+        first = false;
+    }
+    out << "\n  }\n}\n";
+}
+
+// wall time of one minimlc run in ms; throws if it does not succeed
+static double timeRun(const std::string& minimlc, const std::string& program) {
+    std::string cmd = quote(minimlc) + " " + quote(program) + " > /dev/null 2>&1";
+    auto start = std::chrono::steady_clock::now();
+    int rc = std::system(cmd.c_str());
+    auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (rc != 0) throw std::runtime_error("minimlc failed on " + program + " (status " + std::to_string(rc) + ")");
+    return ms;
+}
+
+int main(int argc, char** argv) {
+    std::string minimlc, baselinePath, outPath;
+    int repeat = 5;
+    double threshold = 0.25, minDeltaMs = 5;
+    bool update = false;
+    std::vector<std::string> programs;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("missing argument for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--minimlc") minimlc = value();
+            else if (arg == "--baseline") baselinePath = value();
+            else if (arg == "--repeat") repeat = std::max(1, std::stoi(value()));
+            else if (arg == "--threshold") threshold = std::stod(value());
+            else if (arg == "--min-delta-ms") minDeltaMs = std::stod(value());
+            else if (arg == "--update") update = true;
+            else if (arg == "--out") outPath = value();
+            else if (arg.rfind("--", 0) == 0) throw std::runtime_error("unknown option: " + arg);
+            else programs.push_back(arg);
+        }
+        if (minimlc.empty() || baselinePath.empty() || programs.empty())
+            throw std::runtime_error("usage: miniml_bench_corpus --minimlc <path> --baseline <file.json> <program.ml>...");
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 2;
+    }
+
+    try {
+        auto baseline = readBaseline(baselinePath);
+        std::map<std::string, double> medians;
+        int regressions = 0;
+        std::cout << "program                         median ms   baseline ms     change\n";
+        for (auto& program : programs) {
+            std::vector<double> times;
+            timeRun(minimlc, program);   // warm-up: file cache, dynamic loader
+            for (int r = 0; r < repeat; ++r) times.push_back(timeRun(minimlc, program));
+            std::sort(times.begin(), times.end());
+            double median = times[times.size() / 2];
+            auto name = baseName(program);
+            medians[name] = median;
+
+            char line[160];
+            auto it = baseline.find(name);
+            if (it == baseline.end()) {
+                std::snprintf(line, sizeof line, "%-30s %10.2f   %11s     (no baseline)\n", name.c_str(), median, "-");
+            } else {
+                double base = it->second;
+                double change = base > 0 ? (median - base) / base : 0.0;
+                bool regressed = median - base > minDeltaMs && change > threshold;
+                if (regressed) ++regressions;
+                std::snprintf(line, sizeof line, "%-30s %10.2f   %11.2f   %+7.1f%%%s\n", name.c_str(), median, base,
+                              100.0 * change, regressed ? "  REGRESSION" : "");
+            }
+            std::cout << line;
+        }
+
+        if (!outPath.empty()) writeResults(outPath, medians);
+        if (update) {
+            for (auto& [name, ms] : medians) baseline[name] = ms;   // keep entries for programs not run
+            writeResults(baselinePath, baseline);
+            std::cout << "baseline written to " << baselinePath << "\n";
+            return 0;
+        }
+        if (regressions) {
+            std::cout << regressions << " program(s) slower than the baseline by more than "
+                      << static_cast<int>(threshold * 100) << "%\n";
+            return 1;
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+}
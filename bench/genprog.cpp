@@ -0,0 +1,44 @@
+// miniml_genprog: write a generated MiniML program to stdout or a file.
+//
+//   miniml_genprog --shape <deep-lets|wide-tuples|polymorphic|curried|mixed>
+//                  --size <n> [--seed <n>] [-o <file>]
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "ProgramGen.hpp"
+
+int main(int argc, char** argv) {
+    try {
+        miniml::bench::GenOptions opts;
+        std::string outPath;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("missing argument for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--shape") {
+                auto s = value();
+                if (!miniml::bench::parseShape(s, opts.shape)) throw std::runtime_error("unknown shape: " + s);
+            }
+            else if (arg == "--size") opts.size = std::stoi(value());
+            else if (arg == "--seed") opts.seed = std::stoull(value());
+            else if (arg == "-o") outPath = value();
+            else throw std::runtime_error("unknown option: " + arg);
+        }
+
+        auto text = miniml::bench::generateProgram(opts);
+        if (outPath.empty()) {
+            std::cout << text;
+            return 0;
+        }
+        std::ofstream out(outPath);
+        if (!out) throw std::runtime_error("Cannot write file: " + outPath);
+        out << text;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,166 @@
+// miniml_infer_stress: type inference on its known worst cases.
+//
+//   miniml_infer_stress [--case <name>] [--max <n>] [--json]
+//
+// For every case and size it reports inference time, peak live heap during
+// inference, Subst::compose and unify calls, and the largest inferred type
+// (tree size and distinct nodes), plus the length of the printed result type.
+// Counters come from a second, instrumented run; time and memory from the first.
+// Programs are built as ASTs, so the parser does not take part.
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "ast/Nodes.hpp"
+#include "types/Infer.hpp"
+#include "types/InferStats.hpp"
+#include "types/Pretty.hpp"
+
+// Live and peak heap bytes, from a size header in front of every block.
+static std::size_t g_live = 0, g_peak = 0;
+
+void* operator new(std::size_t n) {
+    auto* p = static_cast<std::size_t*>(std::malloc(n + sizeof(std::max_align_t)));
+    if (!p) throw std::bad_alloc();
+    *p = n;
+    g_live += n;
+    g_peak = std::max(g_peak, g_live);
+    return reinterpret_cast<char*>(p) + sizeof(std::max_align_t);
+}
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    auto* base = reinterpret_cast<std::size_t*>(static_cast<char*>(p) - sizeof(std::max_align_t));
+    g_live -= *base;
+    std::free(base);
+}
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+using namespace miniml;
+
+static const SrcLoc L{"<stress>", 1, 1};
+
+static std::string v(int i) { return "x" + std::to_string(i); }
+
+// let x0 = \z -> z in let x1 = (x0, x0) in ... in x(n-1):
+// every pair instantiates two copies of a scheme with twice the variables of the last
+static ExprPtr letPairs(int n) {
+    ExprPtr body = var(v(n - 1), L);
+    for (int i = n - 1; i >= 1; --i)
+        body = let_(v(i), lit_tuple({var(v(i - 1), L), var(v(i - 1), L)}, L), body, L);
+    return let_(v(0), lam("z", var("z", L), L), body, L);
+}
+
+// let x0 = \z -> (z, z) in let x1 = \z -> x0 (x0 z) in ... in x(n-1) 1:
+// the result type squares its tree size at every step (2^(2^n) leaves), and since
+// instantiation copies the scheme, the shared DAG still doubles
+static ExprPtr pairDoubling(int n) {
+    ExprPtr body = app(var(v(n - 1), L), lit_int(1, L), L);
+    for (int i = n - 1; i >= 1; --i)
+        body = let_(v(i), lam("z", app(var(v(i - 1), L), app(var(v(i - 1), L), var("z", L), L), L), L), body, L);
+    return let_(v(0), lam("z", lit_tuple({var("z", L), var("z", L)}, L), L), body, L);
+}
+
+// let x0 = \z -> z in let x1 = \z -> x0 z in ... in x(n-1) 1: a chain of instantiations
+static ExprPtr instantiationChain(int n) {
+    ExprPtr body = app(var(v(n - 1), L), lit_int(1, L), L);
+    for (int i = n - 1; i >= 1; --i)
+        body = let_(v(i), lam("z", app(var(v(i - 1), L), var("z", L), L), L), body, L);
+    return let_(v(0), lam("z", var("z", L), L), body, L);
+}
+
+// \t -> \u -> t = (u, u, ..., u) applied to an n-tuple of fresh lambdas' results:
+// one long tuple unification against a tuple of n distinct variables
+static ExprPtr tupleUnify(int n) {
+    std::vector<ExprPtr> us, args;
+    for (int i = 0; i < n; ++i) {
+        us.push_back(var("u", L));
+        args.push_back(app(lam("w", var("w", L), L), lit_int(i, L), L));
+    }
+    auto f = lam("t", lam("u", binop(BinOp::Eq, var("t", L), lit_tuple(us, L), L), L), L);
+    return app(app(f, lit_tuple(args, L), L), lit_int(0, L), L);
+}
+
+struct Case {
+    const char* name;
+    std::function<ExprPtr(int)> build;
+    std::vector<int> sizes;
+};
+
+int main(int argc, char** argv) {
+    std::string only;
+    int maxSize = 1 << 30;
+    bool json = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--case" && i + 1 < argc) only = argv[++i];
+        else if (arg == "--max" && i + 1 < argc) maxSize = std::atoi(argv[++i]);
+        else if (arg == "--json") json = true;
+        else {
+            std::cerr << "usage: miniml_infer_stress [--case <name>] [--max <n>] [--json]\n";
+            return 2;
+        }
+    }
+
+    std::vector<Case> cases = {
+        {"let_pairs", letPairs, {4, 8, 12, 16}},
+        {"pair_doubling", pairDoubling, {2, 4, 6, 8, 10, 12}},
+        {"instantiation_chain", instantiationChain, {16, 64, 256, 1024}},
+        {"tuple_unify", tupleUnify, {16, 64, 256, 1024}},
+    };
+
+    if (json) std::cout << "[";
+    else
+        std::cout << "case                    n     time ms   peak KiB    compose      unify  max type size  nodes  printed\n";
+    bool first = true;
+    for (auto& c : cases) {
+        if (!only.empty() && only != c.name) continue;
+        for (int n : c.sizes) {
+            if (n > maxSize) continue;
+            auto ast = c.build(n);
+            std::size_t base = g_live;
+            g_peak = g_live;
+            auto start = std::chrono::steady_clock::now();
+            TypePtr type;
+            {
+                auto r = infer(ast, TypeEnv{});
+                type = apply_type(r.subst, r.type);
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            double peakKiB = static_cast<double>(g_peak - base) / 1024.0;
+            std::size_t printed = showType(type).size();
+
+            // counted in a second run, so that measuring sizes does not skew the time
+            InferStats stats;
+            {
+                InferStats::Scope scope(stats);
+                infer(ast, TypeEnv{});
+            }
+
+            char line[256];
+            if (json) {
+                std::snprintf(line, sizeof line,
+                              "%s\n  {\"case\":\"%s\",\"n\":%d,\"time_ms\":%.3f,\"peak_kib\":%.1f,\"compose\":%llu,"
+                              "\"unify\":%llu,\"max_type_size\":%llu,\"max_type_nodes\":%zu,\"printed\":%zu}",
+                              first ? "" : ",", c.name, n, ms, peakKiB,
+                              static_cast<unsigned long long>(stats.composeCalls),
+                              static_cast<unsigned long long>(stats.unifyCalls),
+                              static_cast<unsigned long long>(stats.maxTypeSize), stats.maxTypeNodes, printed);
+            } else {
+                std::snprintf(line, sizeof line, "%-20s %4d  %10.3f %10.1f %10llu %10llu %14llu %6zu %8zu\n", c.name, n,
+                              ms, peakKiB, static_cast<unsigned long long>(stats.composeCalls),
+                              static_cast<unsigned long long>(stats.unifyCalls),
+                              static_cast<unsigned long long>(stats.maxTypeSize), stats.maxTypeNodes, printed);
+            }
+            std::cout << line << std::flush;
+            first = false;
+        }
+    }
+    if (json) std::cout << "\n]\n";
+    return 0;
+}
@@ -0,0 +1,53 @@
+# CompareBackend.cmake
+#
+# Script mode (cmake -P): runs PROGRAM through the evaluator and through a
+# native backend and fails unless both print the same value.
+#
+#   cmake -DMINIMLC=<path> -DPROGRAM=<file.ml> -DWORK_DIR=<dir>
+#         "-DBACKEND_ARGS=-o <exe>" -DEXECUTABLE=<exe> -P CompareBackend.cmake
+#
+# BACKEND_ARGS (a shell-style string) are passed to minimlc before PROGRAM and must leave
+# EXECUTABLE behind; its stdout is compared against the "Value: ..." line.
+
+foreach(var MINIMLC PROGRAM WORK_DIR BACKEND_ARGS EXECUTABLE)
+  if (NOT DEFINED ${var})
+    message(FATAL_ERROR "CompareBackend: ${var} is not set")
+  endif()
+endforeach()
+
+separate_arguments(BACKEND_ARGS UNIX_COMMAND "${BACKEND_ARGS}")
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+execute_process(
+        COMMAND ${MINIMLC} ${PROGRAM}
+        OUTPUT_VARIABLE eval_out
+        RESULT_VARIABLE eval_rc
+)
+if (NOT eval_rc EQUAL 0)
+  message(FATAL_ERROR "evaluator failed on ${PROGRAM} (exit ${eval_rc})")
+endif()
+string(REGEX MATCH "Value: ([^\n]*)" _ "${eval_out}")
+set(expected "${CMAKE_MATCH_1}")
+
+execute_process(
+        COMMAND ${MINIMLC} ${BACKEND_ARGS} ${PROGRAM}
+        WORKING_DIRECTORY ${WORK_DIR}
+        RESULT_VARIABLE build_rc
+        ERROR_VARIABLE build_err
+)
+if (NOT build_rc EQUAL 0)
+  message(FATAL_ERROR "backend failed on ${PROGRAM}:\n${build_err}")
+endif()
+
+execute_process(
+        COMMAND ${EXECUTABLE}
+        OUTPUT_VARIABLE native_out
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+        RESULT_VARIABLE run_rc
+)
+if (NOT run_rc EQUAL 0)
+  message(FATAL_ERROR "${EXECUTABLE} exited with ${run_rc}")
+endif()
+if (NOT native_out STREQUAL expected)
+  message(FATAL_ERROR "${PROGRAM}: evaluator printed '${expected}', native code printed '${native_out}'")
+endif()
@@ -0,0 +1,33 @@
+# CompareCachedType.cmake
+#
+# Script mode (cmake -P): runs PROGRAM through minimlc with an empty on-disk
+# cache, then again so that it is loaded from the cache, and fails unless
+# both runs print the same "Type: ..." and "Value: ..." lines.
+#
+#   cmake -DMINIMLC=<path> -DPROGRAM=<file.ml> -DCACHE_DIR=<dir> -P CompareCachedType.cmake
+
+foreach(var MINIMLC PROGRAM CACHE_DIR)
+  if (NOT DEFINED ${var})
+    message(FATAL_ERROR "CompareCachedType: ${var} is not set")
+  endif()
+endforeach()
+
+file(REMOVE_RECURSE ${CACHE_DIR})
+
+foreach(run cold warm)
+  execute_process(
+          COMMAND ${MINIMLC} --cache-dir=${CACHE_DIR} ${PROGRAM}
+          OUTPUT_VARIABLE out
+          RESULT_VARIABLE rc
+  )
+  if (NOT rc EQUAL 0)
+    message(FATAL_ERROR "${run} run failed on ${PROGRAM} (exit ${rc})")
+  endif()
+  string(REGEX MATCH "Type: [^\n]*" ${run}_type "${out}")
+  string(REGEX MATCH "Value: [^\n]*" ${run}_value "${out}")
+endforeach()
+
+if (NOT cold_type STREQUAL warm_type OR NOT cold_value STREQUAL warm_value)
+  message(FATAL_ERROR "${PROGRAM}: cold run printed '${cold_type}' / '${cold_value}', "
+                      "cached run printed '${warm_type}' / '${warm_value}'")
+endif()
@@ -0,0 +1,102 @@
+/*
+ * miniml_rt.c - allocation, equality, printing and main() for compiled MiniML.
+ */
+#include "miniml_rt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MML_CHUNK (1u << 20)
+
+static char*  mml_heap_cur = NULL;
+static size_t mml_heap_left = 0;
+
+void* mml_alloc(size_t bytes) {
+    bytes = (bytes + 15u) & ~(size_t)15u;
+    if (bytes > mml_heap_left) {
+        if (bytes > MML_CHUNK / 4) {
+            void* big = malloc(bytes);
+            if (!big) { fputs("miniml: out of memory\n", stderr); exit(3); }
+            return big;
+        }
+        mml_heap_cur = (char*)malloc(MML_CHUNK);
+        if (!mml_heap_cur) { fputs("miniml: out of memory\n", stderr); exit(3); }
+        mml_heap_left = MML_CHUNK;
+    }
+    void* p = mml_heap_cur;
+    mml_heap_cur += bytes;
+    mml_heap_left -= bytes;
+    return p;
+}
+
+mml_val mml_make_tuple(int64_t size) {
+    mml_tuple* t = (mml_tuple*)mml_alloc(sizeof(mml_tuple) + (size_t)size * sizeof(mml_val));
+    t->kind = MML_KIND_TUPLE;
+    t->size = size;
+    return (mml_val)(intptr_t)t;
+}
+
+mml_val mml_make_closure(mml_fn fn, int64_t ncaps) {
+    mml_closure* c = (mml_closure*)mml_alloc(sizeof(mml_closure) + (size_t)ncaps * sizeof(mml_val));
+    c->kind = MML_KIND_CLOSURE;
+    c->size = ncaps;
+    c->fn = fn;
+    return (mml_val)(intptr_t)c;
+}
+
+int64_t mml_equal(mml_val a, mml_val b) {
+    if (a == b) return 1;
+    if (MML_IS_IMM(a) || MML_IS_IMM(b)) return 0;
+    const mml_tuple* ta = (const mml_tuple*)(intptr_t)a;
+    const mml_tuple* tb = (const mml_tuple*)(intptr_t)b;
+    if (ta->kind != MML_KIND_TUPLE || tb->kind != MML_KIND_TUPLE) return 0;   /* distinct closures */
+    if (ta->size != tb->size) return 0;
+    for (int64_t i = 0; i < ta->size; ++i)
+        if (!mml_equal(ta->elems[i], tb->elems[i])) return 0;
+    return 1;
+}
+
+/* Print one value; returns the descriptor position after its type. */
+static const char* mml_print_rec(mml_val v, const char* type) {
+    switch (*type) {
+        case 'i': printf("%lld", (long long)MML_UNINT(v)); return type + 1;
+        case 'b': fputs(v == MML_TRUE ? "true" : "false", stdout); return type + 1;
+        case 'f': fputs("<fun>", stdout); return type + 1;
+        case '(': {
+            const mml_tuple* t = (const mml_tuple*)(intptr_t)v;
+            ++type;
+            putchar('(');
+            for (int64_t i = 0; i < t->size; ++i) {
+                if (i) fputs(", ", stdout);
+                type = mml_print_rec(t->elems[i], type);
+            }
+            putchar(')');
+            return type + 1;   /* skip ')' */
+        }
+        default: break;
+    }
+    /* unknown type: inspect the value itself */
+    if (MML_IS_IMM(v)) printf("%lld", (long long)MML_UNINT(v));
+    else if (((const mml_tuple*)(intptr_t)v)->kind == MML_KIND_CLOSURE) fputs("<fun>", stdout);
+    else {
+        const mml_tuple* t = (const mml_tuple*)(intptr_t)v;
+        putchar('(');
+        for (int64_t i = 0; i < t->size; ++i) {
+            if (i) fputs(", ", stdout);
+            mml_print_rec(t->elems[i], "?");
+        }
+        putchar(')');
+    }
+    return type + 1;
+}
+
+void mml_print(mml_val v, const char* type) {
+    mml_print_rec(v, type);
+}
+
+int main(void) {
+    mml_val v = mml_entry();
+    mml_print(v, mml_result_type);
+    putchar('\n');
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * miniml_rt.h - runtime support for natively compiled MiniML programs.
+ *
+ * Every value is one machine word (mml_val):
+ *   Int n   -> (n << 1) | 1      unboxed, low bit set; MiniML Ints have 63
+ *                                bits in every engine (src/ast/Int.hpp)
+ *   Bool b  -> MML_INT(b)         unboxed, so false = 1 and true = 3
+ *   Tuple   -> pointer to mml_tuple   (low bit clear)
+ *   Closure -> pointer to mml_closure (low bit clear)
+ *
+ * Generated code defines mml_entry() and mml_result_type (a descriptor of the
+ * program's inferred type used for printing); miniml_rt.c provides main().
+ */
+#ifndef MINIML_RT_H
+#define MINIML_RT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int64_t mml_val;
+
+#define MML_INT(n)     ((mml_val)(((uint64_t)(int64_t)(n) << 1) | 1u))
+#define MML_UNINT(v)   ((int64_t)(v) >> 1)
+#define MML_FALSE      MML_INT(0)
+#define MML_TRUE       MML_INT(1)
+#define MML_BOOL(b)    ((b) ? MML_TRUE : MML_FALSE)
+#define MML_IS_IMM(v)  (((v) & 1) != 0)
+#define MML_TUPLE(v)   ((mml_tuple*)(intptr_t)(v))
+#define MML_CLOSURE(v) ((mml_closure*)(intptr_t)(v))
+
+enum { MML_KIND_TUPLE = 1, MML_KIND_CLOSURE = 2 };
+
+typedef struct mml_tuple {
+    int64_t kind;        /* MML_KIND_TUPLE */
+    int64_t size;
+    mml_val elems[];
+} mml_tuple;
+
+typedef struct mml_closure mml_closure;
+typedef mml_val (*mml_fn)(mml_closure* self, mml_val arg);
+
+struct mml_closure {
+    int64_t kind;        /* MML_KIND_CLOSURE */
+    int64_t size;        /* number of captured values */
+    mml_fn  fn;
+    mml_val caps[];
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bump allocation; objects live until the program exits. */
+void*   mml_alloc(size_t bytes);
+
+/* Allocate a tuple / closure header; the caller fills elems / caps. */
+mml_val mml_make_tuple(int64_t size);
+mml_val mml_make_closure(mml_fn fn, int64_t ncaps);
+
+/* Structural equality (closures by identity). Returns 0 or 1. */
+int64_t mml_equal(mml_val a, mml_val b);
+
+/* Print v formatted like the evaluator's showVal, guided by a type
+ * descriptor: 'i' Int, 'b' Bool, 'f' function, '?' unknown, '(' ... ')' tuple. */
+void    mml_print(mml_val v, const char* type);
+
+/* Provided by the generated program. */
+mml_val mml_entry(void);
+extern const char mml_result_type[];
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Int arithmetic directly on tagged words (wrapping, division by zero gives 0
+ * like the evaluator). Used by C code emitted with --emit-c. */
+static inline mml_val mml_add(mml_val a, mml_val b) { return (mml_val)((uint64_t)a + (uint64_t)b - 1u); }
+static inline mml_val mml_sub(mml_val a, mml_val b) { return (mml_val)((uint64_t)a - (uint64_t)b + 1u); }
+static inline mml_val mml_mul(mml_val a, mml_val b) {
+    return (mml_val)(((uint64_t)a - 1u) * (uint64_t)MML_UNINT(b) + 1u);
+}
+static inline mml_val mml_div(mml_val a, mml_val b) {
+    int64_t d = MML_UNINT(b);
+    return d == 0 ? MML_INT(0) : MML_INT(MML_UNINT(a) / d);
+}
+
+#endif /* MINIML_RT_H */
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace miniml {
+
+    // MiniML's Int is 63 bits wide, like OCaml's: the native backends keep an
+    // Int in a tagged machine word (runtime/miniml_rt.h), so that polymorphic
+    // '=' can tell it from a pointer, and every other engine (eval, the CEK
+    // machine, the IR interpreter, constant folding) wraps to the same range.
+    // Arithmetic wraps modulo 2^63; division by zero gives 0.
+
+    inline constexpr int kIntBits = 63;
+    inline constexpr long kIntMax = (1L << (kIntBits - 1)) - 1;
+    inline constexpr long kIntMin = -kIntMax - 1;
+
+    // Sign-extend the low 63 bits of 'n'.
+    inline long wrapInt(long n) { return static_cast<long>(static_cast<unsigned long>(n) << 1) >> 1; }
+
+    inline long intAdd(long x, long y) { return wrapInt(static_cast<long>(static_cast<unsigned long>(x) + static_cast<unsigned long>(y))); }
+    inline long intSub(long x, long y) { return wrapInt(static_cast<long>(static_cast<unsigned long>(x) - static_cast<unsigned long>(y))); }
+    inline long intMul(long x, long y) { return wrapInt(static_cast<long>(static_cast<unsigned long>(x) * static_cast<unsigned long>(y))); }
+    // Operands are already in range, so only kIntMin / -1 leaves it.
+    inline long intDiv(long x, long y) { return y == 0 ? 0 : wrapInt(x / y); }
+
+} // namespace miniml
@@ -3,6 +3,7 @@
 #include <string>
 #include <variant>
 #include <vector>
+#include "Int.hpp"
 
 namespace miniml {
     // --- NEW: source location
@@ -29,6 +30,7 @@ namespace miniml {
     struct EVar {
         SrcLoc loc;
         std::string name;
+        bool lastUse = false;      // the binding is not read after this (set by analyzeLastUses)
     };
     // An integer literal.
     struct ELitInt {
@@ -44,18 +46,24 @@ namespace miniml {
     struct ELitTuple {
         SrcLoc loc;
         std::vector<ExprPtr> elems;
+        bool escapes = true;       // false: only compared, never stored (set by analyzeEscapes)
+        std::vector<bool> fork;    // elements evaluated as parallel tasks (set by analyzeParallelism)
     };
     // A lambda/function with one parameter. (Currying means multi-arg functions are nested lambdas.)
     struct ELam {
         SrcLoc loc;
         std::string param;
         ExprPtr body;
+        bool escapes = true;       // false: applied immediately or only called (set by analyzeEscapes)
+        bool frameEscapes = true;  // false: no closure can capture the frame of a call
+        bool memo = false;         // [@memo]: calls are answered from EvalContext::memo
     };
     // Function application. Left-associative: f a b parses/lowers to EApp(EApp(f,a), b).
     struct EApp {
         SrcLoc loc;
         ExprPtr fn;
         ExprPtr arg;
+        bool forkArg = false;      // evaluate 'arg' as a parallel task (set by analyzeParallelism)
     };
     // A local binding: let name = rhs in body. Introduces a new scope for body.
     struct ELet {
@@ -63,6 +71,7 @@ namespace miniml {
         std::string name;
         ExprPtr rhs;
         ExprPtr body;
+        bool frameEscapes = true;  // false: no closure can capture the frame binding 'name'
     };
     // Conditional expression (not a statement). Both branches are expressions.
     struct EIf {
@@ -87,11 +96,12 @@ namespace miniml {
         BinOp op;
         ExprPtr lhs;
         ExprPtr rhs;
+        bool forkRhs = false;      // evaluate 'rhs' as a parallel task (set by analyzeParallelism)
     };
 
     // --- Convenience constructors (keep API you already used)
     inline ExprPtr var(std::string n, SrcLoc loc)            { return make_expr<EVar>(loc, std::move(n)); }
-    inline ExprPtr lit_int(std::int64_t v, SrcLoc loc)       { return make_expr<ELitInt>(loc, v); }
+    inline ExprPtr lit_int(std::int64_t v, SrcLoc loc)       { return make_expr<ELitInt>(loc, wrapInt(v)); }
     inline ExprPtr lit_bool(bool v, SrcLoc loc)       { return make_expr<ELitBool>(loc, v); }
     inline ExprPtr lam(std::string x, ExprPtr b, SrcLoc loc) { return make_expr<ELam>(loc, std::move(x), std::move(b)); }
     inline ExprPtr app(ExprPtr f, ExprPtr a, SrcLoc loc)     { return make_expr<EApp>(loc, std::move(f), std::move(a)); }
@@ -0,0 +1,50 @@
+#include "Runtime.hpp"
+#include <cstdlib>
+
+#ifndef MINIML_RUNTIME_DIR
+#define MINIML_RUNTIME_DIR "runtime"
+#endif
+
+namespace miniml {
+
+std::string runtimeTypeDescriptor(const TypePtr& t) {
+  if (!t) return "?";
+  switch (t->k) {
+    case TKind::INT:  return "i";
+    case TKind::BOOL: return "b";
+    case TKind::FUN:  return "f";
+    case TKind::VAR:  return "?";
+    case TKind::TUPLE: {
+      std::string s = "(";
+      for (auto& e : t->tupleElems) s += runtimeTypeDescriptor(e);
+      return s + ")";
+    }
+  }
+  return "?";
+}
+
+std::string runtimeDir() {
+  if (const char* env = std::getenv("MINIML_RUNTIME_DIR")) return env;
+  return MINIML_RUNTIME_DIR;
+}
+
+static std::string quote(const std::string& s) {
+  std::string q = "'";
+  for (char c : s) {
+    if (c == '\'') q += "'\\''";
+    else q += c;
+  }
+  return q + "'";
+}
+
+void linkWithRuntime(const std::vector<std::string>& inputs, const std::string& exePath) {
+  const char* cc = std::getenv("CC");
+  std::string dir = runtimeDir();
+  std::string cmd = std::string(cc && *cc ? cc : "cc") + " -O2 -I" + quote(dir);
+  for (auto& in : inputs) cmd += " " + quote(in);
+  cmd += " " + quote(dir + "/miniml_rt.c") + " -o " + quote(exePath);
+  if (std::system(cmd.c_str()) != 0)
+    throw BackendError("link failed: " + cmd);
+}
+
+} // namespace miniml
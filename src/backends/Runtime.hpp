@@ -0,0 +1,25 @@
+#pragma once
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../types/Type.hpp"
+
+namespace miniml {
+
+    struct BackendError : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    // Type descriptor consumed by mml_print (runtime/miniml_rt.h):
+    // Int -> "i", Bool -> "b", functions -> "f", tuples -> "(...)", variables -> "?".
+    std::string runtimeTypeDescriptor(const TypePtr& t);
+
+    // Directory holding miniml_rt.h / miniml_rt.c (MINIML_RUNTIME_DIR at build time,
+    // overridable with the MINIML_RUNTIME_DIR environment variable).
+    std::string runtimeDir();
+
+    // Compile and link 'inputs' (C sources or objects) together with the runtime
+    // into an executable using the system C compiler ($CC, default "cc").
+    void linkWithRuntime(const std::vector<std::string>& inputs, const std::string& exePath);
+
+} // namespace miniml
@@ -0,0 +1,166 @@
+#include "CBackend.hpp"
+#include <sstream>
+
+namespace miniml {
+
+namespace {
+
+std::string tmp(Temp t) { return "t" + std::to_string(t); }
+std::string shadow(Temp t) { return "p" + std::to_string(t); }   // phi input, set on the incoming edge
+std::string label(int b) { return "b" + std::to_string(b); }
+std::string fnName(size_t i) { return "mml_fn_" + std::to_string(i); }
+
+// C condition for 'a == b' at type 't'; unknown (polymorphic) types go through the runtime.
+std::string equality(const std::string& a, const std::string& b, const TypePtr& t) {
+  if (!t || t->k == TKind::VAR) return "mml_equal(" + a + ", " + b + ")";
+  if (t->k != TKind::TUPLE) return "(" + a + " == " + b + ")";   // Int, Bool; functions by identity
+  std::string s = "(" + a + " == " + b;
+  if (!t->tupleElems.empty()) {
+    s += " || (";
+    for (size_t i = 0; i < t->tupleElems.size(); ++i) {
+      if (i) s += " && ";
+      std::string idx = "->elems[" + std::to_string(i) + "]";
+      s += equality("MML_TUPLE(" + a + ")" + idx, "MML_TUPLE(" + b + ")" + idx, t->tupleElems[i]);
+    }
+    s += ")";
+  }
+  return s + ")";
+}
+
+std::string binop(const IRInstr& in) {
+  std::string a = tmp(in.args[0]), b = tmp(in.args[1]);
+  switch (in.bop) {
+    case BinOp::Add: return "mml_add(" + a + ", " + b + ")";
+    case BinOp::Sub: return "mml_sub(" + a + ", " + b + ")";
+    case BinOp::Mul: return "mml_mul(" + a + ", " + b + ")";
+    case BinOp::Div: return "mml_div(" + a + ", " + b + ")";
+    // tagging preserves order, so comparisons work on the words directly
+    case BinOp::Lt:  return "MML_BOOL(" + a + " < " + b + ")";
+    case BinOp::Le:  return "MML_BOOL(" + a + " <= " + b + ")";
+    case BinOp::Gt:  return "MML_BOOL(" + a + " > " + b + ")";
+    case BinOp::Ge:  return "MML_BOOL(" + a + " >= " + b + ")";
+    case BinOp::Eq:  return "MML_BOOL(" + equality(a, b, in.operandType) + ")";
+    case BinOp::Neq: return "MML_BOOL(!" + equality(a, b, in.operandType) + ")";
+    case BinOp::And: return "(" + a + " & " + b + ")";   // never emitted by lowering
+    case BinOp::Or:  return "(" + a + " | " + b + ")";
+  }
+  return "MML_FALSE";
+}
+
+class FuncEmitter {
+public:
+  FuncEmitter(std::ostringstream& out, const IRFunc& f, size_t index) : out_(out), f_(f), index_(index) {}
+
+  void emit() {
+    std::vector<char> defined(f_.nextTemp, 0), isPhi(f_.nextTemp, 0), targeted(f_.blocks.size(), 0);
+    for (auto& blk : f_.blocks) {
+      for (auto& in : blk.body) {
+        defined[in.dst] = 1;
+        if (in.op == IROp::Phi) isPhi[in.dst] = 1;
+      }
+      if (blk.term.k != IRTermKind::Ret) targeted[blk.term.target] = 1;
+      if (blk.term.k == IRTermKind::Br) targeted[blk.term.otherwise] = 1;
+    }
+
+    out_ << "/* " << f_.name << " */\n";
+    out_ << "static mml_val " << fnName(index_) << "(mml_closure* self, mml_val arg) {\n";
+    out_ << "    (void)self; (void)arg;\n";
+    declare(defined, tmp);
+    declare(isPhi, shadow);
+
+    for (size_t b = 0; b < f_.blocks.size(); ++b) {
+      if (targeted[b]) out_ << label(static_cast<int>(b)) << ":;\n";
+      auto& blk = f_.blocks[b];
+      for (auto& in : blk.body) instr(in);
+      term(static_cast<int>(b), blk.term);
+    }
+    out_ << "}\n\n";
+  }
+
+private:
+  std::ostringstream& out_;
+  const IRFunc& f_;
+  size_t index_;
+
+  template <class Name>
+  void declare(const std::vector<char>& which, Name name) {
+    std::string line;
+    for (Temp t = 0; t < static_cast<Temp>(which.size()); ++t) {
+      if (!which[t]) continue;
+      line += line.empty() ? "    mml_val " : ", ";
+      line += name(t);
+      if (line.size() > 90) { out_ << line << ";\n"; line.clear(); }
+    }
+    if (!line.empty()) out_ << line << ";\n";
+  }
+
+  void instr(const IRInstr& in) {
+    std::string d = "    " + tmp(in.dst) + " = ";
+    switch (in.op) {
+      case IROp::Const:   out_ << d << "MML_INT(" << in.imm << "L);\n"; break;
+      case IROp::Bool:    out_ << d << (in.imm ? "MML_TRUE" : "MML_FALSE") << ";\n"; break;
+      case IROp::Copy:    out_ << d << tmp(in.args[0]) << ";\n"; break;
+      case IROp::Param:   out_ << d << "arg;\n"; break;
+      case IROp::Capture: out_ << d << "self->caps[" << in.imm << "];\n"; break;
+      case IROp::Phi:     out_ << d << shadow(in.dst) << ";\n"; break;
+      case IROp::Bin:     out_ << d << binop(in) << ";\n"; break;
+      case IROp::Un:      out_ << d << tmp(in.args[0]) << " ^ (MML_TRUE ^ MML_FALSE);\n"; break;
+      case IROp::Call:
+        out_ << d << "MML_CLOSURE(" << tmp(in.args[0]) << ")->fn(MML_CLOSURE(" << tmp(in.args[0]) << "), "
+             << tmp(in.args[1]) << ");\n";
+        break;
+      case IROp::Tuple:
+        out_ << d << "mml_make_tuple(" << in.args.size() << ");\n";
+        for (size_t i = 0; i < in.args.size(); ++i)
+          out_ << "    MML_TUPLE(" << tmp(in.dst) << ")->elems[" << i << "] = " << tmp(in.args[i]) << ";\n";
+        break;
+      case IROp::Closure:
+        out_ << d << "mml_make_closure(" << fnName(static_cast<size_t>(in.imm)) << ", " << in.args.size() << ");\n";
+        for (size_t i = 0; i < in.args.size(); ++i)
+          out_ << "    MML_CLOSURE(" << tmp(in.dst) << ")->caps[" << i << "] = " << tmp(in.args[i]) << ";\n";
+        break;
+    }
+  }
+
+  // Assignments feeding the phis of 'to' along the edge from -> to.
+  std::string edge(int from, int to, const std::string& indent) {
+    std::string s;
+    for (auto& in : f_.blocks[to].body) {
+      if (in.op != IROp::Phi) break;
+      for (size_t k = 0; k < in.preds.size(); ++k)
+        if (in.preds[k] == from) s += indent + shadow(in.dst) + " = " + tmp(in.args[k]) + ";\n";
+    }
+    return s + indent + "goto " + label(to) + ";\n";
+  }
+
+  void term(int b, const IRTerm& t) {
+    switch (t.k) {
+      case IRTermKind::Ret: out_ << "    return " << tmp(t.value) << ";\n"; break;
+      case IRTermKind::Jmp: out_ << edge(b, t.target, "    "); break;
+      case IRTermKind::Br:
+        out_ << "    if (" << tmp(t.value) << " != MML_FALSE) {\n" << edge(b, t.target, "        ")
+             << "    } else {\n" << edge(b, t.otherwise, "        ") << "    }\n";
+        break;
+    }
+  }
+};
+
+} // namespace
+
+std::string emitC(const IRProgram& prog, const TypePtr& resultType) {
+  std::ostringstream out;
+  out << "/* Generated by minimlc --emit-c; compile with runtime/miniml_rt.c */\n";
+  out << "#include \"miniml_rt.h\"\n\n";
+  for (size_t i = 0; i < prog.funcs.size(); ++i)
+    out << "static mml_val " << fnName(i) << "(mml_closure* self, mml_val arg);\n";
+  out << "\n";
+  for (size_t i = 0; i < prog.funcs.size(); ++i) FuncEmitter(out, prog.funcs[i], i).emit();
+
+  out << "const char mml_result_type[] = \"" << runtimeTypeDescriptor(resultType) << "\";\n\n";
+  out << "mml_val mml_entry(void) {\n";
+  out << "    return " << fnName(static_cast<size_t>(prog.entry)) << "(NULL, MML_INT(0));\n";
+  out << "}\n";
+  return out.str();
+}
+
+} // namespace miniml
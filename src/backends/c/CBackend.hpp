@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+#include "../../ir/IR.hpp"
+#include "../../types/Type.hpp"
+#include "../Runtime.hpp"
+
+namespace miniml {
+
+    // Portable C (C99) for the program, to be compiled together with
+    // runtime/miniml_rt.c (see linkWithRuntime). Values use the runtime's
+    // word representation, like the LLVM backend: Ints and Bools are unboxed
+    // tagged words, tuples and closures are runtime structs. Equality uses the
+    // operand types recorded by lower() where they are known and only falls
+    // back to the runtime's generic mml_equal for polymorphic operands.
+    // 'resultType' is the inferred type of the program; it drives printing.
+    // Accepts IR before and after toSSA/PassManager.
+    std::string emitC(const IRProgram& prog, const TypePtr& resultType);
+
+} // namespace miniml
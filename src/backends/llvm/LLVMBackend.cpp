@@ -0,0 +1,300 @@
+#include "LLVMBackend.hpp"
+#include "../../ir/CFG.hpp"
+#include "../../ir/SSA.hpp"
+
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+namespace miniml {
+
+namespace {
+
+// Word layout, see runtime/miniml_rt.h
+constexpr int64_t kFalse = 1, kTrue = 3;
+constexpr int64_t kKindTuple = 1, kKindClosure = 2;
+constexpr int64_t kTupleElems = 2;     // words before the first tuple element
+constexpr int64_t kClosureFn = 2;      // word index of the function pointer
+constexpr int64_t kClosureCaps = 3;    // words before the first capture
+
+struct Codegen {
+  llvm::LLVMContext& ctx;
+  llvm::Module& mod;
+  llvm::IRBuilder<> b;
+  llvm::Type* i64;
+  llvm::PointerType* i8p;
+  llvm::PointerType* i64p;
+  llvm::FunctionType* fnTy;   // i64 (i8* self, i64 arg)
+  llvm::FunctionCallee rtAlloc, rtEqual;
+  std::vector<llvm::Function*> fns;
+
+  Codegen(llvm::LLVMContext& c, llvm::Module& m) : ctx(c), mod(m), b(c) {
+    i64 = llvm::Type::getInt64Ty(ctx);
+    i8p = llvm::Type::getInt8PtrTy(ctx);
+    i64p = llvm::Type::getInt64PtrTy(ctx);
+    fnTy = llvm::FunctionType::get(i64, {i8p, i64}, false);
+    rtAlloc = mod.getOrInsertFunction("mml_alloc", llvm::FunctionType::get(i8p, {i64}, false));
+    rtEqual = mod.getOrInsertFunction("mml_equal", llvm::FunctionType::get(i64, {i64, i64}, false));
+  }
+
+  llvm::Value* word(int64_t v) { return llvm::ConstantInt::get(i64, v); }
+  llvm::Value* tagged(int64_t n) { return word(static_cast<int64_t>((static_cast<uint64_t>(n) << 1) | 1u)); }
+  llvm::Value* boolWord(llvm::Value* bit) { return b.CreateSelect(bit, word(kTrue), word(kFalse)); }
+
+  llvm::Value* slot(llvm::Value* obj, int64_t index) {   // obj: i64 word holding a pointer
+    auto* p = b.CreateIntToPtr(obj, i64p);
+    return b.CreateInBoundsGEP(i64, p, word(index));
+  }
+
+  llvm::Value* allocObject(int64_t kind, const std::vector<llvm::Value*>& words) {
+    auto* raw = b.CreateCall(rtAlloc, {word(8 * static_cast<int64_t>(words.size() + 2))});
+    auto* obj = b.CreatePtrToInt(raw, i64);
+    b.CreateStore(word(kind), slot(obj, 0));
+    b.CreateStore(word(static_cast<int64_t>(words.size()) - (kind == kKindClosure ? 1 : 0)), slot(obj, 1));
+    for (size_t i = 0; i < words.size(); ++i) b.CreateStore(words[i], slot(obj, 2 + static_cast<int64_t>(i)));
+    return obj;
+  }
+
+  // Equality: identical words are equal; otherwise only two heap objects can
+  // still be (structurally) equal, which the runtime decides. Unboxed and
+  // function operands (known from their inferred type) never need the runtime.
+  llvm::Value* equal(llvm::Value* l, llvm::Value* r, const TypePtr& t) {
+    auto* same = b.CreateICmpEQ(l, r);
+    if (t && t->k != TKind::VAR && t->k != TKind::TUPLE) return same;
+    auto* bothPtr = b.CreateICmpEQ(b.CreateAnd(b.CreateOr(l, r), word(1)), word(0));
+    auto* needCall = b.CreateAnd(b.CreateNot(same), bothPtr);
+    auto* fn = b.GetInsertBlock()->getParent();
+    auto* from = b.GetInsertBlock();
+    auto* slow = llvm::BasicBlock::Create(ctx, "eq.slow", fn);
+    auto* join = llvm::BasicBlock::Create(ctx, "eq.join", fn);
+    b.CreateCondBr(needCall, slow, join);
+    b.SetInsertPoint(slow);
+    auto* deep = b.CreateICmpNE(b.CreateCall(rtEqual, {l, r}), word(0));
+    b.CreateBr(join);
+    b.SetInsertPoint(join);
+    auto* phi = b.CreatePHI(b.getInt1Ty(), 2);
+    phi->addIncoming(same, from);
+    phi->addIncoming(deep, slow);
+    return phi;
+  }
+
+  llvm::Value* binop(BinOp op, llvm::Value* l, llvm::Value* r, const TypePtr& operandType) {
+    switch (op) {
+      case BinOp::Add: return b.CreateSub(b.CreateAdd(l, r), word(1));
+      case BinOp::Sub: return b.CreateAdd(b.CreateSub(l, r), word(1));
+      case BinOp::Mul: return b.CreateAdd(b.CreateMul(b.CreateSub(l, word(1)), b.CreateAShr(r, 1)), word(1));
+      case BinOp::Div: {
+        // division by zero yields 0, as in the evaluator
+        auto* x = b.CreateAShr(l, 1);
+        auto* y = b.CreateAShr(r, 1);
+        auto* zero = b.CreateICmpEQ(y, word(0));
+        auto* q = b.CreateSDiv(x, b.CreateSelect(zero, word(1), y));
+        q = b.CreateSelect(zero, word(0), q);
+        return b.CreateOr(b.CreateShl(q, 1), word(1));
+      }
+      // tagging preserves order, so comparisons work on the words directly
+      case BinOp::Lt:  return boolWord(b.CreateICmpSLT(l, r));
+      case BinOp::Le:  return boolWord(b.CreateICmpSLE(l, r));
+      case BinOp::Gt:  return boolWord(b.CreateICmpSGT(l, r));
+      case BinOp::Ge:  return boolWord(b.CreateICmpSGE(l, r));
+      case BinOp::Eq:  return boolWord(equal(l, r, operandType));
+      case BinOp::Neq: return boolWord(b.CreateNot(equal(l, r, operandType)));
+      case BinOp::And: return b.CreateAnd(l, r);   // never emitted by lowering
+      case BinOp::Or:  return b.CreateOr(l, r);
+    }
+    return word(kFalse);
+  }
+
+  void genFunc(const IRFunc& f, llvm::Function* F) {
+    auto* self = F->getArg(0);
+    auto* arg = F->getArg(1);
+    self->setName("self");
+    arg->setName("arg");
+
+    std::vector<llvm::BasicBlock*> start(f.blocks.size()), end(f.blocks.size());
+    for (size_t i = 0; i < f.blocks.size(); ++i)
+      start[i] = llvm::BasicBlock::Create(ctx, "b" + std::to_string(i), F);
+    std::vector<llvm::Value*> val(f.nextTemp, nullptr);
+    std::vector<std::pair<const IRInstr*, llvm::PHINode*>> phis;
+
+    // reverse postorder visits every definition before its non-phi uses
+    for (int bi : reversePostorder(f)) {
+      const IRBlock& blk = f.blocks[bi];
+      b.SetInsertPoint(start[bi]);
+      for (const IRInstr& in : blk.body) {
+        auto arg0 = [&] { return val[in.args[0]]; };
+        switch (in.op) {
+          case IROp::Const: val[in.dst] = tagged(in.imm); break;
+          case IROp::Bool:  val[in.dst] = word(in.imm ? kTrue : kFalse); break;
+          case IROp::Copy:  val[in.dst] = arg0(); break;
+          case IROp::Param: val[in.dst] = arg; break;
+          case IROp::Bin:   val[in.dst] = binop(in.bop, arg0(), val[in.args[1]], in.operandType); break;
+          case IROp::Un:    val[in.dst] = b.CreateXor(arg0(), word(kTrue ^ kFalse)); break;
+          case IROp::Capture: {
+            auto* selfWord = b.CreatePtrToInt(self, i64);
+            val[in.dst] = b.CreateLoad(i64, slot(selfWord, kClosureCaps + in.imm));
+            break;
+          }
+          case IROp::Tuple: {
+            std::vector<llvm::Value*> ws;
+            for (Temp t : in.args) ws.push_back(val[t]);
+            val[in.dst] = allocObject(kKindTuple, ws);
+            break;
+          }
+          case IROp::Closure: {
+            std::vector<llvm::Value*> ws{b.CreatePtrToInt(fns[in.imm], i64)};
+            for (Temp t : in.args) ws.push_back(val[t]);
+            val[in.dst] = allocObject(kKindClosure, ws);
+            break;
+          }
+          case IROp::Call: {
+            auto* clo = arg0();
+            auto* fnWord = b.CreateLoad(i64, slot(clo, kClosureFn));
+            auto* fnPtr = b.CreateIntToPtr(fnWord, fnTy->getPointerTo());
+            val[in.dst] = b.CreateCall(fnTy, fnPtr, {b.CreateIntToPtr(clo, i8p), val[in.args[1]]});
+            break;
+          }
+          case IROp::Phi: {
+            auto* phi = b.CreatePHI(i64, static_cast<unsigned>(in.args.size()));
+            phis.emplace_back(&in, phi);
+            val[in.dst] = phi;
+            break;
+          }
+        }
+      }
+      switch (blk.term.k) {
+        case IRTermKind::Ret: b.CreateRet(val[blk.term.value]); break;
+        case IRTermKind::Jmp: b.CreateBr(start[blk.term.target]); break;
+        case IRTermKind::Br:
+          b.CreateCondBr(b.CreateICmpNE(val[blk.term.value], word(kFalse)),
+                         start[blk.term.target], start[blk.term.otherwise]);
+          break;
+      }
+      end[bi] = b.GetInsertBlock();   // equality may have split the block
+    }
+    for (auto& [in, phi] : phis)
+      for (size_t k = 0; k < in->args.size(); ++k)
+        phi->addIncoming(val[in->args[k]], end[in->preds[k]]);
+  }
+
+  void gen(const IRProgram& prog, const std::string& typeDesc) {
+    for (size_t i = 0; i < prog.funcs.size(); ++i)
+      fns.push_back(llvm::Function::Create(fnTy, llvm::Function::InternalLinkage,
+                                           "mml_" + prog.funcs[i].name + "_" + std::to_string(i), mod));
+    for (size_t i = 0; i < prog.funcs.size(); ++i) genFunc(prog.funcs[i], fns[i]);
+
+    // mml_val mml_entry(void)
+    auto* entry = llvm::Function::Create(llvm::FunctionType::get(i64, false),
+                                         llvm::Function::ExternalLinkage, "mml_entry", mod);
+    b.SetInsertPoint(llvm::BasicBlock::Create(ctx, "entry", entry));
+    b.CreateRet(b.CreateCall(fnTy, fns[prog.entry], {llvm::ConstantPointerNull::get(i8p), word(0)}));
+
+    // const char mml_result_type[]
+    auto* desc = llvm::ConstantDataArray::getString(ctx, typeDesc);
+    new llvm::GlobalVariable(mod, desc->getType(), true, llvm::GlobalValue::ExternalLinkage, desc, "mml_result_type");
+  }
+};
+
+llvm::TargetMachine* hostTargetMachine() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+  });
+  auto triple = llvm::sys::getDefaultTargetTriple();
+  std::string err;
+  auto* target = llvm::TargetRegistry::lookupTarget(triple, err);
+  if (!target) throw BackendError("LLVM: " + err);
+  return target->createTargetMachine(triple, "generic", "", llvm::TargetOptions{},
+                                     llvm::Optional<llvm::Reloc::Model>(llvm::Reloc::PIC_));
+}
+
+// Build (and optionally optimize) the module for 'prog'.
+std::unique_ptr<llvm::Module> buildModule(llvm::LLVMContext& ctx, llvm::TargetMachine* tm,
+                                          const IRProgram& prog, const TypePtr& resultType,
+                                          const LLVMOptions& opts) {
+  IRProgram ssa = prog;
+  toSSA(ssa);
+
+  auto mod = std::make_unique<llvm::Module>("miniml", ctx);
+  mod->setTargetTriple(tm->getTargetTriple().str());
+  mod->setDataLayout(tm->createDataLayout());
+  Codegen cg(ctx, *mod);
+  cg.gen(ssa, runtimeTypeDescriptor(resultType));
+
+  std::string err;
+  llvm::raw_string_ostream es(err);
+  if (llvm::verifyModule(*mod, &es)) throw BackendError("LLVM: invalid module: " + es.str());
+
+  if (opts.optimize) {
+    llvm::LoopAnalysisManager lam;
+    llvm::FunctionAnalysisManager fam;
+    llvm::CGSCCAnalysisManager cgam;
+    llvm::ModuleAnalysisManager mam;
+    llvm::PassBuilder pb(tm);
+    pb.registerModuleAnalyses(mam);
+    pb.registerCGSCCAnalyses(cgam);
+    pb.registerFunctionAnalyses(fam);
+    pb.registerLoopAnalyses(lam);
+    pb.crossRegisterProxies(lam, fam, cgam, mam);
+    pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2).run(*mod, mam);
+  }
+  return mod;
+}
+
+} // namespace
+
+std::string emitLLVMIR(const IRProgram& prog, const TypePtr& resultType, const LLVMOptions& opts) {
+  llvm::LLVMContext ctx;
+  std::unique_ptr<llvm::TargetMachine> tm(hostTargetMachine());
+  auto mod = buildModule(ctx, tm.get(), prog, resultType, opts);
+  std::string out;
+  llvm::raw_string_ostream os(out);
+  mod->print(os, nullptr);
+  return os.str();
+}
+
+void emitObjectFile(const IRProgram& prog, const TypePtr& resultType,
+                    const std::string& objPath, const LLVMOptions& opts) {
+  llvm::LLVMContext ctx;
+  std::unique_ptr<llvm::TargetMachine> tm(hostTargetMachine());
+  auto mod = buildModule(ctx, tm.get(), prog, resultType, opts);
+
+  std::error_code ec;
+  llvm::raw_fd_ostream dest(objPath, ec, llvm::sys::fs::OF_None);
+  if (ec) throw BackendError("cannot open " + objPath + ": " + ec.message());
+  llvm::legacy::PassManager pm;
+  if (tm->addPassesToEmitFile(pm, dest, nullptr, llvm::CGFT_ObjectFile))
+    throw BackendError("LLVM: the host target cannot emit object files");
+  pm.run(*mod);
+  dest.flush();
+}
+
+void buildNativeExecutable(const IRProgram& prog, const TypePtr& resultType,
+                           const std::string& exePath, const LLVMOptions& opts) {
+  std::string obj = exePath + ".o";
+  emitObjectFile(prog, resultType, obj, opts);
+  try {
+    linkWithRuntime({obj}, exePath);
+  } catch (...) {
+    std::remove(obj.c_str());
+    throw;
+  }
+  std::remove(obj.c_str());
+}
+
+} // namespace miniml
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include "../../ir/IR.hpp"
+#include "../../types/Type.hpp"
+#include "../Runtime.hpp"
+
+namespace miniml {
+
+    // Native code generation through LLVM (built only with -DENABLE_LLVM=ON).
+    //
+    // Values use the runtime's uniform word representation: Int and Bool are
+    // unboxed tagged words, tuples and closures are heap structs (closures
+    // carry a function pointer followed by their captures). Each IRFunc
+    // becomes one LLVM function 'i64 (i8* self, i64 arg)'. 'resultType' is the
+    // inferred type of the program and only drives printing of the result.
+    struct LLVMOptions {
+        bool optimize = true;   // run LLVM's -O2 module pipeline
+    };
+
+    // Textual LLVM IR for the program.
+    std::string emitLLVMIR(const IRProgram& prog, const TypePtr& resultType, const LLVMOptions& opts = {});
+
+    // Object file for the host target (defines mml_entry / mml_result_type).
+    void emitObjectFile(const IRProgram& prog, const TypePtr& resultType,
+                        const std::string& objPath, const LLVMOptions& opts = {});
+
+    // Object file + runtime linked into a standalone executable that prints the result.
+    void buildNativeExecutable(const IRProgram& prog, const TypePtr& resultType,
+                               const std::string& exePath, const LLVMOptions& opts = {});
+
+} // namespace miniml
@@ -0,0 +1,121 @@
+#include "Batch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace miniml {
+
+std::vector<std::string> readManifest(const std::string& manifest) {
+  std::ifstream in(manifest);
+  if (!in) throw std::runtime_error("Cannot open file: " + manifest);
+  auto dir = std::filesystem::path(manifest).parent_path();
+  std::vector<std::string> paths;
+  for (std::string line; std::getline(in, line);) {
+    auto first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#') continue;
+    line = line.substr(first, line.find_last_not_of(" \t\r") - first + 1);
+    std::filesystem::path p(line);
+    paths.push_back(p.is_relative() ? (dir / p).string() : line);
+  }
+  return paths;
+}
+
+static void runFile(const Pipeline& pipeline, BatchFile& f) {
+  auto start = std::chrono::steady_clock::now();
+  std::ifstream in(f.path);
+  if (in) {
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    f.result = pipeline.run(ss.str(), f.path, &f.phases);
+  } else {
+    f.result.status = RunResult::Status::ReadError;
+    f.result.error = "Cannot open file: " + f.path;
+  }
+  f.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<BatchFile> runBatch(const Pipeline& pipeline, const std::vector<std::string>& paths, unsigned jobs) {
+  if (jobs == 0) jobs = std::max(1u, std::thread::hardware_concurrency());
+  jobs = static_cast<unsigned>(std::min<std::size_t>(jobs, std::max<std::size_t>(1, paths.size())));
+  std::vector<BatchFile> files(paths.size());
+  for (std::size_t i = 0; i < paths.size(); ++i) files[i].path = paths[i];
+
+  std::atomic<std::size_t> next{0};
+  auto work = [&] {
+    for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < files.size();)
+      runFile(pipeline, files[i]);
+  };
+  std::vector<std::thread> workers;
+  for (unsigned j = 1; j < jobs; ++j) workers.emplace_back(work);
+  work();
+  for (auto& w : workers) w.join();
+  return files;
+}
+
+std::string batchOutput(const std::vector<BatchFile>& files) {
+  std::string out;
+  for (auto& f : files) {
+    const RunResult& r = f.result;
+    out += "== " + f.path + "\n";
+    for (auto& w : r.warnings) out += "warning: " + w + "\n";
+    switch (r.status) {
+      case RunResult::Status::Ok:
+        out += "OK: parsed + scope-checked " + f.path + "\nType: " + r.type + "\nValue: " + r.value + "\n";
+        break;
+      case RunResult::Status::TypeError: out += "Type error: " + r.error + "\n"; break;
+      case RunResult::Status::LimitError: out += "Limit exceeded: " + r.error + "\n"; break;
+      default: out += "ERROR: " + r.error + "\n"; break;
+    }
+  }
+  return out;
+}
+
+// Wall time of a top-level phase, 0 if it did not run.
+static double phaseMs(const PhaseTimer& t, const char* name) {
+  for (auto& p : t.phases())
+    if (p.depth == 0 && p.name == name) return p.wallMs;
+  return 0;
+}
+
+std::string batchSummary(const std::vector<BatchFile>& files, unsigned jobs, double wallMs) {
+  std::map<std::string, std::size_t> failures;
+  std::size_t ok = 0;
+  double fileMs = 0;
+  for (auto& f : files) {
+    if (f.result.status == RunResult::Status::Ok) ++ok;
+    else ++failures[statusName(f.result.status)];
+    fileMs += f.wallMs;
+  }
+  std::string out = "=== Batch ===\n";
+  char buf[256];
+  std::snprintf(buf, sizeof buf, "files: %zu, ok: %zu, failed: %zu", files.size(), ok, files.size() - ok);
+  out += buf;
+  if (!failures.empty()) {
+    out += " (";
+    bool first = true;
+    for (auto& [status, n] : failures) {
+      out += (first ? "" : ", ") + status + ": " + std::to_string(n);
+      first = false;
+    }
+    out += ")";
+  }
+  std::snprintf(buf, sizeof buf, "\njobs: %u, wall ms: %.3f, sum of file ms: %.3f\n", jobs, wallMs, fileMs);
+  out += buf;
+  out += "status          parse ms  scope ms  infer ms   eval ms  total ms  file\n";
+  for (auto& f : files) {
+    std::snprintf(buf, sizeof buf, "%-13s %10.3f %9.3f %9.3f %9.3f %9.3f  ", statusName(f.result.status),
+                  phaseMs(f.phases, "parse"), phaseMs(f.phases, "scope_check"), phaseMs(f.phases, "infer"),
+                  phaseMs(f.phases, "eval"), f.wallMs);
+    out += buf + f.path + "\n";
+  }
+  return out;
+}
+
+} // namespace miniml
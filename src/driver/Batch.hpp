@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Pipeline.hpp"
+#include "../utils/PhaseTimer.hpp"
+
+namespace miniml {
+
+    // One file of a batch: what the pipeline made of it and how long each
+    // phase took (wall time; CPU time and memory are per process, not per file).
+    struct BatchFile {
+        std::string path;
+        RunResult result;
+        PhaseTimer phases;
+        double wallMs = 0;   // reading the file included
+    };
+
+    // Paths listed in a manifest, one per line; blank lines and lines starting
+    // with '#' are skipped. Relative paths are relative to the manifest.
+    std::vector<std::string> readManifest(const std::string& manifest);
+
+    // Checks and evaluates every file with 'pipeline' on 'jobs' threads (0: one
+    // per hardware thread). Results are in the order of 'paths', whatever order
+    // the files finish in.
+    std::vector<BatchFile> runBatch(const Pipeline& pipeline, const std::vector<std::string>& paths,
+                                    unsigned jobs = 0);
+
+    // Output and diagnostics of each file, in order, as minimlc prints them for
+    // a single file.
+    std::string batchOutput(const std::vector<BatchFile>& files);
+
+    // Status counts, then one row per file with its phase timings.
+    std::string batchSummary(const std::vector<BatchFile>& files, unsigned jobs, double wallMs);
+
+} // namespace miniml
@@ -0,0 +1,376 @@
+#include "CompileCache.hpp"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef MINIML_VERSION
+#define MINIML_VERSION "dev"
+#endif
+
+namespace miniml {
+
+namespace {
+
+// Bump when a record layout or the meaning of a field changes.
+constexpr std::uint32_t kFormat = 1;
+constexpr std::uint32_t kMagic = 0x434c4d4d;   // "MMLC" when little-endian; other byte orders miss
+constexpr std::uint32_t kNone = 0xffffffffu;
+
+enum NodeKind : std::uint8_t { NVar, NInt, NBool, NTuple, NLam, NApp, NLet, NIf, NUnOp, NBinOp };
+
+struct Header {
+  std::uint32_t magic;
+  std::uint32_t format;
+  std::uint64_t key;
+  std::uint32_t nodes, children, types, typeChildren, notes, stringBytes;
+  std::uint32_t root, rootType;
+};
+
+// a, b, c: child node indices (always lower than the node's own, post order),
+// or for tuples the first entry in the child list and the element count.
+struct NodeRec {
+  std::int64_t value;
+  std::uint32_t line, col;
+  std::uint32_t str, strLen;
+  std::uint32_t a, b, c;
+  std::uint8_t kind, op;
+  std::uint8_t pad[2];
+};
+
+// FUN: a, b are type indices; TUPLE: a is the first entry in the type child list, b the count.
+struct TypeRec {
+  std::uint32_t kind;
+  std::int32_t var;
+  std::uint32_t a, b;
+};
+
+struct NoteRec {
+  std::uint32_t node, type;
+};
+
+static_assert(sizeof(Header) % 8 == 0 && sizeof(NodeRec) % 8 == 0 && sizeof(TypeRec) % 8 == 0 &&
+              sizeof(NoteRec) % 8 == 0, "records keep 8-byte alignment");
+
+class Writer {
+ public:
+  std::vector<NodeRec> nodes;
+  std::vector<std::uint32_t> children;
+  std::vector<TypeRec> types;
+  std::vector<std::uint32_t> typeChildren;
+  std::string strings;
+  std::unordered_map<const EBinOp*, std::uint32_t> binops;
+
+  std::uint32_t node(const Expr& e) {
+    NodeRec r{};
+    r.a = r.b = r.c = kNone;
+    std::visit([&](const auto& n) {
+      r.line = static_cast<std::uint32_t>(n.loc.line);
+      r.col = static_cast<std::uint32_t>(n.loc.col);
+    }, e);
+    if (auto n = std::get_if<EVar>(&e)) { r.kind = NVar; str(r, n->name); }
+    else if (auto n = std::get_if<ELitInt>(&e)) { r.kind = NInt; r.value = n->value; }
+    else if (auto n = std::get_if<ELitBool>(&e)) { r.kind = NBool; r.value = n->value; }
+    else if (auto n = std::get_if<ELitTuple>(&e)) {
+      std::vector<std::uint32_t> elems;
+      for (auto& el : n->elems) elems.push_back(node(*el));
+      r.kind = NTuple;
+      r.a = static_cast<std::uint32_t>(children.size());
+      r.b = static_cast<std::uint32_t>(elems.size());
+      children.insert(children.end(), elems.begin(), elems.end());
+    } else if (auto n = std::get_if<ELam>(&e)) { r.kind = NLam; str(r, n->param); r.a = node(*n->body); r.op = n->memo; }
+    else if (auto n = std::get_if<EApp>(&e)) { r.kind = NApp; r.a = node(*n->fn); r.b = node(*n->arg); }
+    else if (auto n = std::get_if<ELet>(&e)) {
+      r.kind = NLet;
+      str(r, n->name);
+      r.a = node(*n->rhs);
+      r.b = node(*n->body);
+    } else if (auto n = std::get_if<EIf>(&e)) {
+      r.kind = NIf;
+      r.a = node(*n->cond);
+      r.b = node(*n->thenE);
+      r.c = node(*n->elseE);
+    } else if (auto n = std::get_if<EUnOp>(&e)) {
+      r.kind = NUnOp;
+      r.op = static_cast<std::uint8_t>(n->op);
+      r.a = node(*n->expr);
+    } else if (auto n = std::get_if<EBinOp>(&e)) {
+      r.kind = NBinOp;
+      r.op = static_cast<std::uint8_t>(n->op);
+      r.a = node(*n->lhs);
+      r.b = node(*n->rhs);
+    }
+    nodes.push_back(r);
+    auto index = static_cast<std::uint32_t>(nodes.size() - 1);
+    if (auto n = std::get_if<EBinOp>(&e)) binops[n] = index;
+    return index;
+  }
+
+  std::uint32_t type(const TypePtr& t) {
+    if (auto it = typeIndex_.find(t.get()); it != typeIndex_.end()) return it->second;
+    TypeRec r{static_cast<std::uint32_t>(t->k), -1, kNone, kNone};
+    switch (t->k) {
+      case TKind::INT:
+      case TKind::BOOL:
+        break;
+      case TKind::VAR:
+        r.var = t->v.id;
+        break;
+      case TKind::FUN:
+        r.a = type(t->f.a);
+        r.b = type(t->f.b);
+        break;
+      case TKind::TUPLE: {
+        std::vector<std::uint32_t> elems;
+        for (auto& e : t->tupleElems) elems.push_back(type(e));
+        r.a = static_cast<std::uint32_t>(typeChildren.size());
+        r.b = static_cast<std::uint32_t>(elems.size());
+        typeChildren.insert(typeChildren.end(), elems.begin(), elems.end());
+        break;
+      }
+    }
+    types.push_back(r);
+    auto index = static_cast<std::uint32_t>(types.size() - 1);
+    typeIndex_[t.get()] = index;
+    return index;
+  }
+
+ private:
+  std::unordered_map<const Type*, std::uint32_t> typeIndex_;
+
+  void str(NodeRec& r, const std::string& s) {
+    r.str = static_cast<std::uint32_t>(strings.size());
+    r.strLen = static_cast<std::uint32_t>(s.size());
+    strings += s;
+  }
+};
+
+template <class T>
+void append(std::string& out, const std::vector<T>& v) {
+  out.append(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+}
+
+// Bounds-checked view of the arrays following a Header.
+struct Reader {
+  const char* base;
+  std::size_t size, pos;
+
+  template <class T>
+  const T* take(std::size_t count) {
+    if (count > (size - pos) / sizeof(T)) return nullptr;
+    auto p = reinterpret_cast<const T*>(base + pos);
+    pos += count * sizeof(T);
+    return p;
+  }
+};
+
+} // namespace
+
+std::uint64_t compileCacheKey(const std::string& source, const std::string& filename) {
+  std::uint64_t h = 0xcbf29ce484222325ULL;
+  auto mix = [&](const void* data, std::size_t n) {
+    auto p = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < n; ++i) h = (h ^ p[i]) * 0x100000001b3ULL;
+  };
+  mix(MINIML_VERSION, sizeof MINIML_VERSION);
+  mix(&kFormat, sizeof kFormat);
+  mix(filename.c_str(), filename.size() + 1);
+  mix(source.data(), source.size());
+  return h;
+}
+
+std::string serializeProgram(const CheckedProgram& p, std::uint64_t key) {
+  Writer w;
+  std::uint32_t root = w.node(*p.ast);
+  std::uint32_t rootType = w.type(p.type);
+  std::vector<NoteRec> notes;
+  for (auto& [binop, t] : p.notes.eqOperands) {
+    auto it = w.binops.find(binop);
+    if (it != w.binops.end()) notes.push_back(NoteRec{it->second, w.type(t)});
+  }
+
+  Header h{kMagic, kFormat, key,
+           static_cast<std::uint32_t>(w.nodes.size()), static_cast<std::uint32_t>(w.children.size()),
+           static_cast<std::uint32_t>(w.types.size()), static_cast<std::uint32_t>(w.typeChildren.size()),
+           static_cast<std::uint32_t>(notes.size()), static_cast<std::uint32_t>(w.strings.size()),
+           root, rootType};
+  std::string out(reinterpret_cast<const char*>(&h), sizeof h);
+  append(out, w.nodes);
+  append(out, w.types);
+  append(out, notes);
+  append(out, w.children);
+  append(out, w.typeChildren);
+  out += w.strings;
+  return out;
+}
+
+std::optional<CheckedProgram> deserializeProgram(const void* data, std::size_t size, std::uint64_t key,
+                                                 const std::string& filename) {
+  Reader rd{static_cast<const char*>(data), size, 0};
+  auto h = rd.take<Header>(1);
+  if (!h || h->magic != kMagic || h->format != kFormat || h->key != key) return std::nullopt;
+  auto nodeRecs = rd.take<NodeRec>(h->nodes);
+  auto typeRecs = rd.take<TypeRec>(h->types);
+  auto noteRecs = rd.take<NoteRec>(h->notes);
+  auto children = rd.take<std::uint32_t>(h->children);
+  auto typeChildren = rd.take<std::uint32_t>(h->typeChildren);
+  auto strings = rd.take<char>(h->stringBytes);
+  if (!nodeRecs || !typeRecs || !noteRecs || !children || !typeChildren || !strings) return std::nullopt;
+  if (h->root >= h->nodes || h->rootType >= h->types) return std::nullopt;
+
+  // every reference must point backwards, so one forward pass builds the graph
+  std::vector<TypePtr> types(h->types);
+  auto typeAt = [&](std::uint32_t i, std::uint32_t self) -> const TypePtr* {
+    return i < self ? &types[i] : nullptr;
+  };
+  for (std::uint32_t i = 0; i < h->types; ++i) {
+    const TypeRec& r = typeRecs[i];
+    switch (static_cast<TKind>(r.kind)) {
+      case TKind::INT: types[i] = Type::tInt(); break;
+      case TKind::BOOL: types[i] = Type::tBool(); break;
+      case TKind::VAR: types[i] = Type::tVar(r.var); break;
+      case TKind::FUN: {
+        auto a = typeAt(r.a, i), b = typeAt(r.b, i);
+        if (!a || !b) return std::nullopt;
+        types[i] = Type::tFun(*a, *b);
+        break;
+      }
+      case TKind::TUPLE: {
+        if (r.a > h->typeChildren || r.b > h->typeChildren - r.a) return std::nullopt;
+        std::vector<TypePtr> elems;
+        for (std::uint32_t k = 0; k < r.b; ++k) {
+          auto e = typeAt(typeChildren[r.a + k], i);
+          if (!e) return std::nullopt;
+          elems.push_back(*e);
+        }
+        types[i] = Type::tTuple(std::move(elems));
+        break;
+      }
+      default:
+        return std::nullopt;
+    }
+  }
+
+  std::vector<ExprPtr> nodes(h->nodes);
+  bool ok = true;
+  auto child = [&](std::uint32_t i, std::uint32_t self) -> ExprPtr {
+    if (i >= self) {
+      ok = false;
+      return nullptr;
+    }
+    return nodes[i];
+  };
+  for (std::uint32_t i = 0; i < h->nodes && ok; ++i) {
+    const NodeRec& r = nodeRecs[i];
+    SrcLoc loc{filename, static_cast<int>(r.line), static_cast<int>(r.col)};
+    if (r.str > h->stringBytes || r.strLen > h->stringBytes - r.str) return std::nullopt;
+    std::string s(strings + r.str, r.strLen);
+    switch (r.kind) {
+      case NVar: nodes[i] = var(std::move(s), loc); break;
+      case NInt: nodes[i] = lit_int(r.value, loc); break;
+      case NBool: nodes[i] = lit_bool(r.value != 0, loc); break;
+      case NTuple: {
+        if (r.a > h->children || r.b > h->children - r.a) return std::nullopt;
+        std::vector<ExprPtr> elems;
+        for (std::uint32_t k = 0; k < r.b; ++k) elems.push_back(child(children[r.a + k], i));
+        nodes[i] = lit_tuple(std::move(elems), loc);
+        break;
+      }
+      case NLam:
+        nodes[i] = lam(std::move(s), child(r.a, i), loc);
+        std::get<ELam>(*nodes[i]).memo = r.op != 0;
+        break;
+      case NApp: nodes[i] = app(child(r.a, i), child(r.b, i), loc); break;
+      case NLet: nodes[i] = let_(std::move(s), child(r.a, i), child(r.b, i), loc); break;
+      case NIf: nodes[i] = if_(child(r.a, i), child(r.b, i), child(r.c, i), loc); break;
+      case NUnOp:
+        if (r.op != static_cast<std::uint8_t>(UnOp::Not)) return std::nullopt;
+        nodes[i] = unop(UnOp::Not, child(r.a, i), loc);
+        break;
+      case NBinOp:
+        if (r.op > static_cast<std::uint8_t>(BinOp::Or)) return std::nullopt;
+        nodes[i] = binop(static_cast<BinOp>(r.op), child(r.a, i), child(r.b, i), loc);
+        break;
+      default:
+        return std::nullopt;
+    }
+  }
+  if (!ok) return std::nullopt;
+
+  CheckedProgram p;
+  p.ast = nodes[h->root];
+  p.type = types[h->rootType];
+  for (std::uint32_t i = 0; i < h->notes; ++i) {
+    const NoteRec& n = noteRecs[i];
+    if (n.node >= h->nodes || n.type >= h->types) return std::nullopt;
+    auto binop = std::get_if<EBinOp>(nodes[n.node].get());
+    if (!binop) return std::nullopt;
+    p.notes.eqOperands[binop] = types[n.type];
+  }
+  return p;
+}
+
+std::string CompileCache::pathFor(std::uint64_t key) const {
+  char name[32];
+  std::snprintf(name, sizeof name, "%016llx.mmlc", static_cast<unsigned long long>(key));
+  return (std::filesystem::path(dir_) / name).string();
+}
+
+std::optional<CheckedProgram> CompileCache::load(const std::string& source, const std::string& filename) const {
+  auto key = compileCacheKey(source, filename);
+  auto path = pathFor(key);
+#if defined(__unix__) || defined(__APPLE__)
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return std::nullopt;
+  struct stat st{};
+  if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    return std::nullopt;
+  }
+  auto size = static_cast<std::size_t>(st.st_size);
+  void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) return std::nullopt;
+  auto p = deserializeProgram(map, size, key, filename);
+  ::munmap(map, size);
+  return p;
+#else
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return std::nullopt;
+  std::ostringstream ss;
+  ss << in.rdbuf();
+  auto bytes = ss.str();
+  return deserializeProgram(bytes.data(), bytes.size(), key, filename);
+#endif
+}
+
+void CompileCache::store(const std::string& source, const std::string& filename, const CheckedProgram& p) const {
+  auto key = compileCacheKey(source, filename);
+  auto path = pathFor(key);
+  std::filesystem::create_directories(dir_);
+#if defined(__unix__) || defined(__APPLE__)
+  auto tmp = path + ".tmp" + std::to_string(::getpid());
+#else
+  auto tmp = path + ".tmp";
+#endif
+  {
+    std::ofstream out(tmp, std::ios::binary);
+    if (!out) throw std::runtime_error("Cannot write file: " + tmp);
+    auto bytes = serializeProgram(p, key);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    if (!out) throw std::runtime_error("Cannot write file: " + tmp);
+  }
+  std::filesystem::rename(tmp, path);
+}
+
+} // namespace miniml
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include "../ast/Nodes.hpp"
+#include "../types/Infer.hpp"
+
+namespace miniml {
+
+    // What parse + scope check + inference produce for one source file.
+    struct CheckedProgram {
+        ExprPtr ast;
+        TypePtr type;            // final substitution applied
+        TypeAnnotations notes;   // for the code generators
+    };
+
+    // 64-bit FNV-1a of the compiler version, cache format, file name and source.
+    std::uint64_t compileCacheKey(const std::string& source, const std::string& filename);
+
+    // Binary form of a CheckedProgram: a header followed by flat arrays of
+    // fixed-size records (AST nodes in post order, type nodes, annotations) and
+    // a string table. There are no pointers, so a file can be used straight
+    // from a read-only mapping. Shared type subterms stay shared.
+    std::string serializeProgram(const CheckedProgram& p, std::uint64_t key);
+
+    // Rebuilds the program from 'size' bytes at 'data'; nullopt if the data is
+    // truncated, corrupt, or written for another key or cache format. Source
+    // locations get 'filename'.
+    std::optional<CheckedProgram> deserializeProgram(const void* data, std::size_t size, std::uint64_t key,
+                                                     const std::string& filename);
+
+    // minimlc --cache-dir: one file per program, named after its key. Warm
+    // loads map the file and skip the parser and inference.
+    class CompileCache {
+    public:
+        explicit CompileCache(std::string dir) : dir_(std::move(dir)) {}
+
+        std::optional<CheckedProgram> load(const std::string& source, const std::string& filename) const;
+
+        // Written to a temporary file and renamed, so readers never see half a file.
+        void store(const std::string& source, const std::string& filename, const CheckedProgram& p) const;
+
+        std::string pathFor(std::uint64_t key) const;
+
+    private:
+        std::string dir_;
+    };
+
+} // namespace miniml
@@ -0,0 +1,153 @@
+#include "Engine.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "CompileCache.hpp"
+#include "../parser/parse_to_ast.hpp"
+#include "../semantic/Escape.hpp"
+#include "../semantic/LastUse.hpp"
+#include "../semantic/ScopeCheck.hpp"
+#include "../evaluator/Eval.hpp"
+#include "../evaluator/Limits.hpp"
+#include "../types/Infer.hpp"
+#include "../types/Pretty.hpp"
+
+namespace miniml {
+
+// Name the script's value is bound to while an input is applied; no Mini-ML
+// identifier can spell it.
+static const char* const kScript = "%script";
+
+static CheckedProgram check(const std::string& code, const std::string& filename) {
+  CheckedProgram p;
+  p.ast = parse_to_ast(code, filename);
+  ScopeChecker checker;
+  checker.check(p.ast);
+  auto r = infer(p.ast, TypeEnv{}, p.notes);
+  p.type = apply_type(r.subst, r.type);
+  return p;
+}
+
+Engine::Engine(const std::string& script, const std::string& filename, RunOptions opts)
+    : filename_(filename), opts_(opts), key_(compileCacheKey(script, filename)) {
+  auto p = check(script, filename);
+  if (p.type->k != TKind::FUN)
+    throw TypeError(filename + ": engine script must be a function, not " + showTypeCanonical(p.type));
+  type_ = showTypeCanonical(p.type);
+  image_ = serializeProgram(p, key_);
+}
+
+// ------- Worker -------
+
+struct Engine::Worker::State {
+  ExprPtr ast;
+  TypePtr param, result;
+  Ref<EnvV> env;   // the prelude, then the script's value
+  RunResult failed;            // the script's own evaluation failed
+};
+
+static bool limited(const RunOptions& o) {
+  return o.fuel || o.timeout.count() > 0 || o.maxHeapBytes || o.maxDepth;
+}
+
+// Evaluates 'e' under the run options; on failure fills 'r' and returns false.
+static bool evaluate(const ExprPtr& e, const Ref<EnvV>& env, const RunOptions& opts, Val& out,
+                     RunResult& r) {
+  EvalLimits limits;
+  limits.fuel = opts.fuel;
+  limits.maxHeapBytes = opts.maxHeapBytes;
+  limits.maxDepth = opts.maxDepth;
+  if (opts.timeout.count() > 0) limits.setTimeout(opts.timeout);
+  EvalContext ctx;
+  if (limited(opts)) ctx.limits = &limits;
+  ctx.cancel = opts.cancel;
+  try {
+    out = eval(e, env, ctx);
+    return true;
+  } catch (const EvalLimitError& e) {
+    r.status = RunResult::Status::LimitError;
+    r.error = e.what();
+  } catch (const std::runtime_error& e) {
+    r.status = RunResult::Status::RuntimeError;
+    r.error = e.what();
+  }
+  return false;
+}
+
+Engine::Worker::Worker(const Engine& engine) : engine_(engine), s_(std::make_unique<State>()) {
+  auto p = deserializeProgram(engine.image_.data(), engine.image_.size(), engine.key_, engine.filename_);
+  s_->ast = p->ast;
+  s_->param = p->type->f.a;
+  s_->result = p->type->f.b;
+  analyzeEscapes(s_->ast);
+  analyzeLastUses(s_->ast);
+
+  auto env = prelude();
+  Val fn;
+  if (!evaluate(s_->ast, env, engine.opts_, fn, s_->failed)) return;
+  s_->env = newCell<EnvV>();
+  s_->env->name = kScript;
+  s_->env->value = std::move(fn);
+  s_->env->parent = std::move(env);
+}
+
+Engine::Worker::~Worker() = default;
+
+RunResult Engine::Worker::run(const std::string& input, const std::string& filename) {
+  if (!s_->env) return s_->failed;
+  RunResult r;
+  auto fail = [&](RunResult::Status s, const std::exception& e) {
+    r.status = s;
+    r.error = e.what();
+    return r;
+  };
+
+  ExprPtr arg;
+  try {
+    arg = parse_to_ast(input, filename);
+  } catch (const ParseError& e) {
+    return fail(RunResult::Status::ParseError, e);
+  }
+  try {
+    ScopeChecker checker;
+    checker.check(arg);
+  } catch (const ScopeError& e) {
+    return fail(RunResult::Status::ScopeError, e);
+  }
+  const SrcLoc& where = std::visit([](const auto& n) -> const SrcLoc& { return n.loc; }, *arg);
+  try {
+    auto a = infer(arg, TypeEnv{});
+    auto s = unify(s_->param, apply_type(a.subst, a.type), where);
+    r.type = showTypeCanonical(apply_type(s, s_->result));
+  } catch (const TypeError& e) {
+    return fail(RunResult::Status::TypeError, e);
+  }
+
+  analyzeEscapes(arg);
+  analyzeLastUses(arg);
+  Val v;
+  if (!evaluate(app(var(kScript, where), arg, where), s_->env, engine_.opts_, v, r)) return r;
+  r.value = showVal(v);
+  return r;
+}
+
+// ------- Engine -------
+
+std::vector<RunResult> Engine::runAll(const std::vector<std::string>& inputs, unsigned threads) const {
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  if (threads > inputs.size()) threads = static_cast<unsigned>(std::max<std::size_t>(1, inputs.size()));
+  std::vector<RunResult> results(inputs.size());
+  std::atomic<std::size_t> next{0};
+  auto work = [&] {
+    Worker w(*this);
+    for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < inputs.size();)
+      results[i] = w.run(inputs[i]);
+  };
+  std::vector<std::thread> pool;
+  for (unsigned t = 1; t < threads; ++t) pool.emplace_back(work);
+  work();
+  for (auto& t : pool) t.join();
+  return results;
+}
+
+} // namespace miniml
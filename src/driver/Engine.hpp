@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Pipeline.hpp"
+#include "../types/Type.hpp"
+
+namespace miniml {
+
+    // Runs one script on many inputs from many threads at once. The script is
+    // parsed, scope checked and type checked once; the engine then keeps only
+    // its serialized form (serializeProgram), which is never written again.
+    //
+    // Threads share nothing else. Each Worker rebuilds its own AST, types and
+    // prelude from that image and evaluates the script once, so the closures,
+    // environments and tuples of a run, and every reference count they touch,
+    // belong to one thread.
+    //
+    // The script must evaluate to a function. An input is the source of a
+    // closed Mini-ML expression; it is type checked against the parameter
+    // type and passed as the argument.
+    class Engine {
+    public:
+        // Throws ParseError, ScopeError or TypeError (also for a script that is not a function).
+        explicit Engine(const std::string& script, const std::string& filename = "<script>", RunOptions opts = {});
+
+        // Evaluation state of one thread; not thread-safe itself.
+        class Worker {
+        public:
+            explicit Worker(const Engine& engine);
+            ~Worker();
+            Worker(const Worker&) = delete;
+            Worker& operator=(const Worker&) = delete;
+
+            // 'type' is the type of the result for this input.
+            RunResult run(const std::string& input, const std::string& filename = "<input>");
+
+        private:
+            struct State;
+            const Engine& engine_;
+            std::unique_ptr<State> s_;
+        };
+
+        // Type of the script.
+        const std::string& type() const { return type_; }
+
+        // Runs every input on 'threads' workers (0: one per hardware thread);
+        // results come back in input order.
+        std::vector<RunResult> runAll(const std::vector<std::string>& inputs, unsigned threads = 0) const;
+
+    private:
+        std::string filename_;
+        RunOptions opts_;
+        std::uint64_t key_;
+        std::string image_;
+        std::string type_;
+    };
+
+} // namespace miniml
@@ -0,0 +1,752 @@
+#include "Incremental.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "../parser/parse_to_ast.hpp"
+#include "../semantic/ScopeCheck.hpp"
+#include "../types/Infer.hpp"
+#include "../types/Pretty.hpp"
+
+namespace miniml {
+
+namespace {
+
+constexpr std::size_t kMemoMinSize = 4;       // smaller subtrees are cheaper to infer than to look up
+constexpr std::uint64_t kMemoMaxType = 512;   // environments with larger types (as trees) are not cached
+constexpr std::uint64_t kMemoKeep = 64;       // updates an unused cache entry survives
+constexpr std::uint64_t kSweepEvery = 16;
+
+// ---------- Trees ----------
+
+// Children of 'e', in source order.
+std::vector<ExprPtr*> children(Expr& e) {
+  return std::visit([](auto& n) -> std::vector<ExprPtr*> {
+    using T = std::decay_t<decltype(n)>;
+    if constexpr (std::is_same_v<T, ELam>) return {&n.body};
+    else if constexpr (std::is_same_v<T, EApp>) return {&n.fn, &n.arg};
+    else if constexpr (std::is_same_v<T, ELet>) return {&n.rhs, &n.body};
+    else if constexpr (std::is_same_v<T, EIf>) return {&n.cond, &n.thenE, &n.elseE};
+    else if constexpr (std::is_same_v<T, EUnOp>) return {&n.expr};
+    else if constexpr (std::is_same_v<T, EBinOp>) return {&n.lhs, &n.rhs};
+    else if constexpr (std::is_same_v<T, ELitTuple>) {
+      std::vector<ExprPtr*> out;
+      for (auto& x : n.elems) out.push_back(&x);
+      return out;
+    } else {
+      return {};
+    }
+  }, e);
+}
+
+std::vector<ExprPtr*> children(const Expr& e) { return children(const_cast<Expr&>(e)); }
+
+SrcLoc& locOf(Expr& e) {
+  return std::visit([](auto& n) -> SrcLoc& { return n.loc; }, e);
+}
+
+std::uint64_t mix(std::uint64_t h, std::uint64_t v) {
+  return h ^ (v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+}
+
+// Hash of what the node itself says, without its children or location.
+std::uint64_t ownHash(const Expr& e) {
+  std::uint64_t h = e.index() + 1;
+  std::hash<std::string> str;
+  std::visit([&](const auto& n) {
+    using T = std::decay_t<decltype(n)>;
+    if constexpr (std::is_same_v<T, EVar>) h = mix(h, str(n.name));
+    else if constexpr (std::is_same_v<T, ELitInt>) h = mix(h, static_cast<std::uint64_t>(n.value));
+    else if constexpr (std::is_same_v<T, ELitBool>) h = mix(h, n.value);
+    else if constexpr (std::is_same_v<T, ELitTuple>) h = mix(h, n.elems.size());
+    else if constexpr (std::is_same_v<T, ELam>) h = mix(h, str(n.param));
+    else if constexpr (std::is_same_v<T, ELet>) h = mix(h, str(n.name));
+    else if constexpr (std::is_same_v<T, EUnOp> || std::is_same_v<T, EBinOp>)
+      h = mix(h, static_cast<std::uint64_t>(n.op));
+  }, e);
+  return h;
+}
+
+bool sameNode(const Expr& a, const Expr& b) {
+  if (a.index() != b.index()) return false;
+  return std::visit([&](const auto& n) {
+    using T = std::decay_t<decltype(n)>;
+    const T& m = std::get<T>(b);
+    if constexpr (std::is_same_v<T, EVar>) return n.name == m.name;
+    else if constexpr (std::is_same_v<T, ELitInt> || std::is_same_v<T, ELitBool>) return n.value == m.value;
+    else if constexpr (std::is_same_v<T, ELitTuple>) return n.elems.size() == m.elems.size();
+    else if constexpr (std::is_same_v<T, ELam>) return n.param == m.param;
+    else if constexpr (std::is_same_v<T, ELet>) return n.name == m.name;
+    else if constexpr (std::is_same_v<T, EUnOp> || std::is_same_v<T, EBinOp>) return n.op == m.op;
+    else return true;
+  }, a);
+}
+
+// Same tree, locations aside.
+bool sameShape(const Expr& a, const Expr& b) {
+  if (&a == &b) return true;
+  if (!sameNode(a, b)) return false;
+  auto ka = children(a), kb = children(b);
+  for (std::size_t i = 0; i < ka.size(); ++i)
+    if (!sameShape(**ka[i], **kb[i])) return false;
+  return true;
+}
+
+// ---------- Text ----------
+
+bool isIdentChar(char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+
+// First offset at or after 'i' outside whitespace and comments.
+std::size_t skipTrivia(const std::string& s, std::size_t i) {
+  for (;;) {
+    while (i < s.size() && std::isspace(static_cast<unsigned char>(s[i]))) ++i;
+    if (i + 1 >= s.size() || s[i] != '(' || s[i + 1] != '*') return i;
+    auto close = s.find("*)", i + 2);
+    if (close == std::string::npos) return s.size();
+    i = close + 2;
+  }
+}
+
+// Location reached from 'p' (the location of s[from]) at s[to]. Columns count
+// code points, as the lexer does.
+SrcLoc advance(SrcLoc p, const std::string& s, std::size_t from, std::size_t to) {
+  for (auto i = from; i < to; ++i) {
+    if (s[i] == '\n') {
+      ++p.line;
+      p.col = 1;
+    } else if ((static_cast<unsigned char>(s[i]) & 0xC0) != 0x80) {
+      ++p.col;
+    }
+  }
+  return p;
+}
+
+// ---------- Node table ----------
+
+struct NodeInfo {
+  ExprPtr node;
+  std::uint64_t hash = 0;       // of the subtree, locations aside
+  std::size_t size = 1;         // nodes in the subtree
+  std::size_t off = 0;          // start of its text, from the start of its parent's (the root's: absolute)
+  std::size_t len = 0;          // its text runs from its first token to its last
+  std::uint64_t gen = 0;        // update that built the node
+  std::optional<std::vector<std::string>> free;   // free variables, sorted; on demand
+};
+
+using NodeTable = std::unordered_map<const Expr*, NodeInfo>;
+
+// Records a freshly parsed tree in the node table. A node's text starts at its
+// location and ends with its last child, or token, followed by the ')' that
+// close the parentheses opened between its tokens. ok() is false if the
+// locations do not match the text; every node is recorded anyway.
+class Indexer {
+public:
+  Indexer(const std::string& text, NodeTable& table, std::uint64_t gen)
+      : text_(text), table_(table), gen_(gen) {
+    lines_.push_back(0);
+    ascii_.push_back(true);
+    for (std::size_t i = 0; i < text.size(); ++i) {
+      if (text[i] == '\n') {
+        lines_.push_back(i + 1);
+        ascii_.push_back(true);
+      } else if (static_cast<unsigned char>(text[i]) >= 0x80) {
+        ascii_.back() = false;
+      }
+    }
+  }
+
+  // Records 'e' and its subtree, the text of its parent starting at
+  // 'parentStart'. Returns the end of its text.
+  std::size_t index(const ExprPtr& e, std::size_t parentStart) {
+    const Expr& node = *e;
+    NodeInfo info;
+    info.node = e;
+    info.gen = gen_;
+    info.hash = ownHash(node);
+
+    auto start = offsetOf(std::visit([](const auto& n) { return n.loc; }, node));
+    if (!start || *start < parentStart) {
+      ok_ = false;
+      start = parentStart;
+    }
+    std::size_t pos = *start;
+    auto expect = [&](const std::string& token) {
+      if (text_.compare(pos, token.size(), token) != 0) ok_ = false;
+    };
+    std::visit([&](const auto& n) {
+      using T = std::decay_t<decltype(n)>;
+      if constexpr (std::is_same_v<T, EVar>) {
+        expect(n.name);
+        pos += n.name.size();
+      } else if constexpr (std::is_same_v<T, ELitInt>) {
+        while (pos < text_.size() && std::isdigit(static_cast<unsigned char>(text_[pos]))) ++pos;
+        if (pos == *start) ok_ = false;
+      } else if constexpr (std::is_same_v<T, ELitBool>) {
+        expect(n.value ? "true" : "false");
+        pos += n.value ? 4 : 5;
+      } else if constexpr (std::is_same_v<T, ELet>) {
+        expect("let");
+      } else if constexpr (std::is_same_v<T, ELam>) {
+        expect(n.memo ? "[@memo]" : "\\");
+      } else if constexpr (std::is_same_v<T, EIf>) {
+        expect("if");
+      } else if constexpr (std::is_same_v<T, EUnOp>) {
+        expect("not");
+      } else if constexpr (std::is_same_v<T, ELitTuple>) {
+        expect("(");
+      }
+    }, node);
+
+    int open = 0;
+    for (auto* c : children(node)) {
+      auto end = index(*c, *start);
+      auto& child = table_.at(c->get());
+      auto childStart = *start + child.off;
+      if (childStart < pos) ok_ = false;
+      for (auto i = pos; i < childStart; ++i) {   // tokens between the children
+        if (text_[i] == '(' && i + 1 < childStart && text_[i + 1] == '*') {
+          auto close = text_.find("*)", i + 2);
+          if (close == std::string::npos || close + 2 > childStart) ok_ = false;
+          else i = close + 1;
+        } else if (text_[i] == '(') {
+          ++open;
+        } else if (text_[i] == ')' && --open < 0) {
+          ok_ = false;
+        }
+      }
+      pos = std::max(pos, end);
+      info.size += child.size;
+      info.hash = mix(info.hash, child.hash);
+    }
+    for (; open > 0; --open) {
+      pos = skipTrivia(text_, pos);
+      if (pos >= text_.size() || text_[pos] != ')') {
+        ok_ = false;
+        break;
+      }
+      ++pos;
+    }
+    pos = std::min(pos, text_.size());
+
+    info.off = *start - parentStart;
+    info.len = pos - *start;
+    table_[e.get()] = std::move(info);
+    ++nodes_;
+    return pos;
+  }
+
+  bool ok() const { return ok_; }
+  std::size_t nodes() const { return nodes_; }
+
+private:
+  std::optional<std::size_t> offsetOf(const SrcLoc& l) const {
+    if (l.line < 1 || static_cast<std::size_t>(l.line) > lines_.size() || l.col < 1) return std::nullopt;
+    std::size_t begin = lines_[l.line - 1];
+    std::size_t end = static_cast<std::size_t>(l.line) < lines_.size() ? lines_[l.line] : text_.size();
+    if (ascii_[l.line - 1]) {
+      std::size_t at = begin + (l.col - 1);
+      if (at > end) return std::nullopt;
+      return at;
+    }
+    std::size_t at = begin;
+    for (int col = 1; col < l.col; ++col) {
+      if (at >= end) return std::nullopt;
+      ++at;
+      while (at < end && (static_cast<unsigned char>(text_[at]) & 0xC0) == 0x80) ++at;
+    }
+    return at;
+  }
+
+  const std::string& text_;
+  NodeTable& table_;
+  std::uint64_t gen_;
+  std::vector<std::size_t> lines_;   // offset of each line
+  std::vector<bool> ascii_;          // columns of the line are byte offsets
+  bool ok_ = true;
+  std::size_t nodes_ = 0;
+};
+
+// The i-th child of 'e' is followed by a token that ends any expression ('in',
+// 'then', 'else', ',' or ')'), or is the last child of a let, lambda or if
+// and followed by what follows 'e'.
+bool delimitedChild(const Expr& e, std::size_t i, bool delimited) {
+  if (std::holds_alternative<ELet>(e)) return i == 0 || delimited;
+  if (std::holds_alternative<ELam>(e)) return delimited;
+  if (std::holds_alternative<EIf>(e)) return i < 2 || delimited;
+  return std::holds_alternative<ELitTuple>(e);
+}
+
+// Canonical numbering of type variables, for the memo.
+template <class Fresh>
+TypePtr renumber(const TypePtr& t, std::unordered_map<int, int>& ids, Fresh& fresh,
+                 std::unordered_map<const Type*, TypePtr>& done) {
+  if (auto it = done.find(t.get()); it != done.end()) return it->second;
+  TypePtr r;
+  switch (t->k) {
+    case TKind::INT:
+    case TKind::BOOL:
+      return t;
+    case TKind::VAR: {
+      auto [it, added] = ids.try_emplace(t->v.id, 0);
+      if (added) it->second = fresh();
+      r = Type::tVar(it->second);
+      break;
+    }
+    case TKind::FUN:
+      r = Type::tFun(renumber(t->f.a, ids, fresh, done), renumber(t->f.b, ids, fresh, done));
+      break;
+    case TKind::TUPLE: {
+      std::vector<TypePtr> elems;
+      for (auto& x : t->tupleElems) elems.push_back(renumber(x, ids, fresh, done));
+      r = Type::tTuple(std::move(elems));
+      break;
+    }
+  }
+  done.emplace(t.get(), r);
+  return r;
+}
+
+} // namespace
+
+// ---------- State ----------
+
+struct IncrementalAnalyzer::State final : InferMemo {
+  std::string filename;
+  std::string source;
+  ExprPtr root;              // null while the source does not parse
+  bool indexed = false;      // the text spans in 'nodes' are right: edits can be reparsed locally
+  NodeTable nodes;
+  std::uint64_t gen = 0;
+  IncrementalStats stats;
+  std::unordered_map<std::string, int> bound;   // names in scope, during the scope check
+
+  // Inference results by structural hash of the subtree. Type variable k of
+  // 'env' is variable k of the result, so a hit maps them back to the
+  // variables of the environment it is used in; the other variables of a
+  // result are made fresh.
+  struct Entry {
+    ExprPtr node;                      // compared with on a hash match
+    std::string env;                   // types of the free variables of 'node'
+    std::vector<TypePtr> envImages;    // what the substitution maps each environment variable to
+    TypePtr type;
+    std::uint64_t lastUse = 0;
+  };
+  std::unordered_map<std::uint64_t, std::vector<Entry>> memo;
+
+  struct Fingerprint {
+    std::string key;
+    std::vector<int> vars;   // type variables free in the environment, in canonical order
+  };
+
+  struct Step {
+    ExprPtr node;
+    std::size_t start;   // absolute
+    std::size_t slot;    // index among the children of the previous step
+  };
+
+  RunResult fail(RunResult::Status status, const std::exception& e) {
+    RunResult r;
+    r.status = status;
+    r.error = e.what();
+    return r;
+  }
+
+  RunResult fullParse() {
+    stats.fullParse = true;
+    stats.reparsedBytes = source.size();
+    nodes.clear();
+    root = nullptr;
+    indexed = false;
+    try {
+      root = parse_to_ast(source, filename);
+    } catch (const ParseError& e) {
+      return fail(RunResult::Status::ParseError, e);
+    }
+    Indexer ix(source, nodes, gen);
+    ix.index(root, 0);
+    indexed = ix.ok();
+    stats.reparsedNodes = ix.nodes();
+    return check();
+  }
+
+  // Path from the root to the smallest subtree that contains [from, to] and
+  // whose text parses on its own; empty if there is none.
+  std::vector<Step> enclosing(std::size_t from, std::size_t to) const {
+    const auto& top = nodes.at(root.get());
+    if (from < top.off || to > top.off + top.len) return {};
+    std::vector<Step> path{{root, top.off, 0}};
+    std::size_t keep = 1;
+    bool delimited = true;
+    for (;;) {
+      auto kids = children(*path.back().node);
+      std::size_t i = 0, start = 0, end = 0;
+      for (; i < kids.size(); ++i) {
+        const auto& k = nodes.at(kids[i]->get());
+        start = path.back().start + k.off;
+        end = start + k.len;
+        if (start <= from && to <= end) break;
+      }
+      if (i == kids.size()) break;
+      delimited = delimitedChild(*path.back().node, i, delimited) || parenthesized(start, end);
+      path.push_back({*kids[i], start, i});
+      if (delimited) keep = path.size();
+    }
+    path.resize(keep);
+    return path;
+  }
+
+  bool parenthesized(std::size_t start, std::size_t end) const {
+    auto before = start;
+    while (before > 0 && std::isspace(static_cast<unsigned char>(source[before - 1]))) --before;
+    if (before == 0 || source[before - 1] != '(') return false;
+    auto after = skipTrivia(source, end);
+    return after < source.size() && source[after] == ')';
+  }
+
+  // Applies 'e' to the source, and to the tree by reparsing the smallest
+  // subtree around it whose text parses on its own. False if the tree could
+  // not be updated that way.
+  bool reparse(const TextEdit& e) {
+    auto apply = [&] { source.replace(e.offset, e.removed, e.inserted); };
+    if (!root || !indexed) {
+      apply();
+      return false;
+    }
+    auto path = enclosing(e.offset, e.offset + e.removed);
+    if (path.empty()) {
+      apply();
+      return false;
+    }
+    std::size_t start = path.back().start;
+    std::size_t oldLen = nodes.at(path.back().node.get()).len;
+    SrcLoc at = locOf(*path.back().node);
+    SrcLoc oldEnd = advance(at, source, start, start + oldLen);
+    apply();
+    std::size_t newLen = oldLen + e.inserted.size() - e.removed;
+    SrcLoc newEnd = advance(at, source, start, start + newLen);
+
+    // The text must not run into its neighbours, as "x" typed before "in" would.
+    std::size_t end = start + newLen;
+    if (newLen == 0 || (start > 0 && isIdentChar(source[start - 1]) && isIdentChar(source[start])) ||
+        (end < source.size() && isIdentChar(source[end - 1]) && isIdentChar(source[end])))
+      return false;
+
+    std::string text = source.substr(start, newLen);
+    ExprPtr fresh;
+    try {
+      fresh = parse_to_ast(text, filename);
+    } catch (const ParseError&) {
+      return false;   // reported by the full parse
+    }
+    Indexer ix(text, nodes, gen);
+    ix.index(fresh, 0);
+    if (!ix.ok()) return false;
+    stats.reparsedBytes = newLen;
+    stats.reparsedNodes = ix.nodes();
+    place(*fresh, at);
+    splice(path, fresh, e.inserted.size(), e.removed, oldEnd, newEnd);
+    return true;
+  }
+
+  // Moves the locations of a subtree parsed on its own to where it starts, 'at'.
+  void place(Expr& e, const SrcLoc& at) {
+    auto& l = locOf(e);
+    if (l.line == 1) l.col += at.col - 1;
+    l.line += at.line - 1;
+    for (auto* c : children(e)) place(**c, at);
+  }
+
+  // Moves the locations of a subtree that follows an edit, which ended at
+  // 'oldEnd' and now ends at 'newEnd'.
+  void relocate(Expr& e, const SrcLoc& oldEnd, const SrcLoc& newEnd) {
+    auto& l = locOf(e);
+    if (l.line == oldEnd.line) {
+      l.line = newEnd.line;
+      l.col = newEnd.col + (l.col - oldEnd.col);
+    } else if (newEnd.line == oldEnd.line) {
+      return;   // the rest of the subtree is on later lines, which did not move
+    } else {
+      l.line += newEnd.line - oldEnd.line;
+    }
+    for (auto* c : children(e)) relocate(**c, oldEnd, newEnd);
+  }
+
+  // Drops the table entries of a subtree that left the tree.
+  void forget(const Expr& e) {
+    for (auto* c : children(e)) forget(**c);
+    nodes.erase(&e);
+  }
+
+  // Replaces the last node of 'path' with 'fresh', whose table entry is
+  // relative to its own text, copying the nodes above it.
+  void splice(const std::vector<Step>& path, const ExprPtr& fresh, std::size_t grow, std::size_t shrink,
+              const SrcLoc& oldEnd, const SrcLoc& newEnd) {
+    nodes.at(fresh.get()).off += nodes.at(path.back().node.get()).off;
+    forget(*path.back().node);
+    ExprPtr child = fresh;
+    for (auto i = path.size() - 1; i > 0; --i) {
+      const ExprPtr& parent = path[i - 1].node;
+      auto copy = std::make_shared<Expr>(*parent);
+      NodeInfo info = std::move(nodes.at(parent.get()));
+      nodes.erase(parent.get());
+      info.node = copy;
+      info.gen = gen;
+      info.free.reset();
+      info.len = info.len + grow - shrink;
+      info.hash = ownHash(*copy);
+      info.size = 1;
+      auto kids = children(*copy);
+      *kids[path[i].slot] = child;
+      for (std::size_t j = 0; j < kids.size(); ++j) {
+        auto& k = nodes.at(kids[j]->get());
+        if (j > path[i].slot) {
+          k.off = k.off + grow - shrink;
+          relocate(**kids[j], oldEnd, newEnd);
+        }
+        info.hash = mix(info.hash, k.hash);
+        info.size += k.size;
+      }
+      nodes.emplace(copy.get(), std::move(info));
+      child = std::move(copy);
+    }
+    root = child;
+  }
+
+  // ---------- Scope check ----------
+
+  const std::vector<std::string>& freeVars(const Expr& e) {
+    auto& info = nodes.at(&e);
+    if (info.free) return *info.free;
+    std::vector<std::string> fv;
+    if (auto* v = std::get_if<EVar>(&e)) {
+      fv.push_back(v->name);
+    } else {
+      const std::string* binder = nullptr;
+      if (auto* l = std::get_if<ELam>(&e)) binder = &l->param;
+      if (auto* l = std::get_if<ELet>(&e)) binder = &l->name;
+      auto kids = children(e);
+      for (std::size_t i = 0; i < kids.size(); ++i) {
+        auto xs = freeVars(**kids[i]);
+        if (binder && (std::holds_alternative<ELam>(e) || i == 1))
+          xs.erase(std::remove(xs.begin(), xs.end(), *binder), xs.end());
+        std::vector<std::string> both;
+        std::set_union(fv.begin(), fv.end(), xs.begin(), xs.end(), std::back_inserter(both));
+        fv.swap(both);
+      }
+    }
+    info.free = std::move(fv);
+    return *info.free;
+  }
+
+  // As ScopeChecker::check, but a subtree kept from the last update is only
+  // walked into if one of its free variables is unbound.
+  void scope(const Expr& e) {
+    if (nodes.at(&e).gen != gen) {
+      const auto& fv = freeVars(e);
+      if (std::all_of(fv.begin(), fv.end(), [&](const std::string& x) {
+            auto it = bound.find(x);
+            return it != bound.end() && it->second > 0;
+          }))
+        return;
+    }
+    ++stats.scopeNodes;
+    std::visit(overloaded{
+      [&](const EVar& n) {
+        auto it = bound.find(n.name);
+        if (it == bound.end() || it->second == 0)
+          throw ScopeError(n.loc.file + ":" + std::to_string(n.loc.line) + ":" + std::to_string(n.loc.col) +
+                           ": unbound variable '" + n.name + "'");
+      },
+      [&](const ELam& n) {
+        ++bound[n.param];
+        scope(*n.body);
+        --bound[n.param];
+      },
+      [&](const ELet& n) {
+        scope(*n.rhs);
+        ++bound[n.name];
+        scope(*n.body);
+        --bound[n.name];
+      },
+      [&](const auto&) {
+        for (auto* c : children(e)) scope(**c);
+      }
+    }, e);
+  }
+
+  // ---------- Inference ----------
+
+  std::optional<Fingerprint> fingerprint(const Expr& e, const TypeEnv& gamma) {
+    Fingerprint fp;
+    std::unordered_map<int, int> canon;
+    std::function<void(const TypePtr&, const std::vector<int>&)> write = [&](const TypePtr& t,
+                                                                               const std::vector<int>& quant) {
+      switch (t->k) {
+        case TKind::INT: fp.key += 'I'; return;
+        case TKind::BOOL: fp.key += 'B'; return;
+        case TKind::VAR: {
+          auto q = std::find(quant.begin(), quant.end(), t->v.id);
+          if (q != quant.end()) {
+            fp.key += 'q' + std::to_string(q - quant.begin()) + '.';
+            return;
+          }
+          auto [it, added] = canon.try_emplace(t->v.id, static_cast<int>(fp.vars.size()));
+          if (added) fp.vars.push_back(t->v.id);
+          fp.key += 'v' + std::to_string(it->second) + '.';
+          return;
+        }
+        case TKind::FUN:
+          fp.key += 'F';
+          write(t->f.a, quant);
+          write(t->f.b, quant);
+          return;
+        case TKind::TUPLE:
+          fp.key += 'T' + std::to_string(t->tupleElems.size()) + '.';
+          for (auto& x : t->tupleElems) write(x, quant);
+          return;
+      }
+    };
+    for (auto& name : freeVars(e)) {
+      auto it = gamma.find(name);
+      if (it == gamma.end() || typeTreeSize(it->second.body) > kMemoMaxType) return std::nullopt;
+      fp.key += name + ':';
+      write(it->second.body, it->second.quant);
+      fp.key += ';';
+    }
+    return fp;
+  }
+
+  std::optional<InferResult> find(const Expr& e, const TypeEnv& gamma) override {
+    ++stats.inferredNodes;
+    const auto& info = nodes.at(&e);
+    if (info.size < kMemoMinSize) return std::nullopt;
+    auto bucket = memo.find(info.hash);
+    if (bucket == memo.end()) return std::nullopt;
+    auto fp = fingerprint(e, gamma);
+    if (!fp) return std::nullopt;
+    for (auto& entry : bucket->second) {
+      if (entry.env != fp->key || !sameShape(*entry.node, e)) continue;
+      entry.lastUse = gen;
+      ++stats.memoHits;
+      std::unordered_map<int, int> ids;
+      for (std::size_t i = 0; i < fp->vars.size(); ++i) ids[static_cast<int>(i)] = fp->vars[i];
+      auto fresh = [] { return freshTypeVarId(); };
+      std::unordered_map<const Type*, TypePtr> done;
+      InferResult r;
+      for (std::size_t i = 0; i < fp->vars.size(); ++i) {
+        auto t = renumber(entry.envImages[i], ids, fresh, done);
+        if (t->k != TKind::VAR || t->v.id != fp->vars[i]) r.subst.m[fp->vars[i]] = t;
+      }
+      r.type = renumber(entry.type, ids, fresh, done);
+      return r;
+    }
+    return std::nullopt;
+  }
+
+  void store(const Expr& e, const TypeEnv& gamma, const InferResult& r) override {
+    const auto& info = nodes.at(&e);
+    if (info.size < kMemoMinSize) return;
+    auto fp = fingerprint(e, gamma);
+    if (!fp) return;
+    auto& bucket = memo[info.hash];
+    for (auto& entry : bucket) {
+      if (entry.env == fp->key && sameShape(*entry.node, e)) {
+        entry.lastUse = gen;
+        return;
+      }
+    }
+    Entry entry;
+    entry.node = info.node;
+    entry.env = std::move(fp->key);
+    entry.lastUse = gen;
+    std::unordered_map<int, int> ids;
+    for (std::size_t i = 0; i < fp->vars.size(); ++i) ids[fp->vars[i]] = static_cast<int>(i);
+    int next = static_cast<int>(fp->vars.size());
+    auto fresh = [&] { return next++; };
+    std::unordered_map<const Type*, TypePtr> done;
+    for (int v : fp->vars) entry.envImages.push_back(renumber(apply_type(r.subst, Type::tVar(v)), ids, fresh, done));
+    entry.type = renumber(apply_type(r.subst, r.type), ids, fresh, done);
+    bucket.push_back(std::move(entry));
+  }
+
+  void sweep() {
+    if (gen % kSweepEvery != 0) return;
+    for (auto it = memo.begin(); it != memo.end();) {
+      auto& bucket = it->second;
+      bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                  [&](const Entry& entry) { return entry.lastUse + kMemoKeep < gen; }),
+                   bucket.end());
+      it = bucket.empty() ? memo.erase(it) : std::next(it);
+    }
+  }
+
+  RunResult check() {
+    RunResult r;
+    try {
+      bound.clear();
+      scope(*root);
+    } catch (const ScopeError& e) {
+      return fail(RunResult::Status::ScopeError, e);
+    }
+    try {
+      auto res = infer(*root, TypeEnv{}, *this);
+      r.type = showTypeCanonical(apply_type(res.subst, res.type));
+    } catch (const TypeError& e) {
+      return fail(RunResult::Status::TypeError, e);
+    }
+    sweep();
+    return r;
+  }
+};
+
+// ---------- IncrementalAnalyzer ----------
+
+IncrementalAnalyzer::IncrementalAnalyzer(std::string filename) : s_(std::make_unique<State>()) {
+  s_->filename = std::move(filename);
+}
+
+IncrementalAnalyzer::~IncrementalAnalyzer() = default;
+
+RunResult IncrementalAnalyzer::open(std::string source) {
+  s_->source = std::move(source);
+  ++s_->gen;
+  s_->stats = {};
+  return s_->fullParse();
+}
+
+RunResult IncrementalAnalyzer::edit(const TextEdit& e) {
+  auto& s = *s_;
+  if (e.offset > s.source.size() || e.removed > s.source.size() - e.offset)
+    throw std::out_of_range("edit outside the source");
+  ++s.gen;
+  s.stats = {};
+  if (!s.reparse(e)) return s.fullParse();
+  return s.check();
+}
+
+RunResult IncrementalAnalyzer::update(std::string source) {
+  const auto& old = s_->source;
+  std::size_t n = std::min(old.size(), source.size());
+  std::size_t prefix = 0;
+  while (prefix < n && old[prefix] == source[prefix]) ++prefix;
+  std::size_t suffix = 0;
+  while (suffix < n - prefix && old[old.size() - 1 - suffix] == source[source.size() - 1 - suffix]) ++suffix;
+  TextEdit e;
+  e.offset = prefix;
+  e.removed = old.size() - prefix - suffix;
+  e.inserted = source.substr(prefix, source.size() - prefix - suffix);
+  return edit(e);
+}
+
+const std::string& IncrementalAnalyzer::source() const { return s_->source; }
+
+ExprPtr IncrementalAnalyzer::ast() const { return s_->root; }
+
+const IncrementalStats& IncrementalAnalyzer::stats() const { return s_->stats; }
+
+} // namespace miniml
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include "Pipeline.hpp"
+#include "../ast/Nodes.hpp"
+
+namespace miniml {
+
+    // Replaces 'removed' bytes at 'offset' with 'inserted'.
+    struct TextEdit {
+        std::size_t offset = 0;
+        std::size_t removed = 0;
+        std::string inserted;
+    };
+
+    // What the last open(), edit() or update() redid.
+    struct IncrementalStats {
+        bool fullParse = false;          // the whole source was parsed again
+        std::size_t reparsedBytes = 0;
+        std::size_t reparsedNodes = 0;   // AST nodes built by the parser
+        std::size_t scopeNodes = 0;      // nodes the scope check walked into
+        std::size_t inferredNodes = 0;   // nodes inference reached
+        std::size_t memoHits = 0;        // of which typed from the cache
+    };
+
+    // Parse, scope check and type inference of a source that changes a little
+    // at a time, as an editor needs them after every keystroke. Results are
+    // those of Pipeline::run without evaluation: status, type or error.
+    //
+    // An edit is reparsed from the smallest enclosing subtree whose text
+    // parses on its own (a let right-hand side, an if condition or branch, a
+    // tuple element, a parenthesized expression, or the body of one of
+    // these), and spliced into the previous tree; the rest of the tree is
+    // reused. Only nodes on the path from the root to the edit are new, so
+    // the scope check walks that path and the new subtree, and checks a
+    // reused subtree by its free variables. Inference looks each subtree up
+    // in a cache keyed by its structural hash and the types its free
+    // variables have, so a reused subtree whose environment did not change is
+    // not inferred again, and the work of an edit follows the path to it.
+    //
+    // Locations of the nodes after an edit are shifted in place (all of them
+    // when it adds or removes lines), so the tree returned by ast() changes.
+    // Shadowing warnings are not reported. Not thread-safe.
+    class IncrementalAnalyzer {
+    public:
+        explicit IncrementalAnalyzer(std::string filename = "<stdin>");
+        ~IncrementalAnalyzer();
+        IncrementalAnalyzer(const IncrementalAnalyzer&) = delete;
+        IncrementalAnalyzer& operator=(const IncrementalAnalyzer&) = delete;
+
+        // Analyzes 'source' from scratch (the type cache is kept).
+        RunResult open(std::string source);
+
+        // Applies 'e' to the current source and analyzes the result. Throws
+        // std::out_of_range if the edit is not within the source.
+        RunResult edit(const TextEdit& e);
+
+        // Same for a whole new source: the edit is what differs between the
+        // two, found by comparing their common prefix and suffix.
+        RunResult update(std::string source);
+
+        const std::string& source() const;
+        ExprPtr ast() const;   // null while the source does not parse
+        const IncrementalStats& stats() const;
+
+    private:
+        struct State;
+        std::unique_ptr<State> s_;
+    };
+
+} // namespace miniml
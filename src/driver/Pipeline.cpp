@@ -0,0 +1,88 @@
+#include "Pipeline.hpp"
+#include "../parser/parse_to_ast.hpp"
+#include "../semantic/Escape.hpp"
+#include "../semantic/LastUse.hpp"
+#include "../semantic/ScopeCheck.hpp"
+#include "../evaluator/Eval.hpp"
+#include "../evaluator/Limits.hpp"
+#include "../types/Infer.hpp"
+#include "../types/Pretty.hpp"
+#include "../utils/PhaseTimer.hpp"
+
+namespace miniml {
+
+const char* statusName(RunResult::Status s) {
+  switch (s) {
+    case RunResult::Status::Ok: return "ok";
+    case RunResult::Status::ParseError: return "parse_error";
+    case RunResult::Status::ScopeError: return "scope_error";
+    case RunResult::Status::TypeError: return "type_error";
+    case RunResult::Status::LimitError: return "limit_error";
+    case RunResult::Status::RuntimeError: return "runtime_error";
+    case RunResult::Status::ReadError: return "read_error";
+  }
+  return "?";
+}
+
+Pipeline::Pipeline(RunOptions opts) : opts_(opts), prelude_(prelude()) {
+  markShared(*prelude_);   // runs may come from several threads
+}
+
+RunResult Pipeline::run(const std::string& code, const std::string& filename, PhaseTimer* timer) const {
+  RunResult r;
+  auto fail = [&](RunResult::Status s, const std::exception& e) {
+    r.status = s;
+    r.error = e.what();
+    return r;
+  };
+
+  ExprPtr ast;
+  try {
+    PhaseTimer::Scope phase(timer, "parse");
+    ast = parse_to_ast(code, filename, timer);
+  } catch (const ParseError& e) {
+    return fail(RunResult::Status::ParseError, e);
+  }
+  try {
+    PhaseTimer::Scope phase(timer, "scope_check");
+    ScopeConfig cfg;
+    cfg.warn_on_shadow = true;
+    cfg.on_warning = [&](const std::string& msg) { r.warnings.push_back(msg); };
+    ScopeChecker checker(cfg);
+    checker.check(ast);
+  } catch (const ScopeError& e) {
+    return fail(RunResult::Status::ScopeError, e);
+  }
+  try {
+    PhaseTimer::Scope phase(timer, "infer");
+    auto inferred = infer(ast, TypeEnv{});
+    r.type = showTypeCanonical(apply_type(inferred.subst, inferred.type));
+  } catch (const TypeError& e) {
+    return fail(RunResult::Status::TypeError, e);
+  }
+
+  EvalLimits limits;
+  limits.fuel = opts_.fuel;
+  limits.maxHeapBytes = opts_.maxHeapBytes;
+  limits.maxDepth = opts_.maxDepth;
+  if (opts_.timeout.count() > 0) limits.setTimeout(opts_.timeout);
+  EvalContext ctx;
+  if (opts_.fuel || opts_.timeout.count() > 0 || opts_.maxHeapBytes || opts_.maxDepth) ctx.limits = &limits;
+  ctx.cancel = opts_.cancel;
+  try {
+    {
+      PhaseTimer::Scope phase(timer, "escape");
+      analyzeEscapes(ast);
+      analyzeLastUses(ast);
+    }
+    PhaseTimer::Scope phase(timer, "eval");
+    r.value = showVal(eval(ast, prelude_, ctx));
+  } catch (const EvalLimitError& e) {
+    return fail(RunResult::Status::LimitError, e);
+  } catch (const std::runtime_error& e) {
+    return fail(RunResult::Status::RuntimeError, e);
+  }
+  return r;
+}
+
+} // namespace miniml
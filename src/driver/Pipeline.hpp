@@ -0,0 +1,56 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../evaluator/Value.hpp"
+
+namespace miniml {
+
+    class CancellationToken;
+    class PhaseTimer;
+
+    // Outcome of checking and evaluating one program.
+    struct RunResult {
+        enum class Status { Ok, ParseError, ScopeError, TypeError, LimitError, RuntimeError, ReadError };
+
+        Status status = Status::Ok;
+        std::string type;    // once inference succeeded
+        std::string value;   // when status is Ok
+        std::string error;   // otherwise
+        std::vector<std::string> warnings;   // from the scope check (shadowing)
+    };
+
+    // "ok", "parse_error", "scope_error", "type_error", "limit_error", "runtime_error",
+    // "read_error" (the source could not be read; only batch mode reports it)
+    const char* statusName(RunResult::Status s);
+
+    // Evaluation limits applied to every run (see EvalLimits); zero is off.
+    struct RunOptions {
+        std::uint64_t fuel = 0;
+        std::chrono::milliseconds timeout{0};
+        std::size_t maxHeapBytes = 0;
+        std::size_t maxDepth = 0;
+        const CancellationToken* cancel = nullptr;
+    };
+
+    // Parse, scope check, infer, escape analysis and eval of a source string,
+    // as minimlc does for a file. The prelude environment is built once and
+    // shared by every run; errors are returned, not thrown. run() may be
+    // called from several threads at once.
+    class Pipeline {
+    public:
+        explicit Pipeline(RunOptions opts = {});
+
+        // With a timer, each phase is timed as minimlc --time-phases does.
+        RunResult run(const std::string& code, const std::string& filename = "<stdin>",
+                      PhaseTimer* timer = nullptr) const;
+
+    private:
+        RunOptions opts_;
+        Ref<EnvV> prelude_;
+    };
+
+} // namespace miniml
@@ -0,0 +1,246 @@
+#include "Server.hpp"
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace miniml {
+
+// ------- ResultCache -------
+
+static std::size_t keyOf(const std::string& filename, const std::string& code) {
+  std::size_t h = std::hash<std::string>{}(code);
+  return h ^ (std::hash<std::string>{}(filename) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+}
+
+const RunResult* ResultCache::find(const std::string& filename, const std::string& code) {
+  auto it = index_.find(keyOf(filename, code));
+  if (it == index_.end() || it->second->code != code || it->second->filename != filename) return nullptr;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return &entries_.front().result;
+}
+
+void ResultCache::insert(const std::string& filename, const std::string& code, RunResult result) {
+  if (capacity_ == 0) return;
+  auto hash = keyOf(filename, code);
+  if (auto it = index_.find(hash); it != index_.end()) {   // same program, or a collision: replace
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+  entries_.push_front(Entry{hash, filename, code, std::move(result)});
+  index_[hash] = entries_.begin();
+  if (entries_.size() > capacity_) {
+    index_.erase(entries_.back().hash);
+    entries_.pop_back();
+  }
+}
+
+// ------- CompileServer -------
+
+static std::string jsonString(const std::string& s) {
+  std::string out = "\"";
+  for (char c : s) {
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          std::snprintf(buf, sizeof buf, "\\u%04x", c);
+          out += buf;
+        } else {
+          out += c;
+        }
+    }
+  }
+  return out + "\"";
+}
+
+static std::string errorJson(const std::string& status, const std::string& msg) {
+  return "{\"status\":" + jsonString(status) + ",\"error\":" + jsonString(msg) + "}";
+}
+
+std::string CompileServer::run(const std::string& filename, const std::string& code) {
+  auto start = std::chrono::steady_clock::now();
+  bool cached = false;
+  RunResult r;
+  if (auto hit = cache_.find(filename, code)) {
+    r = *hit;
+    cached = true;
+  } else {
+    r = pipeline_.run(code, filename);
+    if (r.status != RunResult::Status::LimitError) cache_.insert(filename, code, r);
+  }
+  auto us = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+  ++requests_;
+  if (cached) ++cacheHits_;
+  totalLatencyUs_ += us;
+  if (us > maxLatencyUs_) maxLatencyUs_ = us;
+
+  std::string out = "{\"status\":" + jsonString(statusName(r.status));
+  if (!r.type.empty()) out += ",\"type\":" + jsonString(r.type);
+  if (r.status == RunResult::Status::Ok) out += ",\"value\":" + jsonString(r.value);
+  else out += ",\"error\":" + jsonString(r.error);
+  out += std::string(",\"cached\":") + (cached ? "true" : "false");
+  out += ",\"latency_us\":" + std::to_string(us) + "}";
+  return out;
+}
+
+std::string CompileServer::statsJson() const {
+  char buf[256];
+  std::snprintf(buf, sizeof buf,
+                "{\"requests\":%llu,\"cache_hits\":%llu,\"cache_entries\":%zu,\"mean_latency_us\":%.1f,"
+                "\"max_latency_us\":%llu}",
+                static_cast<unsigned long long>(requests_), static_cast<unsigned long long>(cacheHits_),
+                cache_.size(), requests_ ? static_cast<double>(totalLatencyUs_) / static_cast<double>(requests_) : 0.0,
+                static_cast<unsigned long long>(maxLatencyUs_));
+  return buf;
+}
+
+void CompileServer::serve(std::istream& in, std::ostream& out) {
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty()) continue;
+    std::istringstream words(line);
+    std::string cmd;
+    words >> cmd;
+    if (cmd == "QUIT") break;
+    if (cmd == "STATS") {
+      out << statsJson() << "\n" << std::flush;
+      continue;
+    }
+    if (cmd != "RUN") {
+      out << errorJson("bad_request", "unknown command: " + cmd) << "\n" << std::flush;
+      continue;
+    }
+    long long bytes = -1;
+    std::string filename = "<request>";
+    words >> bytes;
+    if (!words || bytes < 0) {
+      out << errorJson("bad_request", "expected: RUN <bytes> [<filename>]") << "\n" << std::flush;
+      continue;
+    }
+    if (static_cast<unsigned long long>(bytes) > maxRequestBytes_) {
+      out << errorJson("bad_request", "program longer than " + std::to_string(maxRequestBytes_) + " bytes")
+          << "\n" << std::flush;
+      continue;
+    }
+    words >> filename;
+    std::string reply;
+    try {
+      std::string code(static_cast<std::size_t>(bytes), '\0');
+      if (!in.read(code.data(), bytes)) {
+        out << errorJson("bad_request", "end of input inside a program") << "\n" << std::flush;
+        break;
+      }
+      reply = run(filename, code);
+    } catch (const std::bad_alloc&) {
+      reply = errorJson("out_of_memory", "request " + filename + " ran out of memory");
+    }
+    out << reply << "\n" << std::flush;
+  }
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+namespace {
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;   // a client that hung up is an error, not SIGPIPE
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+// Buffered iostream access to a connected socket.
+class FdStreambuf : public std::streambuf {
+ public:
+  explicit FdStreambuf(int fd) : fd_(fd) {
+    setg(in_, in_, in_);
+    setp(out_, out_ + sizeof out_);
+  }
+  ~FdStreambuf() override { sync(); }
+
+ protected:
+  int_type underflow() override {
+    ssize_t n = ::read(fd_, in_, sizeof in_);
+    if (n <= 0) return traits_type::eof();
+    setg(in_, in_, in_ + n);
+    return traits_type::to_int_type(*gptr());
+  }
+  int_type overflow(int_type c) override {
+    if (sync() != 0) return traits_type::eof();
+    if (!traits_type::eq_int_type(c, traits_type::eof())) sputc(traits_type::to_char_type(c));
+    return traits_type::not_eof(c);
+  }
+  int sync() override {
+    for (char* p = pbase(); p < pptr();) {
+      ssize_t n = ::send(fd_, p, static_cast<std::size_t>(pptr() - p), kSendFlags);
+      if (n <= 0) return -1;
+      p += n;
+    }
+    setp(out_, out_ + sizeof out_);
+    return 0;
+  }
+
+ private:
+  int fd_;
+  char in_[4096];
+  char out_[4096];
+};
+
+} // namespace
+
+void CompileServer::listen(const std::string& socketPath) {
+  sockaddr_un addr{};
+  if (socketPath.size() >= sizeof addr.sun_path) throw std::runtime_error("socket path too long: " + socketPath);
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+  int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) throw std::runtime_error("cannot create socket: " + std::string(std::strerror(errno)));
+  ::unlink(socketPath.c_str());
+  if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof addr) != 0 || ::listen(fd, 16) != 0) {
+    std::string err = std::strerror(errno);
+    ::close(fd);
+    throw std::runtime_error("cannot listen on " + socketPath + ": " + err);
+  }
+  for (;;) {
+    int conn = ::accept(fd, nullptr, nullptr);
+    if (conn < 0) {
+      if (errno == EINTR) continue;
+      std::string err = std::strerror(errno);
+      ::close(fd);
+      throw std::runtime_error("accept failed on " + socketPath + ": " + err);
+    }
+    {
+      FdStreambuf buf(conn);
+      std::istream in(&buf);
+      std::ostream out(&buf);
+      serve(in, out);
+    }
+    ::close(conn);
+  }
+}
+#else
+void CompileServer::listen(const std::string& socketPath) {
+  throw std::runtime_error("Unix domain sockets are not available on this platform: " + socketPath);
+}
+#endif
+
+} // namespace miniml
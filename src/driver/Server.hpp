@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include "Pipeline.hpp"
+
+namespace miniml {
+
+    // Least recently used RunResults, keyed by a hash of file name and source.
+    // Entries keep the source, so a hash collision is a miss, not a wrong answer.
+    class ResultCache {
+    public:
+        explicit ResultCache(std::size_t capacity) : capacity_(capacity) {}
+
+        const RunResult* find(const std::string& filename, const std::string& code);
+        void insert(const std::string& filename, const std::string& code, RunResult result);
+        std::size_t size() const { return entries_.size(); }
+
+    private:
+        struct Entry {
+            std::size_t hash;
+            std::string filename, code;
+            RunResult result;
+        };
+        std::size_t capacity_;
+        std::list<Entry> entries_;   // most recently used first
+        std::unordered_map<std::size_t, std::list<Entry>::iterator> index_;
+    };
+
+    // minimlc --serve: answers requests with one warm Pipeline (parser tables,
+    // prelude) and a ResultCache. The protocol is line framed:
+    //
+    //   RUN <bytes> [<filename>]\n<bytes of source>   check and evaluate a program
+    //   STATS\n                                        request count, cache hits, latency
+    //   QUIT\n                                         end the session
+    //
+    // Every request is answered with one line of JSON, e.g.
+    //   {"status":"ok","type":"Int","value":"42","cached":false,"latency_us":91}
+    // Results that hit an evaluation limit are not cached. A RUN longer than
+    // maxRequestBytes is answered with bad_request without reading its body,
+    // and a request that runs out of memory with out_of_memory; either way
+    // the session goes on with the next line.
+    class CompileServer {
+    public:
+        static constexpr std::size_t kDefaultMaxRequestBytes = std::size_t(16) << 20;
+
+        explicit CompileServer(const Pipeline& pipeline, std::size_t cacheEntries = 256,
+                               std::size_t maxRequestBytes = kDefaultMaxRequestBytes)
+            : pipeline_(pipeline), cache_(cacheEntries), maxRequestBytes_(maxRequestBytes) {}
+
+        // Serve requests from 'in' until QUIT or end of input.
+        void serve(std::istream& in, std::ostream& out);
+
+        // Accept connections on a Unix domain socket and serve them one at a time.
+        void listen(const std::string& socketPath);
+
+        std::string statsJson() const;
+
+    private:
+        const Pipeline& pipeline_;
+        ResultCache cache_;
+        std::size_t maxRequestBytes_;
+        std::uint64_t requests_ = 0;
+        std::uint64_t cacheHits_ = 0;
+        std::uint64_t totalLatencyUs_ = 0;
+        std::uint64_t maxLatencyUs_ = 0;
+
+        std::string run(const std::string& filename, const std::string& code);
+    };
+
+} // namespace miniml
@@ -1,34 +1,148 @@
 #include "Eval.hpp"
+#include <cstring>
 #include <stdexcept>
+#include "Limits.hpp"
+#include "Memo.hpp"
+#include "Profiler.hpp"
+#include "Stats.hpp"
 #include "../utils/vector_utils.hpp"
+#include "../utils/WorkStealingPool.hpp"
 
 namespace miniml {
 
-static Val eval1(const Expr& e, std::shared_ptr<EnvV> env);
+static Val eval1(const Expr& e, Ref<EnvV> env, EvalContext& ctx);
 
-Val eval(const ExprPtr& e, std::shared_ptr<EnvV> env) {
-  return eval1(*e, std::move(env));
+Val eval(const ExprPtr& e, Ref<EnvV> env) {
+  EvalContext ctx;
+  return eval1(*e, std::move(env), ctx);
 }
 
-bool compareVals(const Val& a, const Val& b, const SrcLoc& loc) {
+static const SrcLoc& locOf(const Expr& e) {
+  return std::visit([](const auto& n) -> const SrcLoc& { return n.loc; }, e);
+}
+
+static Val evalInstrumented(const Expr& e, Ref<EnvV> env, EvalContext& ctx) {
+  struct Quota {
+    EvalLimits* l;
+    Quota(EvalLimits* lim, const Expr& e) : l(lim) {
+      if (!l) return;
+      const SrcLoc& where = locOf(e);
+      l->step(where);
+      l->enter(where);
+    }
+    ~Quota() { if (l) l->leave(); }
+  } quota(ctx.limits, e);
+  struct Depth {
+    EvalStats* s;
+    explicit Depth(EvalStats* st) : s(st) {
+      if (s && ++s->depth > s->maxDepth) s->maxDepth = s->depth;
+    }
+    ~Depth() { if (s) --s->depth; }
+  } depth(ctx.stats);
+  if (!ctx.profiler) return eval1(e, std::move(env), ctx);
+  Profiler::Scope scope(*ctx.profiler, e);
+  return eval1(e, std::move(env), ctx);
+}
+
+Val eval(const ExprPtr& e, Ref<EnvV> env, EvalContext& ctx) {
+  if (!ctx.profiler && !ctx.stats && !ctx.limits) return eval1(*e, std::move(env), ctx);
+  return evalInstrumented(*e, std::move(env), ctx);
+}
+
+// The value of 'v', evaluated first if it is a thunk not forced yet.
+static const Val& force(const Val& v) {
+  auto t = std::get_if<Ref<Thunk>>(&v);
+  if (!t) return v;
+  Thunk& th = **t;
+  if (th.expr) {
+    EvalContext& ctx = *th.ctx;
+    th.value = eval(th.expr, th.env, ctx);
+    th.expr = nullptr;
+    th.env = nullptr;
+    if (ctx.stats) ++ctx.stats->thunksForced;
+  }
+  return th.value;
+}
+
+template <class T>
+void release(T* p) noexcept {
+  if (p->shared && std::atomic_ref<std::uint32_t>(p->rc).fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+  if (p->counters) {
+    p->counters->onFree(p->bytes);
+    p->counters.reset();
+  }
+  p->reset();   // drops what it refers to, keeping its own storage
+  p->shared = false;
+  if (!Cells<T>::keep(p)) delete p;
+}
+template void release(EnvV*) noexcept;
+template void release(Closure*) noexcept;
+template void release(Tuple*) noexcept;
+template void release(Thunk*) noexcept;
+
+void markShared(EnvV& env) {
+  for (EnvV* e = &env; e && !e->shared; e = e->parent.get()) {
+    e->shared = true;
+    markShared(e->value);
+    for (auto& [name, v] : e->m) markShared(v);
+  }
+}
+
+void markShared(const Val& v) {
+  if (auto c = std::get_if<Ref<Closure>>(&v)) {
+    if ((*c)->shared) return;
+    (*c)->shared = true;
+    if ((*c)->env) markShared(*(*c)->env);
+  } else if (auto t = std::get_if<Ref<Tuple>>(&v)) {
+    if ((*t)->shared) return;
+    (*t)->shared = true;
+    if (!(*t)->flat()) for (std::size_t i = 0; i < (*t)->size(); ++i) markShared((*t)->vals()[i]);
+  } else if (auto th = std::get_if<Ref<Thunk>>(&v)) {
+    if ((*th)->shared) return;
+    (*th)->shared = true;
+    if ((*th)->env) markShared(*(*th)->env);
+    markShared((*th)->value);
+  }
+}
+
+void forceAll(Val& v) {
+  if (std::holds_alternative<Ref<Thunk>>(v)) {
+    Val forced = force(v);
+    v = std::move(forced);
+  }
+  if (auto t = std::get_if<Ref<Tuple>>(&v); t && !(*t)->flat()) {
+    Tuple& tuple = **t;
+    for (std::size_t i = 0; i < tuple.size(); ++i) forceAll(tuple.vals()[i]);
+    tuple.pack();
+  }
+}
+
+bool compareVals(const Val& x, const Val& y, const SrcLoc& loc) {
+  const Val& a = force(x);
+  const Val& b = force(y);
   if (auto pa = std::get_if<long>(&a)) {
     if (auto pb = std::get_if<long>(&b)) return *pa == *pb;
     throw std::runtime_error(loc.file+":"+std::to_string(loc.line)+":"+std::to_string(loc.col)+": runtime: expected Int");
   } else if (auto pa = std::get_if<bool>(&a)) {
     if (auto pb = std::get_if<bool>(&b)) return *pa == *pb;
     throw std::runtime_error(loc.file+":"+std::to_string(loc.line)+":"+std::to_string(loc.col)+": runtime: expected Int");
-  } else if (auto pa = std::get_if<std::shared_ptr<Tuple>>(&a)) {
-    if (auto pb = std::get_if<std::shared_ptr<Tuple>>(&b)) {
-      if ((*pa)->elements.size() != (*pb)->elements.size())
+  } else if (auto pa = std::get_if<Ref<Tuple>>(&a)) {
+    if (auto pb = std::get_if<Ref<Tuple>>(&b)) {
+      const Tuple& s = **pa;
+      const Tuple& t = **pb;
+      if (s.size() != t.size())
         throw std::runtime_error(loc.file+":"+std::to_string(loc.line)+":"+std::to_string(loc.col)+": runtime: expected Tuples of same size");
-      for (size_t i = 0; i < (*pa)->elements.size(); ++i) {
-        if (!compareVals((*pa)->elements[i], (*pb)->elements[i], loc)) return false;
+      // flat tuples of the same element types: equal if their words are
+      if (s.flat() && t.flat() && s.bools() == t.bools())
+        return std::memcmp(s.words(), t.words(), s.size() * sizeof(long)) == 0;
+      for (size_t i = 0; i < s.size(); ++i) {
+        if (!compareVals(s.at(i), t.at(i), loc)) return false;
       }
       return true;
     }
     throw std::runtime_error(loc.file+":"+std::to_string(loc.line)+":"+std::to_string(loc.col)+": runtime: expected Tuple");
-  } else if (auto pa = std::get_if<std::shared_ptr<Closure>>(&a)) {
-    if (auto pb = std::get_if<std::shared_ptr<Closure>>(&b)) {
+  } else if (auto pa = std::get_if<Ref<Closure>>(&a)) {
+    if (auto pb = std::get_if<Ref<Closure>>(&b)) {
       // Closures are equal if they are the same object (pointer equality)
       return pa->get() == pb->get();
     }
@@ -40,61 +154,270 @@ bool compareVals(const Val& a, const Val& b, const SrcLoc& loc) {
 template<class... Ts> struct overloaded : Ts... { using Ts::operator()...; };
 template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 
-static Val eval1(const Expr& e, std::shared_ptr<EnvV> env) {
+// Handle to an object in the current C++ frame. Only used for
+// allocations analyzeEscapes proved not to outlive that frame.
+template <class T>
+static Ref<T> borrowed(T& obj) {
+  obj.borrowed = true;
+  ++obj.rc;   // the frame keeps the one it started with
+  return Ref<T>::adopt(&obj);
+}
+
+// newCell, counted when the run collects statistics or has a heap limit;
+// 'extra' is storage the object owns (a tuple's element buffer), and 'where'
+// is reported if the allocation goes over that limit.
+template <class T>
+static Ref<T> allocate(EvalContext& ctx, HeapKind kind, std::size_t shape, std::size_t extra, const SrcLoc& where) {
+  bool limited = ctx.limits && ctx.limits->maxHeapBytes;
+  if (!ctx.stats && !limited) return newCell<T>(shape);
+  auto& counters = ctx.stats ? ctx.stats->heap : ctx.limits->heap;
+  bool reused = false;
+  auto p = newCell<T>(shape, &reused);
+  p->counters = counters;
+  p->bytes = static_cast<std::uint32_t>(sizeof(T) + extra);
+  counters->onAlloc(kind, p->bytes, reused);
+  if (limited) ctx.limits->checkHeap(*counters, where);
+  return p;
+}
+
+static void bindLambda(Closure& c, const ELam& lam, Ref<EnvV> env) {
+  c.param = lam.param;
+  c.body = lam.body;
+  c.env = std::move(env);
+  c.frameEscapes = lam.frameEscapes;
+  c.lam = &lam;
+}
+
+// Whether EVar::lastUse reads may move the value out of its frame: not when
+// thunks or parallel tasks can still read the frame out of evaluation order.
+static bool movesLastUses(const EvalContext& ctx) { return !ctx.lazy && !ctx.pool; }
+
+// Evaluate 'body' with 'name' bound to 'v' in a new frame below 'parent';
+// the frame lives on the stack unless a closure may capture it.
+static Val evalInFrame(const ExprPtr& body, Ref<EnvV> parent,
+                       const std::string& name, Val v, bool frameEscapes, EvalContext& ctx) {
+  if (!frameEscapes && !ctx.lazy) {
+    EnvV frame;
+    frame.name = name;
+    frame.value = std::move(v);
+    frame.parent = std::move(parent);
+    if (ctx.stats) ++ctx.stats->stackFrames;
+    return eval(body, borrowed(frame), ctx);
+  }
+  auto child = allocate<EnvV>(ctx, HeapKind::Env, 0, 0, locOf(*body));
+  child->name = name;
+  child->value = std::move(v);
+  child->parent = std::move(parent);
+  return eval(body, std::move(child), ctx);
+}
+
+static Val call(const Closure& c, Val av, EvalContext& ctx) {
+  if (ctx.profiler && c.lam) {
+    Profiler::CallScope scope(*ctx.profiler, *c.lam);
+    return evalInFrame(c.body, c.env, c.param, std::move(av), c.frameEscapes, ctx);
+  }
+  return evalInFrame(c.body, c.env, c.param, std::move(av), c.frameEscapes, ctx);
+}
+
+// A call through ctx.memo. Closures on the stack (borrowed, with no owner
+// to keep them apart from later ones at the same address) are not cached.
+static Val callMemoized(const Ref<Closure>& clo, Val av, EvalContext& ctx) {
+  if (clo.use_count() == 0) return call(*clo, std::move(av), ctx);
+  if (ctx.lazy) forceAll(av);   // keys hold no thunks
+  if (auto hit = ctx.memo->find(clo, av)) return std::move(*hit);
+  Val arg = av;
+  Val result = call(*clo, std::move(av), ctx);
+  ctx.memo->store(clo, std::move(arg), result);
+  return result;
+}
+
+static bool canFork(const EvalContext& ctx) {
+  return ctx.pool && !ctx.profiler && !ctx.stats && !ctx.limits && !ctx.lazy;
+}
+
+// In a lazy run, what 'e' evaluates to: a thunk, unless evaluating it now
+// is as cheap. A variable is looked up without forcing what it is bound to.
+static Val delay(const ExprPtr& e, const Ref<EnvV>& env, EvalContext& ctx) {
+  if (std::holds_alternative<ELitInt>(*e) || std::holds_alternative<ELitBool>(*e) ||
+      std::holds_alternative<ELam>(*e) || std::holds_alternative<ELitTuple>(*e))
+    return eval(e, env, ctx);
+  if (auto v = std::get_if<EVar>(e.get())) {
+    Val bound;
+    if (env->get(v->name, bound)) return bound;
+    return eval(e, env, ctx);   // unbound: fails as usual
+  }
+  auto t = allocate<Thunk>(ctx, HeapKind::Thunk, 0, 0, locOf(*e));
+  t->expr = e;
+  t->env = env;
+  t->ctx = &ctx;
+  return t;
+}
+
+// Evaluates exprs[i] into out[i], the ones with forked[i] set as pool tasks
+// and the rest here, in order. Fails like sequential evaluation would: with
+// the error of the first expression (in order) that fails. Tasks after it are
+// cancelled, and every task is joined before returning or throwing, since
+// they use 'env' and 'out'.
+static void evalForked(std::size_t n, const ExprPtr* const exprs[], const bool forked[], Val out[],
+                       const Ref<EnvV>& env, EvalContext& ctx) {
+  struct Forked {
+    CancellationToken token;
+    EvalContext ctx;
+    WorkStealingPool::Task task;
+    Forked(const ExprPtr& e, const Ref<EnvV>& env, const EvalContext& parent, Val& out)
+        : token(parent.cancel), ctx(parent), task([this, &e, &env, &out] { out = eval(e, env, ctx); }) {
+      ctx.cancel = &token;
+    }
+  };
+  markShared(*env);   // the tasks count references to what it holds, too
+  std::vector<std::unique_ptr<Forked>> tasks(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!forked[i]) continue;
+    tasks[i] = std::make_unique<Forked>(*exprs[i], env, ctx, out[i]);
+    ctx.pool->fork(tasks[i]->task);
+  }
+
+  std::size_t failed = n;
+  std::exception_ptr error;
+  auto fail = [&](std::size_t i) {
+    if (i >= failed) return;
+    failed = i;
+    error = std::current_exception();
+    for (std::size_t j = i + 1; j < n; ++j) if (tasks[j]) tasks[j]->token.cancel();
+  };
+  for (std::size_t i = 0; i < n && i < failed; ++i) {
+    if (forked[i]) continue;
+    try {
+      out[i] = eval(*exprs[i], env, ctx);
+    } catch (...) {
+      fail(i);
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!tasks[i]) continue;
+    try {
+      ctx.pool->join(tasks[i]->task);
+    } catch (...) {
+      fail(i);
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+// Evaluate a value that is only compared; a non-escaping tuple literal that
+// fits is built in 'slot'.
+static Val evalCompared(const ExprPtr& e, const Ref<EnvV>& env, TupleSlot& slot, EvalContext& ctx) {
+  if (auto t = std::get_if<ELitTuple>(e.get()); t && !t->escapes && t->elems.size() <= TupleSlot::kArity) {
+    Tuple& tuple = slot.get();
+    for (auto& el : t->elems) tuple.push(ctx.lazy ? delay(el, env, ctx) : eval(el, env, ctx));
+    tuple.pack();
+    if (ctx.stats) ++ctx.stats->stackTuples;
+    return borrowed(tuple);
+  }
+  return eval(e, env, ctx);
+}
+
+static Val eval1(const Expr& e, Ref<EnvV> env, EvalContext& ctx) {
   return std::visit(overloaded{
     [&](const EVar& n) -> Val {
       Val v;
-      if (!env->get(n.name, v))
+      if (!(n.lastUse && movesLastUses(ctx) ? env->take(n.name, v) : env->get(n.name, v)))
         throw std::runtime_error(n.loc.file+":"+std::to_string(n.loc.line)+":"+std::to_string(n.loc.col)+
                                  ": runtime: unbound variable '"+n.name+"'");
+      if (ctx.stats) {
+        std::size_t hops = 0;
+        for (const EnvV* f = env.get(); f && f->name != n.name && !f->m.count(n.name); f = f->parent.get()) ++hops;
+        ++ctx.stats->lookups;
+        ctx.stats->lookupHops += hops;
+        if (hops > ctx.stats->maxLookupHops) ctx.stats->maxLookupHops = hops;
+      }
+      if (std::holds_alternative<Ref<Thunk>>(v)) return force(v);
       return v;
     },
     [&](const ELitInt& n) -> Val { return static_cast<long>(n.value); },
     [&](const ELitBool& n) -> Val { return static_cast<bool>(n.value); },
     [&](const ELitTuple& n) -> Val {
-      std::vector<Val> values;
-      values.reserve(n.elems.size());
-
-      std::transform(n.elems.begin(), n.elems.end(),
-                   std::back_inserter(values),
-                   [&](const ExprPtr& e) { return eval(e, env); });
-
-      return std::make_shared<Tuple>(Tuple{std::move(values)});
+      std::size_t size = n.elems.size();
+      auto t = allocate<Tuple>(ctx, HeapKind::Tuple, size, size * sizeof(Val), n.loc);
+      if (!n.fork.empty() && canFork(ctx)) {
+        t->resize(size);
+        std::vector<const ExprPtr*> exprs;
+        std::unique_ptr<bool[]> forked(new bool[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+          exprs.push_back(&n.elems[i]);
+          forked[i] = n.fork[i];
+        }
+        evalForked(size, exprs.data(), forked.get(), t->vals(), env, ctx);
+      } else {
+        for (auto& el : n.elems) t->push(ctx.lazy ? delay(el, env, ctx) : eval(el, env, ctx));
+      }
+      t->pack();
+      return t;
     },
     [&](const ELam& n) -> Val {
-      return std::make_shared<Closure>(Closure{n.param, n.body, env});
+      auto c = allocate<Closure>(ctx, HeapKind::Closure, 0, 0, n.loc);
+      bindLambda(*c, n, env);
+      return c;
     },
     [&](const EApp& n) -> Val {
-      Val fv = eval(n.fn, env);
-      Val av = eval(n.arg, env);
+      if (ctx.cancel && ctx.cancel->cancelled()) throw EvalCancelled(n.loc, "runtime: evaluation cancelled");
+      // (\x -> body) arg: no closure needed
+      if (auto lam = std::get_if<ELam>(n.fn.get()); lam && !lam->escapes) {
+        Val av = eval(n.arg, env, ctx);
+        if (ctx.profiler) {
+          Profiler::CallScope call(*ctx.profiler, *lam);
+          return evalInFrame(lam->body, env, lam->param, std::move(av), lam->frameEscapes, ctx);
+        }
+        return evalInFrame(lam->body, env, lam->param, std::move(av), lam->frameEscapes, ctx);
+      }
+      Val fv, av;
+      if (n.forkArg && canFork(ctx)) {
+        const ExprPtr* exprs[] = {&n.fn, &n.arg};
+        const bool forked[] = {false, true};
+        Val vals[2];
+        evalForked(2, exprs, forked, vals, env, ctx);
+        fv = std::move(vals[0]);
+        av = std::move(vals[1]);
+      } else {
+        fv = eval(n.fn, env, ctx);
+        av = eval(n.arg, env, ctx);
+      }
       // builtin “closure”? allow function values only:
-      if (auto clo = std::get_if<std::shared_ptr<Closure>>(&fv)) {
-        auto child = std::make_shared<EnvV>();
-        child->parent = (*clo)->env;
-        child->m[(*clo)->param] = av;
-        return eval((*clo)->body, child);
+      if (auto clo = std::get_if<Ref<Closure>>(&fv)) {
+        const Closure& c = **clo;
+        if (ctx.memo && c.lam && ctx.memo->applies(*c.lam)) return callMemoized(*clo, std::move(av), ctx);
+        return call(c, std::move(av), ctx);
       }
       throw std::runtime_error(n.loc.file+":"+std::to_string(n.loc.line)+":"+std::to_string(n.loc.col)+
                                ": runtime: trying to call a non-function");
     },
     [&](const EIf& n) -> Val {
-      Val cv = eval(n.cond, env);
+      Val cv = eval(n.cond, env, ctx);
       bool b = false;
       if (auto pb = std::get_if<bool>(&cv)) b = *pb;
       else if (auto pi = std::get_if<long>(&cv)) b = (*pi != 0); // until you add real booleans
       else throw std::runtime_error("runtime: non-boolean condition");
-      return b ? eval(n.thenE, env) : eval(n.elseE, env);
+      return b ? eval(n.thenE, env, ctx) : eval(n.elseE, env, ctx);
     },
     [&](const ELet& n) -> Val {
-      auto v1 = eval(n.rhs, env);
-      auto child = std::make_shared<EnvV>();
-      child->parent = env;
-      child->m[n.name] = v1;
-      return eval(n.body, child);
+      // right-hand sides that do not escape the body live in this frame
+      Closure closureSlot;
+      TupleSlot tupleSlot;
+      Val v1;
+      if (ctx.lazy) {
+        v1 = delay(n.rhs, env, ctx);
+      } else if (auto lam = std::get_if<ELam>(n.rhs.get()); lam && !lam->escapes) {
+        bindLambda(closureSlot, *lam, env);
+        v1 = borrowed(closureSlot);
+        if (ctx.stats) ++ctx.stats->stackClosures;
+      } else {
+        v1 = evalCompared(n.rhs, env, tupleSlot, ctx);
+      }
+      return evalInFrame(n.body, env, n.name, std::move(v1), n.frameEscapes, ctx);
     },
     // Unary not
     [&](const EUnOp& n) -> Val {
-      Val v = eval(n.expr, env);
+      Val v = eval(n.expr, env, ctx);
       bool b = false;
       if (auto pb = std::get_if<bool>(&v)) b = *pb;
       else if (auto pi = std::get_if<long>(&v)) b = (*pi != 0); // until you enforce Bool in types
@@ -104,30 +427,41 @@ static Val eval1(const Expr& e, std::shared_ptr<EnvV> env) {
     // Binary ops
     [&](const EBinOp& n) -> Val {
       auto L = n.loc;
-      auto lv = eval(n.lhs, env);
+      if (n.op == BinOp::Eq || n.op == BinOp::Neq) {
+        TupleSlot lslot, rslot;
+        auto lv = evalCompared(n.lhs, env, lslot, ctx);
+        auto rv = evalCompared(n.rhs, env, rslot, ctx);
+        bool eq = compareVals(lv, rv, L);
+        return n.op == BinOp::Eq ? eq : !eq;
+      }
+      Val lv, rv;
+      if (n.forkRhs && canFork(ctx)) {
+        const ExprPtr* exprs[] = {&n.lhs, &n.rhs};
+        const bool forked[] = {false, true};
+        Val vals[2];
+        evalForked(2, exprs, forked, vals, env, ctx);
+        lv = std::move(vals[0]);
+        rv = std::move(vals[1]);
+      } else {
+        lv = eval(n.lhs, env, ctx);
+      }
 
       // short-circuit And/Or
       if (n.op == BinOp::And) {
         bool lb = std::get_if<bool>(&lv) ? *std::get_if<bool>(&lv) : (std::get_if<long>(&lv) && *std::get_if<long>(&lv) != 0);
         if (!lb) return false;
-        auto rv = eval(n.rhs, env);
+        auto rv = eval(n.rhs, env, ctx);
         bool rb = std::get_if<bool>(&rv) ? *std::get_if<bool>(&rv) : (std::get_if<long>(&rv) && *std::get_if<long>(&rv) != 0);
         return lb && rb;
       }
       if (n.op == BinOp::Or) {
         bool lb = std::get_if<bool>(&lv) ? *std::get_if<bool>(&lv) : (std::get_if<long>(&lv) && *std::get_if<long>(&lv) != 0);
         if (lb) return true;
-        auto rv = eval(n.rhs, env);
+        auto rv = eval(n.rhs, env, ctx);
         bool rb = std::get_if<bool>(&rv) ? *std::get_if<bool>(&rv) : (std::get_if<long>(&rv) && *std::get_if<long>(&rv) != 0);
         return lb || rb;
       }
-      if (n.op == BinOp::Eq || n.op == BinOp::Neq) {
-        auto rv = eval(n.rhs, env);
-        bool eq = compareVals(lv, rv, L);
-        return n.op == BinOp::Eq ? eq : !eq;
-      }
-
-      auto rv = eval(n.rhs, env);
+      if (!n.forkRhs || !canFork(ctx)) rv = eval(n.rhs, env, ctx);
       auto asInt = [&](const Val& v)->long {
               if (auto p = std::get_if<long>(&v)) return *p;
               throw std::runtime_error(L.file+":"+std::to_string(L.line)+":"+std::to_string(L.col)+": runtime: expected Int");
@@ -136,10 +470,10 @@ static Val eval1(const Expr& e, std::shared_ptr<EnvV> env) {
       long x = asInt(lv), y = asInt(rv);
 
       switch (n.op) {
-        case BinOp::Add: return x + y;
-        case BinOp::Sub: return x - y;
-        case BinOp::Mul: return x * y;
-        case BinOp::Div: return y == 0 ? 0 /* or throw */ : x / y;
+        case BinOp::Add: return intAdd(x, y);
+        case BinOp::Sub: return intSub(x, y);
+        case BinOp::Mul: return intMul(x, y);
+        case BinOp::Div: return intDiv(x, y);
         case BinOp::Lt:  return x <  y;
         case BinOp::Le:  return x <= y;
         case BinOp::Gt:  return x >  y;
@@ -158,13 +492,14 @@ static Val eval1(const Expr& e, std::shared_ptr<EnvV> env) {
 std::string showVal(const Val& v) {
   if (auto i = std::get_if<long>(&v))  return std::to_string(*i);
   if (auto b = std::get_if<bool>(&v))  return *b ? "true" : "false";
-  if (std::get_if<std::shared_ptr<Closure>>(&v)) return "<fun>";
-  if (std::get_if<std::shared_ptr<Tuple>>(&v)) {
-    auto t = std::get<std::shared_ptr<Tuple>>(v);
+  if (std::get_if<Ref<Closure>>(&v)) return "<fun>";
+  if (std::get_if<Ref<Thunk>>(&v)) return showVal(force(v));
+  if (std::get_if<Ref<Tuple>>(&v)) {
+    auto t = std::get<Ref<Tuple>>(v);
     std::string s = "(";
-    for (size_t i = 0; i < t->elements.size(); ++i) {
+    for (size_t i = 0; i < t->size(); ++i) {
       if (i > 0) s += ", ";
-      s += showVal(t->elements[i]);
+      s += showVal(t->at(i));
     }
     s += ")";
     return s;
@@ -172,8 +507,8 @@ std::string showVal(const Val& v) {
   return "<unknown>";
 }
 
-std::shared_ptr<EnvV> prelude() {
-  auto env = std::make_shared<EnvV>();
+Ref<EnvV> prelude() {
+  auto env = newCell<EnvV>();
 
   // Minimal boolean literals as bindings
   env->m["true"]  = true;
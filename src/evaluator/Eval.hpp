@@ -3,13 +3,47 @@
 
 namespace miniml {
 
+    class Profiler;
+    struct EvalStats;
+    struct EvalLimits;
+    class CancellationToken;
+    class WorkStealingPool;
+    class CallMemo;
+
+    // Per-run evaluator state. Every hook is optional; unset hooks cost one
+    // null check per evaluated node.
+    struct EvalContext {
+        Profiler* profiler = nullptr;   // per-node counts and times (--profile)
+        EvalStats* stats = nullptr;     // allocation and depth statistics (--stats)
+        EvalLimits* limits = nullptr;   // fuel, deadline, heap and depth quotas (--fuel, --timeout, ...)
+        const CancellationToken* cancel = nullptr;   // polled on every call
+        // Runs the subexpressions analyzeParallelism marked as tasks (--parallel). Ignored
+        // while a profiler, statistics or limits are attached: those count on one thread.
+        WorkStealingPool* pool = nullptr;
+        // Answers repeated calls of the lambdas it applies to (--memo). A call answered
+        // from it uses no fuel and is not profiled.
+        CallMemo* memo = nullptr;
+        // Call-by-need (--lazy): let right-hand sides and tuple elements are evaluated
+        // when first needed, at most once. Frames and closures then all go on the heap,
+        // and 'pool' is ignored.
+        bool lazy = false;
+    };
+
     // Evaluate expression under environment; call-by-value
-    Val eval(const ExprPtr& e, std::shared_ptr<EnvV> env);
+    Val eval(const ExprPtr& e, Ref<EnvV> env);
+    Val eval(const ExprPtr& e, Ref<EnvV> env, EvalContext& ctx);
+
+    // Forces the thunks a lazy run left in 'v' (tuple elements, at any depth) and
+    // puts their values in their place. The run's EvalContext must still be alive.
+    void forceAll(Val& v);
+
+    // Structural equality, as '=' compares; throws at 'loc' for values of different kinds.
+    bool compareVals(const Val& a, const Val& b, const SrcLoc& loc);
 
     // Helpers to print values (for CLI)
     std::string showVal(const Val& v);
 
     // Optional: install a few builtins (+, -, *, =, true, false)
-    std::shared_ptr<EnvV> prelude();
+    Ref<EnvV> prelude();
 
 } // namespace miniml
@@ -0,0 +1,34 @@
+#include "Limits.hpp"
+
+namespace miniml {
+
+static std::string at(const SrcLoc& loc) {
+  return loc.file + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.col) + ": ";
+}
+
+EvalLimitError::EvalLimitError(const SrcLoc& where, const std::string& msg)
+    : std::runtime_error(at(where) + msg), loc(where) {}
+
+void EvalLimits::slowStep(const SrcLoc& where) {
+  if (fuel && steps > fuel)
+    throw FuelExhausted(where, "runtime: out of fuel after " + std::to_string(fuel) + " steps");
+  if (deadline && std::chrono::steady_clock::now() >= *deadline)
+    throw DeadlineExceeded(where, "runtime: deadline exceeded after " + std::to_string(steps) + " steps");
+
+  std::uint64_t next = std::numeric_limits<std::uint64_t>::max();
+  if (deadline) next = steps + kClockEvery;
+  if (fuel && fuel + 1 < next) next = fuel + 1;
+  nextCheck_ = next;
+}
+
+void EvalLimits::tooDeep(const SrcLoc& where) {
+  --depth;   // the caller's guard is not constructed yet
+  throw DepthLimitExceeded(where, "runtime: evaluation depth exceeds " + std::to_string(maxDepth));
+}
+
+void EvalLimits::heapFull(const HeapCounters& counters, const SrcLoc& where) const {
+  throw HeapLimitExceeded(where, "runtime: heap limit of " + std::to_string(maxHeapBytes) + " bytes exceeded (" +
+                                     std::to_string(counters.liveBytes) + " live)");
+}
+
+} // namespace miniml
@@ -0,0 +1,91 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include "../ast/Nodes.hpp"
+#include "Stats.hpp"
+
+namespace miniml {
+
+    // Raised when an evaluation runs into one of its EvalLimits or is
+    // cancelled. 'loc' is the node that was being evaluated; what() starts
+    // with "file:line:col:".
+    struct EvalLimitError : std::runtime_error {
+        SrcLoc loc;
+        EvalLimitError(const SrcLoc& where, const std::string& msg);
+    };
+    struct FuelExhausted : EvalLimitError { using EvalLimitError::EvalLimitError; };
+    struct DeadlineExceeded : EvalLimitError { using EvalLimitError::EvalLimitError; };
+    struct HeapLimitExceeded : EvalLimitError { using EvalLimitError::EvalLimitError; };
+    struct DepthLimitExceeded : EvalLimitError { using EvalLimitError::EvalLimitError; };
+    struct EvalCancelled : EvalLimitError { using EvalLimitError::EvalLimitError; };
+
+    // Set from any thread (or a signal handler) to stop an evaluation that
+    // polls it through EvalContext::cancel. The evaluator checks it on every
+    // function call, the only way MiniML repeats work, and unwinds with
+    // EvalCancelled; everything the run allocated is released on the way out.
+    // A token with a parent is also cancelled when the parent is (parallel
+    // evaluation gives each forked task its own).
+    class CancellationToken {
+    public:
+        explicit CancellationToken(const CancellationToken* parent = nullptr) : parent_(parent) {}
+
+        void cancel() noexcept { flag_.store(true, std::memory_order_relaxed); }
+        bool cancelled() const noexcept {
+            return flag_.load(std::memory_order_relaxed) || (parent_ && parent_->cancelled());
+        }
+        void reset() noexcept { flag_.store(false, std::memory_order_relaxed); }
+
+    private:
+        std::atomic<bool> flag_{false};
+        const CancellationToken* parent_;
+    };
+
+    // Quotas for one evaluation of untrusted code, checked by eval() when
+    // EvalContext::limits is set. A zero (or unset) limit is off.
+    //
+    // Per node the evaluator only bumps 'steps' and 'depth' and compares them
+    // with precomputed bounds; the clock is read every kClockEvery steps and
+    // the heap is checked when a closure, tuple or frame is allocated.
+    struct EvalLimits {
+        static constexpr std::uint64_t kClockEvery = 1024;
+
+        std::uint64_t fuel = 0;          // evaluated nodes
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+        std::size_t maxHeapBytes = 0;    // live heap closures, tuples and env frames
+        std::size_t maxDepth = 0;        // nested eval calls
+
+        // deadline = now + ms
+        void setTimeout(std::chrono::milliseconds ms) { deadline = std::chrono::steady_clock::now() + ms; }
+
+        // run state
+        std::uint64_t steps = 0;
+        std::size_t depth = 0;
+        std::shared_ptr<HeapCounters> heap = std::make_shared<HeapCounters>();   // unless --stats counts
+
+        void step(const SrcLoc& where) {
+            if (++steps >= nextCheck_) slowStep(where);
+        }
+        void enter(const SrcLoc& where) {
+            if (++depth > maxDepth && maxDepth) tooDeep(where);
+        }
+        void leave() { --depth; }
+        void checkHeap(const HeapCounters& counters, const SrcLoc& where) const {
+            if (maxHeapBytes && counters.liveBytes > static_cast<std::int64_t>(maxHeapBytes)) heapFull(counters, where);
+        }
+
+    private:
+        std::uint64_t nextCheck_ = 0;   // step at which fuel and clock are next looked at
+
+        void slowStep(const SrcLoc& where);
+        [[noreturn]] void tooDeep(const SrcLoc& where);
+        [[noreturn]] void heapFull(const HeapCounters& counters, const SrcLoc& where) const;
+    };
+
+} // namespace miniml
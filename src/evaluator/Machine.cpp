@@ -0,0 +1,170 @@
+#include "Machine.hpp"
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "Eval.hpp"
+#include "Limits.hpp"
+
+namespace miniml {
+
+static std::string where(const SrcLoc& loc) {
+  return loc.file + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.col) + ": ";
+}
+
+// Truth value of a condition or logical operand, as eval() reads it.
+static bool truthy(const Val& v) {
+  if (auto pb = std::get_if<bool>(&v)) return *pb;
+  if (auto pi = std::get_if<long>(&v)) return *pi != 0;
+  return false;
+}
+
+Machine::Machine(ExprPtr e, Ref<EnvV> env, const CancellationToken* cancel)
+    : root_(std::move(e)), cancel_(cancel), expr_(root_.get()), env_(std::move(env)) {}
+
+bool Machine::resume(std::size_t steps) {
+  for (std::size_t i = 0; i < steps; ++i) {
+    if (!expr_ && stack_.empty()) break;   // a value and nothing to return it to
+    ++steps_;
+    if (expr_) evalStep();
+    else returnStep();
+  }
+  done_ = !expr_ && stack_.empty();
+  return done_;
+}
+
+// Control is an expression: produce a value or push a frame and descend.
+void Machine::evalStep() {
+  const Expr& e = *expr_;
+  std::visit([&](const auto& n) {
+    using T = std::decay_t<decltype(n)>;
+    if constexpr (std::is_same_v<T, EVar>) {
+      Val v;
+      if (!env_->get(n.name, v))
+        throw std::runtime_error(where(n.loc) + "runtime: unbound variable '" + n.name + "'");
+      ret(std::move(v));
+    } else if constexpr (std::is_same_v<T, ELitInt>) {
+      ret(static_cast<long>(n.value));
+    } else if constexpr (std::is_same_v<T, ELitBool>) {
+      ret(static_cast<bool>(n.value));
+    } else if constexpr (std::is_same_v<T, ELitTuple>) {
+      if (n.elems.empty()) return ret(newCell<Tuple>());
+      push(K::Tuple, e, newCell<Tuple>(n.elems.size()));
+      enter(*n.elems[0], env_);
+    } else if constexpr (std::is_same_v<T, ELam>) {
+      auto c = newCell<Closure>();
+      c->param = n.param;
+      c->body = n.body;
+      c->env = env_;
+      c->lam = &n;
+      ret(std::move(c));
+    } else if constexpr (std::is_same_v<T, EApp>) {
+      if (cancel_ && cancel_->cancelled()) throw EvalCancelled(n.loc, "runtime: evaluation cancelled");
+      push(K::AppFn, e);
+      enter(*n.fn, env_);
+    } else if constexpr (std::is_same_v<T, EIf>) {
+      push(K::If, e);
+      enter(*n.cond, env_);
+    } else if constexpr (std::is_same_v<T, ELet>) {
+      push(K::Let, e);
+      enter(*n.rhs, env_);
+    } else if constexpr (std::is_same_v<T, EUnOp>) {
+      push(K::Not, e);
+      enter(*n.expr, env_);
+    } else {
+      push(K::BinLhs, e);
+      enter(*n.lhs, env_);
+    }
+  }, e);
+}
+
+// Control is a value: hand it to the innermost frame.
+void Machine::returnStep() {
+  Frame f = std::move(stack_.back());
+  stack_.pop_back();
+  Val v = std::move(value_);
+  switch (f.k) {
+    case K::Tuple: {
+      auto& n = std::get<ELitTuple>(*f.node);
+      auto& t = std::get<Ref<Tuple>>(f.v);
+      t->push(std::move(v));
+      if (t->size() == n.elems.size()) {
+        t->pack();
+        return ret(std::move(f.v));
+      }
+      const Expr& next = *n.elems[t->size()];
+      stack_.push_back(std::move(f));
+      return enter(next, stack_.back().env);
+    }
+    case K::AppFn: {
+      auto& n = std::get<EApp>(*f.node);
+      env_ = std::move(f.env);
+      push(K::AppArg, *f.node, std::move(v));
+      return enter(*n.arg, env_);
+    }
+    case K::AppArg: {
+      auto clo = std::get_if<Ref<Closure>>(&f.v);
+      if (!clo) throw std::runtime_error(where(std::get<EApp>(*f.node).loc) + "runtime: trying to call a non-function");
+      const Closure& c = **clo;
+      auto frame = newCell<EnvV>();
+      frame->name = c.param;
+      frame->value = std::move(v);
+      frame->parent = c.env;
+      return enter(*c.body, std::move(frame));   // a tail call: nothing left to do here
+    }
+    case K::If: {
+      auto& n = std::get<EIf>(*f.node);
+      if (!std::get_if<bool>(&v) && !std::get_if<long>(&v)) throw std::runtime_error("runtime: non-boolean condition");
+      return enter(truthy(v) ? *n.thenE : *n.elseE, std::move(f.env));
+    }
+    case K::Let: {
+      auto& n = std::get<ELet>(*f.node);
+      auto frame = newCell<EnvV>();
+      frame->name = n.name;
+      frame->value = std::move(v);
+      frame->parent = std::move(f.env);
+      return enter(*n.body, std::move(frame));
+    }
+    case K::Not: {
+      if (!std::get_if<bool>(&v) && !std::get_if<long>(&v)) throw std::runtime_error("runtime: invalid operand to 'not'");
+      return ret(!truthy(v));
+    }
+    case K::BinLhs: {
+      auto& n = std::get<EBinOp>(*f.node);
+      if (n.op == BinOp::And && !truthy(v)) return ret(false);
+      if (n.op == BinOp::Or && truthy(v)) return ret(true);
+      env_ = std::move(f.env);
+      push(K::BinRhs, *f.node, std::move(v));
+      return enter(*n.rhs, env_);
+    }
+    case K::BinRhs: {
+      auto& n = std::get<EBinOp>(*f.node);
+      const Val& lv = f.v;
+      switch (n.op) {
+        case BinOp::Eq: return ret(compareVals(lv, v, n.loc));
+        case BinOp::Neq: return ret(!compareVals(lv, v, n.loc));
+        case BinOp::And:
+        case BinOp::Or: return ret(truthy(v));   // the left operand did not decide
+        default: break;
+      }
+      auto asInt = [&](const Val& x) -> long {
+        if (auto p = std::get_if<long>(&x)) return *p;
+        throw std::runtime_error(where(n.loc) + "runtime: expected Int");
+      };
+      long x = asInt(lv), y = asInt(v);
+      switch (n.op) {
+        case BinOp::Add: return ret(intAdd(x, y));
+        case BinOp::Sub: return ret(intSub(x, y));
+        case BinOp::Mul: return ret(intMul(x, y));
+        case BinOp::Div: return ret(intDiv(x, y));
+        case BinOp::Lt: return ret(x < y);
+        case BinOp::Le: return ret(x <= y);
+        case BinOp::Gt: return ret(x > y);
+        case BinOp::Ge: return ret(x >= y);
+        default: return ret(0L);
+      }
+    }
+  }
+}
+
+} // namespace miniml
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Value.hpp"
+
+namespace miniml {
+
+    class CancellationToken;
+
+    // Resumable evaluator: a CEK machine over the same AST and values as
+    // eval(). The control (an expression or a value), the environment and the
+    // continuation (an explicit stack of frames) are all data, so evaluation
+    // can stop after any step and continue later, on any thread.
+    //
+    // Results and error messages are those of eval(). Calls in tail position
+    // push no frame, and nothing runs on the native stack, so depth is bounded
+    // only by memory. Everything is heap allocated (escape analysis is not used).
+    class Machine {
+    public:
+        Machine(ExprPtr e, Ref<EnvV> env, const CancellationToken* cancel = nullptr);
+
+        // Runs at most 'steps' transitions; true once the result is available.
+        // Throws what eval() would (EvalCancelled when 'cancel' fires, polled on
+        // every call); the machine cannot be resumed after that.
+        bool resume(std::size_t steps);
+
+        bool done() const { return done_; }
+        const Val& result() const { return value_; }
+        std::uint64_t steps() const { return steps_; }
+
+    private:
+        enum class K { Tuple, AppFn, AppArg, If, Let, Not, BinLhs, BinRhs };
+
+        // What to do with the next value: the node it belongs to, the
+        // environment to continue in and what was computed so far.
+        struct Frame {
+            K k;
+            const Expr* node;
+            Ref<EnvV> env;
+            Val v;                  // AppArg: the function, BinRhs: the left operand,
+                                    // Tuple: the tuple, with the elements so far
+        };
+
+        ExprPtr root_;
+        const CancellationToken* cancel_;
+        const Expr* expr_;             // control: an expression to evaluate in env_ ...
+        Ref<EnvV> env_;
+        Val value_;                    // ... or, when expr_ is null, a value to return
+        std::vector<Frame> stack_;
+        bool done_ = false;
+        std::uint64_t steps_ = 0;
+
+        void evalStep();
+        void returnStep();
+        void enter(const Expr& e, Ref<EnvV> env) { expr_ = &e; env_ = std::move(env); }
+        void ret(Val v) { expr_ = nullptr; value_ = std::move(v); }
+        void push(K k, const Expr& node, Val v = {}) { stack_.push_back(Frame{k, &node, env_, std::move(v)}); }
+    };
+
+} // namespace miniml
@@ -0,0 +1,129 @@
+#include "Memo.hpp"
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include "Profiler.hpp"
+
+namespace miniml {
+
+static std::size_t mix(std::size_t h, std::size_t v) { return h ^ (v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2)); }
+
+// Structural hash of a value; closures by identity.
+static std::size_t hashVal(const Val& v) {
+  if (auto i = std::get_if<long>(&v)) return std::hash<long>()(*i);
+  if (auto b = std::get_if<bool>(&v)) return *b ? 0x51 : 0x50;
+  if (auto c = std::get_if<Ref<Closure>>(&v)) return std::hash<const Closure*>()(c->get());
+  auto& t = *std::get<Ref<Tuple>>(v);
+  std::size_t h = t.size();
+  if (t.flat()) {
+    // as for the boxed elements
+    for (std::size_t i = 0; i < t.size(); ++i)
+      h = mix(h, t.bools() >> i & 1 ? (t.words()[i] ? 0x51 : 0x50) : std::hash<long>()(t.words()[i]));
+    return h;
+  }
+  for (std::size_t i = 0; i < t.size(); ++i) h = mix(h, hashVal(t.vals()[i]));
+  return h;
+}
+
+static bool sameVal(const Val& a, const Val& b) {
+  if (a.index() != b.index()) return false;
+  if (auto i = std::get_if<long>(&a)) return *i == std::get<long>(b);
+  if (auto x = std::get_if<bool>(&a)) return *x == std::get<bool>(b);
+  if (auto c = std::get_if<Ref<Closure>>(&a)) return *c == std::get<Ref<Closure>>(b);
+  auto& s = *std::get<Ref<Tuple>>(a);
+  auto& t = *std::get<Ref<Tuple>>(b);
+  if (s.size() != t.size()) return false;
+  if (s.flat() && t.flat())
+    return s.bools() == t.bools() && std::memcmp(s.words(), t.words(), s.size() * sizeof(long)) == 0;
+  for (std::size_t i = 0; i < s.size(); ++i)
+    if (!sameVal(s.at(i), t.at(i))) return false;
+  return true;
+}
+
+CallMemo::CallMemo(std::size_t capacity, std::uint64_t hotCalls)
+    : capacity_(capacity ? capacity : 1), hotCalls_(hotCalls) {}
+
+void CallMemo::memoize(const ELam& lam) {
+  std::lock_guard<std::mutex> lock(m_);
+  lambdas_.insert(&lam);
+}
+
+std::size_t CallMemo::memoizeHot(const Profiler& profile, std::size_t top) {
+  auto calls = profile.lambdaCalls();
+  std::lock_guard<std::mutex> lock(m_);
+  std::size_t added = 0;
+  for (std::size_t i = 0; i < calls.size() && i < top; ++i)
+    if (calls[i].lam && lambdas_.insert(calls[i].lam).second) ++added;
+  return added;
+}
+
+bool CallMemo::applies(const ELam& lam) {
+  if (lam.memo) return true;
+  std::lock_guard<std::mutex> lock(m_);
+  if (lambdas_.count(&lam)) return true;
+  if (!hotCalls_ || ++calls_[&lam] < hotCalls_) return false;
+  lambdas_.insert(&lam);
+  calls_.erase(&lam);
+  return true;
+}
+
+std::list<CallMemo::Entry>::iterator CallMemo::lookup(std::size_t hash, const Closure* closure, const Val& arg) {
+  auto [from, to] = index_.equal_range(hash);
+  for (auto it = from; it != to; ++it)
+    if (it->second->closure.get() == closure && sameVal(it->second->arg, arg)) return it->second;
+  return lru_.end();
+}
+
+std::optional<Val> CallMemo::find(const Ref<Closure>& closure, const Val& arg) {
+  std::size_t hash = mix(std::hash<const Closure*>()(closure.get()), hashVal(arg));
+  std::lock_guard<std::mutex> lock(m_);
+  auto it = lookup(hash, closure.get(), arg);
+  if (it == lru_.end()) {
+    ++counters_.misses;
+    return std::nullopt;
+  }
+  ++counters_.hits;
+  lru_.splice(lru_.begin(), lru_, it);
+  return it->result;
+}
+
+void CallMemo::store(const Ref<Closure>& closure, Val arg, Val result) {
+  // other threads may find the entry
+  markShared(Val(closure));
+  markShared(arg);
+  markShared(result);
+  std::size_t hash = mix(std::hash<const Closure*>()(closure.get()), hashVal(arg));
+  std::lock_guard<std::mutex> lock(m_);
+  if (lookup(hash, closure.get(), arg) != lru_.end()) return;   // stored by another thread meanwhile
+  lru_.push_front(Entry{closure, std::move(arg), std::move(result), hash});
+  index_.emplace(hash, lru_.begin());
+  if (lru_.size() <= capacity_) return;
+  auto last = std::prev(lru_.end());
+  auto [from, to] = index_.equal_range(last->hash);
+  for (auto it = from; it != to; ++it) {
+    if (it->second == last) {
+      index_.erase(it);
+      break;
+    }
+  }
+  lru_.pop_back();
+  ++counters_.evictions;
+}
+
+CallMemo::Counters CallMemo::counters() const {
+  std::lock_guard<std::mutex> lock(m_);
+  Counters c = counters_;
+  c.entries = lru_.size();
+  return c;
+}
+
+std::string CallMemo::str() const {
+  auto c = counters();
+  char buf[160];
+  std::snprintf(buf, sizeof buf, "hits: %llu, misses: %llu, evictions: %llu, entries: %zu/%zu\n",
+                static_cast<unsigned long long>(c.hits), static_cast<unsigned long long>(c.misses),
+                static_cast<unsigned long long>(c.evictions), c.entries, capacity_);
+  return buf;
+}
+
+} // namespace miniml
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "Value.hpp"
+
+namespace miniml {
+
+    class Profiler;
+
+    constexpr std::size_t kDefaultMemoEntries = 4096;
+
+    // Results of closure calls, for EvalContext::memo. MiniML functions are
+    // pure, so a call of a closure with an argument equal to that of an
+    // earlier call (as '=' compares, closures by identity) has its result.
+    // Calls are cached for lambdas marked [@memo], lambdas passed to
+    // memoize(), and, with 'hotCalls' set, every lambda from its hotCalls-th
+    // call on.
+    //
+    // Entries are keyed by the closure object and a structural hash of the
+    // argument, and hold on to both. Past 'capacity' entries the least
+    // recently used one is dropped. Calls of closures the evaluator keeps on
+    // the stack are not cached (analyzeEscapes leaves [@memo] ones on the
+    // heap). Thread-safe.
+    class CallMemo {
+    public:
+        struct Counters {
+            std::uint64_t hits = 0;
+            std::uint64_t misses = 0;
+            std::uint64_t evictions = 0;
+            std::size_t entries = 0;
+        };
+
+        explicit CallMemo(std::size_t capacity = kDefaultMemoEntries, std::uint64_t hotCalls = 0);
+        CallMemo(const CallMemo&) = delete;
+        CallMemo& operator=(const CallMemo&) = delete;
+
+        void memoize(const ELam& lam);
+        // Memoizes the 'top' most called lambdas of an earlier profiled run of
+        // the same tree; returns how many it added.
+        std::size_t memoizeHot(const Profiler& profile, std::size_t top);
+
+        // Whether calls of 'lam' go through the cache (counts the call for 'hotCalls').
+        bool applies(const ELam& lam);
+
+        std::optional<Val> find(const Ref<Closure>& closure, const Val& arg);
+        void store(const Ref<Closure>& closure, Val arg, Val result);
+
+        Counters counters() const;
+        std::string str() const;   // human-readable counters
+
+    private:
+        struct Entry {
+            Ref<Closure> closure;
+            Val arg;
+            Val result;
+            std::size_t hash;
+        };
+
+        std::size_t capacity_;
+        std::uint64_t hotCalls_;
+        mutable std::mutex m_;
+        std::list<Entry> lru_;   // most recently used first
+        std::unordered_multimap<std::size_t, std::list<Entry>::iterator> index_;
+        std::unordered_set<const ELam*> lambdas_;
+        std::unordered_map<const ELam*, std::uint64_t> calls_;
+        Counters counters_;
+
+        std::list<Entry>::iterator lookup(std::size_t hash, const Closure* closure, const Val& arg);
+    };
+
+} // namespace miniml
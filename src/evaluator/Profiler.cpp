@@ -0,0 +1,140 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <tuple>
+
+namespace miniml {
+
+static std::pair<SrcLoc, const char*> describe(const Expr& e) {
+  return std::visit([](auto const& n) -> std::pair<SrcLoc, const char*> {
+    using T = std::decay_t<decltype(n)>;
+    const char* kind = "";
+    if constexpr (std::is_same_v<T, EVar>) kind = "var";
+    else if constexpr (std::is_same_v<T, ELitInt>) kind = "int";
+    else if constexpr (std::is_same_v<T, ELitBool>) kind = "bool";
+    else if constexpr (std::is_same_v<T, ELitTuple>) kind = "tuple";
+    else if constexpr (std::is_same_v<T, ELam>) kind = "lambda";
+    else if constexpr (std::is_same_v<T, EApp>) kind = "app";
+    else if constexpr (std::is_same_v<T, ELet>) kind = "let";
+    else if constexpr (std::is_same_v<T, EIf>) kind = "if";
+    else if constexpr (std::is_same_v<T, EUnOp>) kind = "unop";
+    else kind = "binop";
+    return {n.loc, kind};
+  }, e);
+}
+
+static std::string showLoc(const SrcLoc& l) {
+  return l.file + ":" + std::to_string(l.line) + ":" + std::to_string(l.col);
+}
+
+void Profiler::enter(const Expr& e) {
+  auto [it, fresh] = nodes_.try_emplace(&e);
+  Entry& en = it->second;
+  if (fresh) std::tie(en.stats.loc, en.stats.kind) = describe(e);
+  ++en.stats.count;
+  ++en.live;
+  active_.push_back({&en, Clock::now()});
+}
+
+void Profiler::exit() {
+  Active a = active_.back();
+  active_.pop_back();
+  auto incl = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - a.start).count();
+  auto excl = incl - a.childNs;
+  // a node evaluated inside itself (through a closure) counts its outermost visit only
+  if (--a.entry->live == 0) a.entry->stats.inclusiveNs += incl;
+  a.entry->stats.exclusiveNs += excl;
+  paths_[path_].selfNs += excl;
+  if (!active_.empty()) active_.back().childNs += incl;
+}
+
+void Profiler::enterCall(const ELam& lam) {
+  auto [it, fresh] = lambdas_.try_emplace(&lam);
+  if (fresh) {
+    it->second.loc = lam.loc;
+    it->second.lam = &lam;
+  }
+  ++it->second.calls;
+
+  auto& kids = paths_[path_].children;
+  auto k = kids.find(&lam);
+  if (k == kids.end()) {
+    CallPath p;
+    p.name = "lambda_" + std::to_string(lam.loc.line) + "_" + std::to_string(lam.loc.col);
+    p.parent = path_;
+    paths_.push_back(std::move(p));
+    k = paths_[path_].children.emplace(&lam, static_cast<int>(paths_.size()) - 1).first;
+  }
+  path_ = k->second;
+}
+
+void Profiler::exitCall() { path_ = paths_[path_].parent; }
+
+std::vector<Profiler::NodeStats> Profiler::byLocation() const {
+  std::map<std::tuple<std::string, int, int, std::string>, NodeStats> merged;
+  for (auto& [node, e] : nodes_) {
+    auto& s = e.stats;
+    auto& m = merged[{s.loc.file, s.loc.line, s.loc.col, s.kind}];
+    m.loc = s.loc;
+    m.kind = s.kind;
+    m.count += s.count;
+    m.inclusiveNs += s.inclusiveNs;
+    m.exclusiveNs += s.exclusiveNs;
+  }
+  std::vector<NodeStats> out;
+  for (auto& [k, s] : merged) out.push_back(s);
+  std::stable_sort(out.begin(), out.end(),
+                   [](const NodeStats& a, const NodeStats& b) { return a.exclusiveNs > b.exclusiveNs; });
+  return out;
+}
+
+std::vector<Profiler::LambdaStats> Profiler::lambdaCalls() const {
+  std::vector<LambdaStats> out;
+  for (auto& [lam, s] : lambdas_) out.push_back(s);
+  std::sort(out.begin(), out.end(), [](const LambdaStats& a, const LambdaStats& b) {
+    if (a.calls != b.calls) return a.calls > b.calls;
+    return std::tie(a.loc.line, a.loc.col) < std::tie(b.loc.line, b.loc.col);
+  });
+  return out;
+}
+
+std::string Profiler::report(size_t maxRows) const {
+  auto rows = byLocation();
+  std::string out = "      count    incl ms    excl ms  location\n";
+  char buf[64];
+  for (size_t i = 0; i < rows.size() && i < maxRows; ++i) {
+    auto& r = rows[i];
+    std::snprintf(buf, sizeof buf, "%11llu %10.3f %10.3f  ", static_cast<unsigned long long>(r.count),
+                  r.inclusiveNs / 1e6, r.exclusiveNs / 1e6);
+    out += buf + showLoc(r.loc) + " " + r.kind + "\n";
+  }
+  if (rows.size() > maxRows) out += "  ... " + std::to_string(rows.size() - maxRows) + " more locations\n";
+
+  auto calls = lambdaCalls();
+  if (!calls.empty()) {
+    out += "Closure calls:\n";
+    for (auto& c : calls) {
+      std::snprintf(buf, sizeof buf, "%11llu  ", static_cast<unsigned long long>(c.calls));
+      out += buf + showLoc(c.loc) + "\n";
+    }
+  }
+  return out;
+}
+
+std::string Profiler::folded() const {
+  std::string out;
+  for (size_t i = 0; i < paths_.size(); ++i) {
+    if (paths_[i].selfNs <= 0) continue;
+    std::vector<const std::string*> names;
+    for (int p = static_cast<int>(i); p >= 0; p = paths_[p].parent) names.push_back(&paths_[p].name);
+    for (auto it = names.rbegin(); it != names.rend(); ++it) {
+      if (it != names.rbegin()) out += ';';
+      out += **it;
+    }
+    out += " " + std::to_string(paths_[i].selfNs) + "\n";
+  }
+  return out;
+}
+
+} // namespace miniml
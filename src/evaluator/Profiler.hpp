@@ -0,0 +1,85 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../ast/Nodes.hpp"
+
+namespace miniml {
+
+    // Per-node evaluation profile, filled by eval() when EvalContext::profiler
+    // is set. Times are inclusive (the node and everything it evaluates) and
+    // exclusive (minus the nodes it evaluates itself).
+    class Profiler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct NodeStats {
+            SrcLoc loc;
+            const char* kind = "";
+            std::uint64_t count = 0;
+            std::int64_t inclusiveNs = 0;
+            std::int64_t exclusiveNs = 0;
+        };
+
+        struct LambdaStats {
+            SrcLoc loc;
+            const ELam* lam = nullptr;
+            std::uint64_t calls = 0;
+        };
+
+        // Bracket the evaluation of one node / one closure call (see Scope, CallScope).
+        void enter(const Expr& e);
+        void exit();
+        void enterCall(const ELam& lam);
+        void exitCall();
+
+        struct Scope {
+            Profiler& p;
+            Scope(Profiler& prof, const Expr& e) : p(prof) { p.enter(e); }
+            ~Scope() { p.exit(); }
+        };
+        struct CallScope {
+            Profiler& p;
+            CallScope(Profiler& prof, const ELam& lam) : p(prof) { p.enterCall(lam); }
+            ~CallScope() { p.exitCall(); }
+        };
+
+        // Nodes aggregated by source location, most exclusive time first.
+        std::vector<NodeStats> byLocation() const;
+        // Lambdas by number of calls, most called first.
+        std::vector<LambdaStats> lambdaCalls() const;
+
+        // Human-readable report (top 'maxRows' locations).
+        std::string report(size_t maxRows = 25) const;
+
+        // Folded stacks ("main;lambda_3_9;lambda_4_12 <ns>"), one line per
+        // call path, for flamegraph.pl / speedscope / inferno.
+        std::string folded() const;
+
+    private:
+        struct Entry {
+            NodeStats stats;
+            int live = 0;   // visits of this node currently on the stack
+        };
+        struct Active {
+            Entry* entry;
+            Clock::time_point start;
+            std::int64_t childNs = 0;
+        };
+        struct CallPath {
+            std::string name;
+            int parent = -1;
+            std::unordered_map<const ELam*, int> children;
+            std::int64_t selfNs = 0;
+        };
+
+        std::unordered_map<const Expr*, Entry> nodes_;
+        std::unordered_map<const ELam*, LambdaStats> lambdas_;
+        std::vector<Active> active_;
+        std::vector<CallPath> paths_{CallPath{"main"}};
+        int path_ = 0;
+    };
+
+} // namespace miniml
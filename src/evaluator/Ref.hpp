@@ -0,0 +1,132 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Stats.hpp"
+
+namespace miniml {
+
+    // Header of the evaluator's heap objects (closures, tuples, environment
+    // frames, thunks), counted by Ref. The count is a plain integer: an object
+    // is only touched by the thread that made it until markShared() flags it
+    // for other threads, after which it is counted atomically. Borrowed
+    // objects live in a C++ frame (see analyzeEscapes), which holds their
+    // first reference: they are counted like the others, but never freed.
+    struct RcObject {
+        std::uint32_t rc = 1;
+        bool shared = false;
+        bool borrowed = false;
+        std::uint32_t bytes = 0;                  // reported to 'counters'
+        std::shared_ptr<HeapCounters> counters;   // set when allocated while counting
+    };
+
+    // Ref's slow path: drops the reference to a shared 'p', or frees 'p'
+    // (keeping it in Cells<T>) after its last one went. Defined in Eval.cpp
+    // for the object types of Value.hpp, out of line so that destroying a Val
+    // stays small enough to inline.
+    template <class T> void release(T* p) noexcept;
+
+    // Owning pointer to an RcObject. Copies add a reference, moves do not.
+    template <class T>
+    class Ref {
+    public:
+        Ref() = default;
+        Ref(std::nullptr_t) noexcept {}
+        Ref(const Ref& o) noexcept : p_(o.p_) { retain(); }
+        Ref(Ref&& o) noexcept : p_(std::exchange(o.p_, nullptr)) {}
+        Ref& operator=(Ref o) noexcept {
+            std::swap(p_, o.p_);
+            return *this;
+        }
+        ~Ref() { release(); }
+
+        // Takes over the reference 'p' was created with.
+        static Ref adopt(T* p) {
+            Ref r;
+            r.p_ = p;
+            return r;
+        }
+
+        T* get() const { return p_; }
+        T& operator*() const { return *p_; }
+        T* operator->() const { return p_; }
+        explicit operator bool() const { return p_ != nullptr; }
+        void reset() noexcept { Ref().swap(*this); }
+        void swap(Ref& o) noexcept { std::swap(p_, o.p_); }
+
+        // References to the object; 0 for a borrowed one.
+        long use_count() const {
+            if (!p_ || p_->borrowed) return 0;
+            if (!p_->shared) return p_->rc;
+            return std::atomic_ref<std::uint32_t>(p_->rc).load(std::memory_order_relaxed);
+        }
+
+        friend bool operator==(const Ref& a, const Ref& b) { return a.p_ == b.p_; }
+
+    private:
+        T* p_ = nullptr;
+
+        void retain() const noexcept {
+            if (!p_) return;
+            if (!p_->shared) ++p_->rc;
+            else std::atomic_ref<std::uint32_t>(p_->rc).fetch_add(1, std::memory_order_relaxed);
+        }
+        void release() noexcept {
+            if (p_ && (p_->shared || --p_->rc == 0)) miniml::release(p_);
+        }
+    };
+
+    // Dead objects a thread keeps for its next allocations of the same shape
+    // (T::shape(), below T::kShapes; a tuple's is its arity), so the cell of a
+    // short-lived object, a tuple's elements included, is reused in place
+    // instead of going back to malloc. At most kKeep per shape.
+    template <class T>
+    class Cells {
+    public:
+        static constexpr std::size_t kKeep = 256;
+
+        static T* take(std::size_t shape) {
+            if (gone_ || shape >= T::kShapes) return nullptr;
+            auto& cells = pool_.cells[shape];
+            if (cells.empty()) return nullptr;
+            T* p = cells.back();
+            cells.pop_back();
+            p->rc = 1;
+            return p;
+        }
+        static bool keep(T* p) {
+            std::size_t shape = p->shape();
+            if (gone_ || shape >= T::kShapes || pool_.cells[shape].size() >= kKeep) return false;
+            pool_.cells[shape].push_back(p);
+            return true;
+        }
+
+    private:
+        struct Pool {
+            std::vector<T*> cells[T::kShapes];
+            ~Pool() {
+                gone_ = true;
+                for (auto& shape : cells) for (T* p : shape) delete p;
+            }
+        };
+        static inline thread_local Pool pool_;
+        static inline thread_local bool gone_ = false;   // after thread exit began
+    };
+
+    // An object with one reference: a cell of 'shape' this thread kept, or a
+    // new one. '*reused' tells which.
+    template <class T>
+    Ref<T> newCell(std::size_t shape = 0, bool* reused = nullptr) {
+        T* p = Cells<T>::take(shape);
+        if (reused) *reused = p != nullptr;
+        if (!p) {
+            if constexpr (requires { T::make(shape); }) p = T::make(shape);   // storage sized by shape
+            else p = new T();
+        }
+        return Ref<T>::adopt(p);
+    }
+
+} // namespace miniml
@@ -0,0 +1,134 @@
+#include "Scheduler.hpp"
+#include <algorithm>
+#include "Limits.hpp"
+#include "Machine.hpp"
+
+namespace miniml {
+
+struct Scheduler::Task {
+  Scheduler* owner;
+  SrcLoc loc;                  // reported when cancelled between slices
+  CancellationToken token;
+  Machine machine;
+  std::mutex run;              // held while steps run, by a worker or Handle::resume
+  std::mutex m;
+  std::condition_variable cv;
+  std::atomic<bool> finished{false};
+  std::exception_ptr error;
+
+  Task(Scheduler* s, ExprPtr e, Ref<EnvV> env)
+      : owner(s), loc(std::visit([](const auto& n) { return n.loc; }, *e)),
+        machine(std::move(e), std::move(env), &token) {}
+};
+
+// ------- Handle -------
+
+bool Scheduler::Handle::done() const {
+  return t_->finished.load(std::memory_order_acquire);
+}
+
+Val Scheduler::Handle::get() const {
+  std::unique_lock<std::mutex> lock(t_->m);
+  t_->cv.wait(lock, [&] { return t_->finished.load(); });
+  if (t_->error) std::rethrow_exception(t_->error);
+  return t_->machine.result();
+}
+
+void Scheduler::Handle::cancel() const {
+  t_->token.cancel();
+  std::unique_lock<std::mutex> run(t_->run, std::try_to_lock);
+  if (run.owns_lock() && !done())
+    t_->owner->finish(*t_, std::make_exception_ptr(EvalCancelled(t_->loc, "runtime: evaluation cancelled")));
+}
+
+bool Scheduler::Handle::resume(std::size_t steps) const {
+  // a finished task may have outlived its scheduler: leave 'owner' alone
+  if (done()) return true;
+  std::unique_lock<std::mutex> run(t_->run, std::try_to_lock);
+  if (!run.owns_lock() || done()) return done();
+  return t_->owner->runSlice(*t_, steps);
+}
+
+// ------- Scheduler -------
+
+Scheduler::Scheduler(unsigned threads, std::size_t slice) : slice_(slice) {
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned i = 0; i < threads; ++i) workers_.emplace_back([this] { work(); });
+}
+
+Scheduler::~Scheduler() {
+  {
+    std::lock_guard<std::mutex> lock(m_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (auto& w : workers_) w.join();
+  for (auto& t : runQueue_) {
+    std::lock_guard<std::mutex> run(t->run);
+    if (!t->finished) finish(*t, std::make_exception_ptr(EvalCancelled(t->loc, "runtime: evaluation cancelled")));
+  }
+}
+
+Scheduler::Handle Scheduler::submit(ExprPtr e, Ref<EnvV> env) {
+  if (env) markShared(*env);   // slices run on any worker, next to other tasks
+  auto t = std::make_shared<Task>(this, std::move(e), std::move(env));
+  inFlight_.fetch_add(1, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(m_);
+    runQueue_.push_back(t);
+  }
+  cv_.notify_one();
+  return Handle(std::move(t));
+}
+
+void Scheduler::finish(Task& t, std::exception_ptr error) {
+  {
+    std::lock_guard<std::mutex> lock(t.m);
+    t.error = std::move(error);
+    t.finished.store(true, std::memory_order_release);
+  }
+  t.cv.notify_all();
+  inFlight_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// Called with t.run held.
+bool Scheduler::runSlice(Task& t, std::size_t steps) {
+  if (t.finished) return true;
+  slices_.fetch_add(1, std::memory_order_relaxed);
+  try {
+    if (!t.machine.resume(steps)) return false;
+    markShared(t.machine.result());   // for whichever threads hold a Handle
+    finish(t, nullptr);
+  } catch (...) {
+    finish(t, std::current_exception());
+  }
+  return true;
+}
+
+void Scheduler::work() {
+  for (;;) {
+    std::shared_ptr<Task> t;
+    {
+      std::unique_lock<std::mutex> lock(m_);
+      cv_.wait(lock, [&] { return stop_ || !runQueue_.empty(); });
+      if (stop_) return;
+      t = std::move(runQueue_.front());
+      runQueue_.pop_front();
+    }
+    bool done;
+    {
+      std::unique_lock<std::mutex> run(t->run, std::try_to_lock);
+      if (run.owns_lock()) {
+        done = runSlice(*t, slice_);
+      } else {   // a Handle is running it: come back to it later
+        done = t->finished;
+        std::this_thread::yield();
+      }
+    }
+    if (done) continue;
+    std::lock_guard<std::mutex> lock(m_);
+    runQueue_.push_back(std::move(t));
+  }
+}
+
+} // namespace miniml
@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Value.hpp"
+
+namespace miniml {
+
+    // Interleaves many evaluations on a few threads. Each evaluation is a
+    // Machine; a worker takes the oldest runnable one, runs it for one time
+    // slice (a number of machine steps) and puts it at the back of the run
+    // queue, so a long evaluation never holds a thread that short ones are
+    // waiting for.
+    class Scheduler {
+        struct Task;
+
+    public:
+        // Handle on one submitted evaluation; copies refer to the same one.
+        // A handle may outlive the Scheduler: ~Scheduler finishes every
+        // evaluation, and a finished one no longer touches its scheduler.
+        class Handle {
+        public:
+            // Finished, with a value or an error.
+            bool done() const;
+            // Waits until finished; returns the value or rethrows the error
+            // (EvalCancelled after cancel()).
+            Val get() const;
+            // Stops the evaluation at its next call, or now if it is between slices.
+            void cancel() const;
+            // Runs up to 'steps' steps on the calling thread, unless a worker is
+            // running the evaluation; returns done().
+            bool resume(std::size_t steps) const;
+
+        private:
+            friend class Scheduler;
+            explicit Handle(std::shared_ptr<Task> t) : t_(std::move(t)) {}
+            std::shared_ptr<Task> t_;
+        };
+
+        // 'threads' workers (0: one per hardware thread); 'slice' machine steps per turn.
+        explicit Scheduler(unsigned threads = 0, std::size_t slice = kDefaultSlice);
+        // Cancels what has not finished.
+        ~Scheduler();
+        Scheduler(const Scheduler&) = delete;
+        Scheduler& operator=(const Scheduler&) = delete;
+
+        static constexpr std::size_t kDefaultSlice = 4096;
+
+        Handle submit(ExprPtr e, Ref<EnvV> env);
+
+        unsigned threads() const { return static_cast<unsigned>(workers_.size()); }
+        std::size_t inFlight() const { return inFlight_.load(std::memory_order_relaxed); }
+        std::uint64_t slices() const { return slices_.load(std::memory_order_relaxed); }
+
+    private:
+        std::size_t slice_;
+        std::mutex m_;
+        std::condition_variable cv_;
+        std::deque<std::shared_ptr<Task>> runQueue_;
+        bool stop_ = false;
+        std::vector<std::thread> workers_;
+        std::atomic<std::size_t> inFlight_{0};
+        std::atomic<std::uint64_t> slices_{0};
+
+        void work();
+        void finish(Task& t, std::exception_ptr error);
+        bool runSlice(Task& t, std::size_t steps);
+    };
+
+} // namespace miniml
@@ -0,0 +1,72 @@
+#include "Stats.hpp"
+#include <cstdio>
+
+namespace miniml {
+
+static const char* const kKindNames[] = {"closures", "tuples", "env_frames", "thunks"};
+
+static double averageHops(const EvalStats& s) {
+  return s.lookups ? static_cast<double>(s.lookupHops) / static_cast<double>(s.lookups) : 0.0;
+}
+
+std::string EvalStats::str() const {
+  std::string out = "heap allocations      count   reused        bytes\n";
+  char buf[128];
+  std::uint64_t count = 0, reused = 0, bytes = 0;
+  for (int k = 0; k < kHeapKinds; ++k) {
+    auto& pk = heap->kinds[k];
+    std::snprintf(buf, sizeof buf, "  %-14s %10llu %8llu %12llu\n", kKindNames[k],
+                  static_cast<unsigned long long>(pk.count), static_cast<unsigned long long>(pk.reused),
+                  static_cast<unsigned long long>(pk.bytes));
+    out += buf;
+    count += pk.count;
+    reused += pk.reused;
+    bytes += pk.bytes;
+  }
+  std::snprintf(buf, sizeof buf, "  %-14s %10llu %8llu %12llu\n", "total",
+                static_cast<unsigned long long>(count), static_cast<unsigned long long>(reused),
+                static_cast<unsigned long long>(bytes));
+  out += buf;
+  std::snprintf(buf, sizeof buf, "peak live bytes:  %lld\n", static_cast<long long>(heap->peakLiveBytes));
+  out += buf;
+  std::snprintf(buf, sizeof buf, "on the stack:     %llu closures, %llu tuples, %llu env frames\n",
+                static_cast<unsigned long long>(stackClosures), static_cast<unsigned long long>(stackTuples),
+                static_cast<unsigned long long>(stackFrames));
+  out += buf;
+  if (heap->kinds[static_cast<int>(HeapKind::Thunk)].count) {
+    std::snprintf(buf, sizeof buf, "thunks forced:    %llu\n", static_cast<unsigned long long>(thunksForced));
+    out += buf;
+  }
+  std::snprintf(buf, sizeof buf, "env lookups:      %llu (avg chain walk %.2f, max %zu)\n",
+                static_cast<unsigned long long>(lookups), averageHops(*this), maxLookupHops);
+  out += buf;
+  std::snprintf(buf, sizeof buf, "max eval depth:   %zu\n", maxDepth);
+  return out + buf;
+}
+
+std::string EvalStats::json() const {
+  std::string out = "{\"heap\":{";
+  char buf[160];
+  for (int k = 0; k < kHeapKinds; ++k) {
+    auto& pk = heap->kinds[k];
+    std::snprintf(buf, sizeof buf, "%s\"%s\":{\"count\":%llu,\"reused\":%llu,\"bytes\":%llu}", k ? "," : "",
+                  kKindNames[k], static_cast<unsigned long long>(pk.count), static_cast<unsigned long long>(pk.reused),
+                  static_cast<unsigned long long>(pk.bytes));
+    out += buf;
+  }
+  std::snprintf(buf, sizeof buf, "},\"peak_live_bytes\":%lld,", static_cast<long long>(heap->peakLiveBytes));
+  out += buf;
+  std::snprintf(buf, sizeof buf, "\"stack\":{\"closures\":%llu,\"tuples\":%llu,\"env_frames\":%llu},",
+                static_cast<unsigned long long>(stackClosures), static_cast<unsigned long long>(stackTuples),
+                static_cast<unsigned long long>(stackFrames));
+  out += buf;
+  std::snprintf(buf, sizeof buf, "\"thunks_forced\":%llu,", static_cast<unsigned long long>(thunksForced));
+  out += buf;
+  std::snprintf(buf, sizeof buf, "\"env_lookups\":{\"count\":%llu,\"avg_hops\":%.3f,\"max_hops\":%zu},",
+                static_cast<unsigned long long>(lookups), averageHops(*this), maxLookupHops);
+  out += buf;
+  std::snprintf(buf, sizeof buf, "\"max_eval_depth\":%zu}", maxDepth);
+  return out + buf;
+}
+
+} // namespace miniml
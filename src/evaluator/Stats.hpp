@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace miniml {
+
+    enum class HeapKind { Closure, Tuple, Env, Thunk };
+    constexpr int kHeapKinds = 4;
+
+    // Heap traffic of evaluator objects. Shared with every object allocated
+    // while counting, so frees after the run are still accounted for.
+    struct HeapCounters {
+        struct PerKind {
+            std::uint64_t count = 0;
+            std::uint64_t bytes = 0;
+            std::uint64_t reused = 0;   // of 'count', built in a dead object's cell (no malloc)
+        };
+        PerKind kinds[kHeapKinds];          // indexed by HeapKind
+        std::int64_t liveBytes = 0;
+        std::int64_t peakLiveBytes = 0;
+
+        const PerKind& operator[](HeapKind k) const { return kinds[static_cast<int>(k)]; }
+
+        void onAlloc(HeapKind k, std::size_t bytes, bool reused = false) {
+            auto& pk = kinds[static_cast<int>(k)];
+            ++pk.count;
+            if (reused) ++pk.reused;
+            pk.bytes += bytes;
+            liveBytes += static_cast<std::int64_t>(bytes);
+            if (liveBytes > peakLiveBytes) peakLiveBytes = liveBytes;
+        }
+        void onFree(std::size_t bytes) { liveBytes -= static_cast<std::int64_t>(bytes); }
+    };
+
+    // What one evaluation did, filled by eval() when EvalContext::stats is set.
+    struct EvalStats {
+        std::shared_ptr<HeapCounters> heap = std::make_shared<HeapCounters>();
+
+        // objects analyzeEscapes let the evaluator keep on the stack
+        std::uint64_t stackClosures = 0;
+        std::uint64_t stackTuples = 0;
+        std::uint64_t stackFrames = 0;
+
+        std::uint64_t thunksForced = 0;    // of the HeapKind::Thunk ones (lazy runs)
+
+        // variable lookups and how many frames they walked up the environment chain
+        std::uint64_t lookups = 0;
+        std::uint64_t lookupHops = 0;
+        std::size_t maxLookupHops = 0;
+
+        std::size_t depth = 0;      // current nesting of eval calls
+        std::size_t maxDepth = 0;
+
+        std::string str() const;    // human-readable table
+        std::string json() const;   // one JSON object
+    };
+
+} // namespace miniml
@@ -1,35 +1,185 @@
 #pragma once
+#include <cstdint>
 #include <memory>
+#include <new>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <variant>
 #include "../ast/Nodes.hpp"
+#include "Ref.hpp"
 
 namespace miniml {
     using Val = std::variant<
         long,
         bool,
-        std::shared_ptr<struct Closure>,
-        std::shared_ptr<struct Tuple>>;
+        Ref<struct Closure>,
+        Ref<struct Tuple>,
+        Ref<struct Thunk>>;   // only with EvalContext::lazy
 
-    struct EnvV {
+    // One frame of the environment chain. Let and call frames hold a single
+    // binding inline ('name'/'value'); 'm' is for frames with several (prelude).
+    struct EnvV : RcObject {
         std::unordered_map<std::string, Val> m;
-        std::shared_ptr<EnvV> parent;
+        std::string name;
+        Val value;
+        Ref<EnvV> parent;
         bool get(const std::string& k, Val& out) const {
-            if (auto it = m.find(k); it != m.end()) { out = it->second; return true; }
-            return parent ? parent->get(k, out) : false;
+            for (const EnvV* e = this; e; e = e->parent.get()) {
+                if (!e->name.empty() && e->name == k) { out = e->value; return true; }
+                if (auto it = e->m.find(k); it != e->m.end()) { out = it->second; return true; }
+            }
+            return false;
+        }
+        // Moves the value of 'k' out of its let or call frame, for its last
+        // read (EVar::lastUse); frames with several bindings are copied from.
+        bool take(const std::string& k, Val& out) {
+            for (EnvV* e = this; e; e = e->parent.get()) {
+                if (!e->name.empty() && e->name == k) {
+                    out = std::move(e->value);
+                    e->value = 0L;
+                    return true;
+                }
+                if (auto it = e->m.find(k); it != e->m.end()) { out = it->second; return true; }
+            }
+            return false;
+        }
+
+        static constexpr std::size_t kShapes = 1;
+        std::size_t shape() const { return 0; }
+        void reset() {
+            m.clear();
+            value = 0L;
+            parent.reset();
         }
     };
 
-    struct Closure {
+    struct Closure : RcObject {
         std::string param;
         ExprPtr body;
-        std::shared_ptr<EnvV> env;  // captured
+        Ref<EnvV> env;              // captured
+        bool frameEscapes = true;   // from ELam: false lets calls use a stack frame
+        const ELam* lam = nullptr;  // creating lambda (profiling); valid while the AST is alive
+
+        static constexpr std::size_t kShapes = 1;
+        std::size_t shape() const { return 0; }
+        void reset() {
+            body.reset();
+            env.reset();
+        }
+    };
+
+    // A tuple, its elements stored inline after this header, in the same
+    // allocation. A tuple whose elements are all Ints and Bools (at most
+    // kMaxFlat of them) is flat once pack()ed: the elements are unboxed words,
+    // Bools as 0 and 1, with 'bools()' marking which ones are Bools, so equal
+    // flat tuples are equal word for word. Other tuples hold Vals.
+    struct Tuple : RcObject {
+        static constexpr std::size_t kMaxFlat = 64;
+
+        std::size_t size() const { return size_; }
+        bool flat() const { return flat_; }
+        const long* words() const { return reinterpret_cast<const long*>(this + 1); }   // flat()
+        std::uint64_t bools() const { return bools_; }                                 // flat()
+        Val* vals() { return reinterpret_cast<Val*>(this + 1); }                       // !flat()
+        const Val* vals() const { return reinterpret_cast<const Val*>(this + 1); }
+        Val at(std::size_t i) const {
+            if (!flat_) return vals()[i];
+            if (bools_ >> i & 1) return words()[i] != 0;
+            return words()[i];
+        }
+
+        // Building one: push() the elements of a new cell (or resize() it and
+        // assign them), then pack() it.
+        void push(Val v) { new (vals() + size_++) Val(std::move(v)); }
+        void resize(std::size_t n) {
+            while (size_ < n) new (vals() + size_++) Val();
+        }
+        void pack() {
+            if (size_ > kMaxFlat) return;
+            std::uint64_t bools = 0;
+            for (std::size_t i = 0; i < size_; ++i) {
+                const Val& v = vals()[i];
+                if (std::holds_alternative<bool>(v)) bools |= std::uint64_t(1) << i;
+                else if (!std::holds_alternative<long>(v)) return;
+            }
+            // word i only overlaps values before it, already unboxed
+            for (std::size_t i = 0; i < size_; ++i) {
+                Val& v = vals()[i];
+                long w = bools >> i & 1 ? long(std::get<bool>(v)) : std::get<long>(v);
+                v.~Val();
+                new (reinterpret_cast<long*>(this + 1) + i) long(w);
+            }
+            flat_ = true;
+            bools_ = bools;
+        }
+
+        // A cell with room for 'capacity' elements.
+        static Tuple* make(std::size_t capacity) {
+            return new (::operator new(sizeof(Tuple) + capacity * sizeof(Val))) Tuple(capacity);
+        }
+        static void operator delete(void* p) { ::operator delete(p); }
+        ~Tuple() { reset(); }
+
+        // cells are reused for tuples of the same arity
+        static constexpr std::size_t kShapes = 9;
+        std::size_t shape() const { return capacity_; }
+        void reset() {
+            if (!flat_) std::destroy_n(vals(), size_);
+            size_ = 0;
+            flat_ = false;
+            bools_ = 0;
+        }
+
+    private:
+        explicit Tuple(std::size_t capacity) : capacity_(static_cast<std::uint32_t>(capacity)) {}
+        friend struct TupleSlot;
+
+        std::uint32_t size_ = 0;
+        std::uint32_t capacity_;
+        bool flat_ = false;
+        std::uint64_t bools_ = 0;
     };
 
-    struct Tuple {
-        std::vector<Val> elements;
+    // Room for a tuple of up to kArity elements in a C++ frame (see
+    // analyzeEscapes); get() builds it on first use.
+    struct TupleSlot {
+        static constexpr std::size_t kArity = 4;
+
+        TupleSlot() = default;
+        TupleSlot(const TupleSlot&) = delete;
+        TupleSlot& operator=(const TupleSlot&) = delete;
+        ~TupleSlot() { if (t_) t_->~Tuple(); }
+        Tuple& get() {
+            if (!t_) t_ = new (bytes_) Tuple(kArity);
+            return *t_;
+        }
+
+    private:
+        alignas(Tuple) unsigned char bytes_[sizeof(Tuple) + kArity * sizeof(Val)];
+        Tuple* t_ = nullptr;
+    };
+
+    // A let-bound value or tuple element of a lazy run, not needed yet.
+    // Forcing it evaluates 'expr' under 'env' once; the value then replaces both.
+    struct Thunk : RcObject {
+        ExprPtr expr;                       // null once forced
+        Ref<EnvV> env;
+        struct EvalContext* ctx = nullptr;  // of the run that created it
+        Val value;
+
+        static constexpr std::size_t kShapes = 1;
+        std::size_t shape() const { return 0; }
+        void reset() {
+            expr.reset();
+            env.reset();
+            value = 0L;
+        }
     };
 
+    // Switches what 'v' (or 'env') reaches to atomic reference counts, before
+    // it is handed to other threads.
+    void markShared(const Val& v);
+    void markShared(EnvV& env);
+
 } // namespace miniml
@@ -0,0 +1,119 @@
+#include "CFG.hpp"
+#include <algorithm>
+
+namespace miniml {
+
+std::vector<int> successors(const IRBlock& b) {
+  switch (b.term.k) {
+    case IRTermKind::Ret: return {};
+    case IRTermKind::Jmp: return {b.term.target};
+    case IRTermKind::Br:  return {b.term.target, b.term.otherwise};
+  }
+  return {};
+}
+
+std::vector<std::vector<int>> predecessors(const IRFunc& f) {
+  std::vector<std::vector<int>> preds(f.blocks.size());
+  for (size_t b = 0; b < f.blocks.size(); ++b)
+    for (int s : successors(f.blocks[b])) preds[s].push_back(static_cast<int>(b));
+  return preds;
+}
+
+std::vector<int> reversePostorder(const IRFunc& f) {
+  std::vector<int> order;
+  std::vector<char> seen(f.blocks.size(), 0);
+  // iterative DFS; the second stack entry field is the next successor to visit
+  std::vector<std::pair<int, size_t>> stack{{0, 0}};
+  seen[0] = 1;
+  while (!stack.empty()) {
+    auto& [b, i] = stack.back();
+    auto succ = successors(f.blocks[b]);
+    if (i < succ.size()) {
+      int s = succ[i++];
+      if (!seen[s]) { seen[s] = 1; stack.emplace_back(s, 0); }
+    } else {
+      order.push_back(b);
+      stack.pop_back();
+    }
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+// Cooper, Harvey & Kennedy, "A Simple, Fast Dominance Algorithm".
+std::vector<int> immediateDominators(const IRFunc& f) {
+  auto rpo = reversePostorder(f);
+  auto preds = predecessors(f);
+  std::vector<int> index(f.blocks.size(), -1);
+  for (size_t i = 0; i < rpo.size(); ++i) index[rpo[i]] = static_cast<int>(i);
+
+  std::vector<int> idom(f.blocks.size(), -1);
+  idom[0] = 0;
+  auto intersect = [&](int a, int b) {
+    while (a != b) {
+      while (index[a] > index[b]) a = idom[a];
+      while (index[b] > index[a]) b = idom[b];
+    }
+    return a;
+  };
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (size_t i = 1; i < rpo.size(); ++i) {
+      int b = rpo[i], nd = -1;
+      for (int p : preds[b]) {
+        if (idom[p] < 0) continue;
+        nd = nd < 0 ? p : intersect(p, nd);
+      }
+      if (nd != idom[b]) { idom[b] = nd; changed = true; }
+    }
+  }
+  return idom;
+}
+
+bool dominates(const std::vector<int>& idom, int a, int b) {
+  if (idom[b] < 0) return false;
+  for (;;) {
+    if (a == b) return true;
+    if (b == idom[b]) return false;   // reached the entry
+    b = idom[b];
+  }
+}
+
+int removeUnreachableBlocks(IRFunc& f) {
+  auto rpo = reversePostorder(f);
+  if (rpo.size() == f.blocks.size()) return 0;
+
+  std::vector<int> remap(f.blocks.size(), -1);
+  for (int b : rpo) remap[b] = 0;
+  int next = 0, removed = 0;
+  for (size_t b = 0; b < f.blocks.size(); ++b) {
+    if (remap[b] < 0) removed += static_cast<int>(f.blocks[b].body.size());
+    else remap[b] = next++;
+  }
+
+  std::vector<IRBlock> kept;
+  kept.reserve(next);
+  for (size_t b = 0; b < f.blocks.size(); ++b) {
+    if (remap[b] < 0) continue;
+    IRBlock blk = std::move(f.blocks[b]);
+    if (blk.term.target >= 0)    blk.term.target = remap[blk.term.target];
+    if (blk.term.otherwise >= 0) blk.term.otherwise = remap[blk.term.otherwise];
+    for (auto& in : blk.body) {
+      if (in.op != IROp::Phi) continue;
+      size_t w = 0;
+      for (size_t i = 0; i < in.preds.size(); ++i) {
+        if (remap[in.preds[i]] < 0) continue;   // edge from a dead block
+        in.args[w] = in.args[i];
+        in.preds[w] = remap[in.preds[i]];
+        ++w;
+      }
+      in.args.resize(w);
+      in.preds.resize(w);
+    }
+    kept.push_back(std::move(blk));
+  }
+  f.blocks = std::move(kept);
+  return removed;
+}
+
+} // namespace miniml
@@ -0,0 +1,36 @@
+#pragma once
+#include <vector>
+#include "IR.hpp"
+
+namespace miniml {
+
+    // Successor blocks of a block, in terminator order (Br: taken first).
+    std::vector<int> successors(const IRBlock& b);
+
+    // preds[b] lists one entry per incoming edge of block b.
+    std::vector<std::vector<int>> predecessors(const IRFunc& f);
+
+    // Blocks reachable from the entry, in reverse postorder.
+    std::vector<int> reversePostorder(const IRFunc& f);
+
+    // Immediate dominator of every block (entry maps to itself, unreachable blocks to -1).
+    std::vector<int> immediateDominators(const IRFunc& f);
+
+    // Does block 'a' dominate block 'b'?
+    bool dominates(const std::vector<int>& idom, int a, int b);
+
+    // Drop blocks not reachable from the entry and renumber the rest, fixing
+    // terminators and phi inputs. Returns the number of instructions dropped.
+    int removeUnreachableBlocks(IRFunc& f);
+
+    // Call fn(Temp&) on every temp read by the function (instruction args and terminators).
+    template <class Fn>
+    void forEachUse(IRFunc& f, Fn fn) {
+        for (auto& b : f.blocks) {
+            for (auto& in : b.body)
+                for (auto& a : in.args) fn(a);
+            if (b.term.k != IRTermKind::Jmp) fn(b.term.value);
+        }
+    }
+
+} // namespace miniml
@@ -0,0 +1,95 @@
+#include "IR.hpp"
+#include <sstream>
+
+namespace miniml {
+
+static std::string tmp(Temp t) { return "%t" + std::to_string(t); }
+
+static const char* binName(BinOp op) {
+    switch (op) {
+        case BinOp::Add: return "add";
+        case BinOp::Sub: return "sub";
+        case BinOp::Mul: return "mul";
+        case BinOp::Div: return "div";
+        case BinOp::Eq:  return "eq";
+        case BinOp::Neq: return "neq";
+        case BinOp::Lt:  return "lt";
+        case BinOp::Le:  return "le";
+        case BinOp::Gt:  return "gt";
+        case BinOp::Ge:  return "ge";
+        case BinOp::And: return "and";
+        case BinOp::Or:  return "or";
+    }
+    return "?";
+}
+
+std::string IRInstr::str() const {
+    std::ostringstream os;
+    os << tmp(dst) << " = ";
+    switch (op) {
+        case IROp::Const:   os << "const " << imm; break;
+        case IROp::Bool:    os << "const " << (imm ? "true" : "false"); break;
+        case IROp::Copy:    os << "copy " << tmp(args[0]); break;
+        case IROp::Bin:     os << binName(bop) << " " << tmp(args[0]) << ", " << tmp(args[1]); break;
+        case IROp::Un:      os << "not " << tmp(args[0]); break;
+        case IROp::Param:   os << "param"; break;
+        case IROp::Capture: os << "capture " << imm; break;
+        case IROp::Call:    os << "call " << tmp(args[0]) << " " << tmp(args[1]); break;
+        case IROp::Phi:
+            os << "phi ";
+            for (size_t i = 0; i < args.size(); ++i)
+                os << (i ? ", " : "") << "[" << tmp(args[i]) << ", b" << preds[i] << "]";
+            break;
+        case IROp::Tuple:
+        case IROp::Closure: {
+            if (op == IROp::Tuple) os << "tuple (";
+            else                   os << "closure @" << imm << " [";
+            for (size_t i = 0; i < args.size(); ++i) {
+                if (i) os << ", ";
+                os << tmp(args[i]);
+            }
+            os << (op == IROp::Tuple ? ")" : "]");
+            break;
+        }
+    }
+    return os.str();
+}
+
+std::string IRTerm::str() const {
+    switch (k) {
+        case IRTermKind::Ret: return "ret " + tmp(value);
+        case IRTermKind::Jmp: return "jmp b" + std::to_string(target);
+        case IRTermKind::Br:
+            return "br " + tmp(value) + ", b" + std::to_string(target) + ", b" + std::to_string(otherwise);
+    }
+    return "?";
+}
+
+std::string IRFunc::str() const {
+    std::ostringstream os;
+    os << "func " << name;
+    if (!param.empty()) os << "(" << param << ")";
+    if (!captures.empty()) {
+        os << " captures [";
+        for (size_t i = 0; i < captures.size(); ++i) os << (i ? ", " : "") << captures[i];
+        os << "]";
+    }
+    os << ":\n";
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        os << " b" << b << ":\n";
+        for (auto& in : blocks[b].body) os << "  " << in.str() << "\n";
+        os << "  " << blocks[b].term.str() << "\n";
+    }
+    return os.str();
+}
+
+std::string IRProgram::str() const {
+    std::ostringstream os;
+    for (size_t i = 0; i < funcs.size(); ++i) {
+        if (i) os << "\n";
+        os << "@" << i << " " << funcs[i].str();
+    }
+    return os.str();
+}
+
+} // namespace miniml
@@ -1,97 +1,81 @@
 #pragma once
 #include <string>
 #include <vector>
-#include <optional>
-#include <sstream>
 #include "../ast/Nodes.hpp"
+#include "../types/Type.hpp"
 
 namespace miniml {
 
-enum class IROp { MOVI, ADD, CALL, RET };
+// Three-address IR. Every instruction computes at most one temporary from
+// temporaries (never from nested expressions), so a lowered program is in
+// A-normal form. Control flow only exists between basic blocks.
 
-struct IRValue {
-    bool isImm=false;
-    long imm=0;
-    int temp=-1;
+using Temp = int;   // virtual register, numbered per function
 
-    static IRValue Imm(long v){ IRValue x; x.isImm=true; x.imm=v; return x; }
-    static IRValue Tmp(int t){ IRValue x; x.temp=t; return x; }
-
-    std::string str() const {
-        if (isImm) return "#" + std::to_string(imm);
-        return "%t" + std::to_string(temp);
-    }
+enum class IROp {
+    Const,    // dst = imm                       (Int literal)
+    Bool,     // dst = imm != 0                  (Bool literal)
+    Copy,     // dst = args[0]
+    Bin,      // dst = args[0] <bop> args[1]     (And/Or never appear: lowered to branches)
+    Un,       // dst = <uop> args[0]
+    Tuple,    // dst = (args...)
+    Closure,  // dst = closure @funcs[imm] capturing args...
+    Capture,  // dst = captured value #imm of the running closure
+    Param,    // dst = the argument of the running function
+    Call,     // dst = args[0] args[1]
+    Phi,      // dst = args[i] when control came from block preds[i] (SSA only, leads its block)
 };
 
 struct IRInstr {
     IROp op;
-    IRValue a, b;
+    Temp dst = -1;
+    std::vector<Temp> args;
+    long imm = 0;          // literal value, capture index or function index
+    BinOp bop = BinOp::Add;
+    UnOp uop = UnOp::Not;
+    SrcLoc loc;
+    std::vector<int> preds;  // Phi only: incoming block of each arg
+    TypePtr operandType;     // Bin Eq/Neq only: inferred operand type, when lowered with annotations
 
-    std::string str() const {
-        std::ostringstream os;
-        switch (op){
-            case IROp::MOVI: os << "movi " << a.str() << " -> " << b.str(); break;
-            case IROp::ADD:  os << "add "  << a.str() << ", " << b.str(); break;
-            case IROp::CALL: os << "call " << a.str(); break;
-            case IROp::RET:  os << "ret "  << a.str(); break;
-        }
-        return os.str();
-    }
+    std::string str() const;
 };
 
-struct IRFunc {
-    std::string name = "main";
-    std::vector<IRInstr> body;
+enum class IRTermKind { Ret, Jmp, Br };
+
+// Block terminator. Ret returns 'value'; Jmp goes to 'target';
+// Br goes to 'target' if 'value' is true and to 'otherwise' if not.
+struct IRTerm {
+    IRTermKind k = IRTermKind::Ret;
+    Temp value = -1;
+    int target = -1;
+    int otherwise = -1;
+
+    std::string str() const;
 };
 
-struct IRProgram {
-    std::vector<IRFunc> funcs = {IRFunc{}};
+struct IRBlock {
+    std::vector<IRInstr> body;
+    IRTerm term;
 };
 
-struct IRBuilder {
-    IRProgram& p;
+// One function per lambda (closure conversion), plus the program entry.
+// Blocks are referred to by their index in 'blocks'; block 0 is the entry.
+struct IRFunc {
+    std::string name;
+    std::string param;                  // empty for the program entry
+    std::vector<std::string> captures;  // names of the captured free variables, by index
+    std::vector<IRBlock> blocks;
     int nextTemp = 0;
-    explicit IRBuilder(IRProgram& p): p(p) {}
-    IRValue newTmp(){ return IRValue::Tmp(nextTemp++); }
-    void emit(const IRInstr& i){ p.funcs[0].body.push_back(i); }
-    void bind(IRValue dst, IRValue src){ emit(IRInstr{IROp::MOVI, src, dst}); }
 
-    IRValue gen(const Expr& e){
-        return std::visit([&](auto&& node)->IRValue {
-            using T = std::decay_t<decltype(node)>;
-            if constexpr (std::is_same_v<T, ELitInt>) {
-                auto t = newTmp();
-                bind(t, IRValue::Imm(node.value));
-                return t;
-            } else if constexpr (std::is_same_v<T, EApp>) {
-                auto _ = gen(*node.fn); (void)_; // placeholder for callable
-                auto arg = gen(*node.arg);
-                auto t = newTmp();
-                emit({IROp::CALL, arg, {}});
-                return t;
-            } else if constexpr (std::is_same_v<T, EVar>) {
-                auto t = newTmp();
-                bind(t, IRValue::Imm(0)); // placeholder
-                return t;
-            } else if constexpr (std::is_same_v<T, ELam>) {
-                auto t = newTmp();
-                bind(t, IRValue::Imm(0)); // closures omitted in this toy example
-                return t;
-            } else if constexpr (std::is_same_v<T, ELet>) {
-                auto _ = gen(*node.rhs); (void)_;
-                return gen(*node.body);
-            } else if constexpr (std::is_same_v<T, EIf>) {
-                auto _ = gen(*node.cnd); (void)_;
-                auto t1 = gen(*node.thn);
-                auto t2 = gen(*node.els);
-                return t1.temp>=0 ? t1 : t2;
-            } else {
-                auto t = newTmp();
-                bind(t, IRValue::Imm(0));
-                return t;
-            }
-        }, e.v);
-    }
+    Temp newTemp() { return nextTemp++; }
+    std::string str() const;
+};
+
+struct IRProgram {
+    std::vector<IRFunc> funcs;
+    int entry = 0;                      // index of the function that runs the program
+
+    std::string str() const;
 };
 
 } // namespace miniml
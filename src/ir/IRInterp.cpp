@@ -0,0 +1,152 @@
+#include "IRInterp.hpp"
+#include <stdexcept>
+
+namespace miniml {
+
+[[noreturn]] static void fail(const SrcLoc& loc, const std::string& msg) {
+  throw std::runtime_error(loc.file + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.col) +
+                           ": runtime: " + msg);
+}
+
+static bool equalVals(const IRVal& a, const IRVal& b, const SrcLoc& loc) {
+  if (auto pa = std::get_if<long>(&a)) {
+    if (auto pb = std::get_if<long>(&b)) return *pa == *pb;
+    fail(loc, "expected Int");
+  } else if (auto pa = std::get_if<bool>(&a)) {
+    if (auto pb = std::get_if<bool>(&b)) return *pa == *pb;
+    fail(loc, "expected Bool");
+  } else if (auto pa = std::get_if<std::shared_ptr<IRTuple>>(&a)) {
+    auto pb = std::get_if<std::shared_ptr<IRTuple>>(&b);
+    if (!pb) fail(loc, "expected Tuple");
+    if ((*pa)->elements.size() != (*pb)->elements.size()) fail(loc, "expected Tuples of same size");
+    for (size_t i = 0; i < (*pa)->elements.size(); ++i)
+      if (!equalVals((*pa)->elements[i], (*pb)->elements[i], loc)) return false;
+    return true;
+  } else if (auto pa = std::get_if<std::shared_ptr<IRClosure>>(&a)) {
+    // Closures are equal if they are the same object (pointer equality)
+    if (auto pb = std::get_if<std::shared_ptr<IRClosure>>(&b)) return pa->get() == pb->get();
+    fail(loc, "expected Function");
+  }
+  return false;
+}
+
+static long asInt(const IRVal& v, const SrcLoc& loc) {
+  if (auto p = std::get_if<long>(&v)) return *p;
+  fail(loc, "expected Int");
+}
+
+static bool asBool(const IRVal& v, const SrcLoc& loc) {
+  if (auto p = std::get_if<bool>(&v)) return *p;
+  fail(loc, "expected Bool");
+}
+
+static IRVal binop(BinOp op, const IRVal& l, const IRVal& r, const SrcLoc& loc) {
+  if (op == BinOp::Eq || op == BinOp::Neq) {
+    bool eq = equalVals(l, r, loc);
+    return op == BinOp::Eq ? eq : !eq;
+  }
+  if (op == BinOp::And) return asBool(l, loc) && asBool(r, loc);
+  if (op == BinOp::Or)  return asBool(l, loc) || asBool(r, loc);
+
+  long x = asInt(l, loc), y = asInt(r, loc);
+  switch (op) {
+    case BinOp::Add: return intAdd(x, y);
+    case BinOp::Sub: return intSub(x, y);
+    case BinOp::Mul: return intMul(x, y);
+    case BinOp::Div: return intDiv(x, y);   // same as the tree-walking evaluator
+    case BinOp::Lt:  return x <  y;
+    case BinOp::Le:  return x <= y;
+    case BinOp::Gt:  return x >  y;
+    case BinOp::Ge:  return x >= y;
+    default: break;
+  }
+  return 0L;
+}
+
+static IRVal exec(const IRProgram& prog, int fn, const IRClosure* self, const IRVal* arg) {
+  const IRFunc& f = prog.funcs[fn];
+  std::vector<IRVal> t(f.nextTemp);
+  std::vector<IRVal> incoming;
+  int b = 0, prev = -1;
+  for (;;) {
+    const IRBlock& blk = f.blocks[b];
+    // Phis read their inputs as of the edge we came in on, all at once.
+    size_t nphi = 0;
+    while (nphi < blk.body.size() && blk.body[nphi].op == IROp::Phi) ++nphi;
+    incoming.clear();
+    for (size_t i = 0; i < nphi; ++i) {
+      const IRInstr& phi = blk.body[i];
+      size_t k = 0;
+      while (k < phi.preds.size() && phi.preds[k] != prev) ++k;
+      if (k == phi.preds.size()) fail(phi.loc, "phi has no input for b" + std::to_string(prev));
+      incoming.push_back(t[phi.args[k]]);
+    }
+    for (size_t i = 0; i < nphi; ++i) t[blk.body[i].dst] = std::move(incoming[i]);
+
+    for (size_t i = nphi; i < blk.body.size(); ++i) {
+      const IRInstr& in = blk.body[i];
+      switch (in.op) {
+        case IROp::Const:   t[in.dst] = in.imm; break;
+        case IROp::Bool:    t[in.dst] = in.imm != 0; break;
+        case IROp::Copy:    t[in.dst] = t[in.args[0]]; break;
+        case IROp::Bin:     t[in.dst] = binop(in.bop, t[in.args[0]], t[in.args[1]], in.loc); break;
+        case IROp::Un:      t[in.dst] = !asBool(t[in.args[0]], in.loc); break;
+        case IROp::Param:   t[in.dst] = *arg; break;
+        case IROp::Capture: t[in.dst] = self->captures[in.imm]; break;
+        case IROp::Tuple: {
+          auto tup = std::make_shared<IRTuple>();
+          tup->elements.reserve(in.args.size());
+          for (Temp a : in.args) tup->elements.push_back(t[a]);
+          t[in.dst] = std::move(tup);
+          break;
+        }
+        case IROp::Closure: {
+          auto clo = std::make_shared<IRClosure>();
+          clo->fn = static_cast<int>(in.imm);
+          clo->captures.reserve(in.args.size());
+          for (Temp a : in.args) clo->captures.push_back(t[a]);
+          t[in.dst] = std::move(clo);
+          break;
+        }
+        case IROp::Call: {
+          auto clo = std::get_if<std::shared_ptr<IRClosure>>(&t[in.args[0]]);
+          if (!clo) fail(in.loc, "trying to call a non-function");
+          auto callee = *clo;   // keep the closure alive even if its temp is overwritten
+          t[in.dst] = exec(prog, callee->fn, callee.get(), &t[in.args[1]]);
+          break;
+        }
+        case IROp::Phi:
+          fail(in.loc, "phi after the start of a block");
+      }
+    }
+    prev = b;
+    switch (blk.term.k) {
+      case IRTermKind::Ret: return t[blk.term.value];
+      case IRTermKind::Jmp: b = blk.term.target; break;
+      case IRTermKind::Br:
+        b = asBool(t[blk.term.value], {}) ? blk.term.target : blk.term.otherwise;
+        break;
+    }
+  }
+}
+
+IRVal runIR(const IRProgram& prog) {
+  return exec(prog, prog.entry, nullptr, nullptr);
+}
+
+std::string showIRVal(const IRVal& v) {
+  if (auto i = std::get_if<long>(&v)) return std::to_string(*i);
+  if (auto b = std::get_if<bool>(&v)) return *b ? "true" : "false";
+  if (std::get_if<std::shared_ptr<IRClosure>>(&v)) return "<fun>";
+  if (auto t = std::get_if<std::shared_ptr<IRTuple>>(&v)) {
+    std::string s = "(";
+    for (size_t i = 0; i < (*t)->elements.size(); ++i) {
+      if (i > 0) s += ", ";
+      s += showIRVal((*t)->elements[i]);
+    }
+    return s + ")";
+  }
+  return "<unknown>";
+}
+
+} // namespace miniml
@@ -0,0 +1,33 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+#include "IR.hpp"
+
+namespace miniml {
+
+    // Runtime values of the IR interpreter. Mirrors evaluator/Value.hpp, but a
+    // closure is a function index plus its captured values instead of an AST + env.
+    using IRVal = std::variant<
+        long,
+        bool,
+        std::shared_ptr<struct IRClosure>,
+        std::shared_ptr<struct IRTuple>>;
+
+    struct IRClosure {
+        int fn;                         // index into IRProgram::funcs
+        std::vector<IRVal> captures;
+    };
+
+    struct IRTuple {
+        std::vector<IRVal> elements;
+    };
+
+    // Run the program's entry function and return its result.
+    IRVal runIR(const IRProgram& prog);
+
+    // Same format as showVal(), so both evaluators print identical results.
+    std::string showIRVal(const IRVal& v);
+
+} // namespace miniml
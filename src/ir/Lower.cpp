@@ -0,0 +1,196 @@
+#include "Lower.hpp"
+#include <algorithm>
+
+namespace miniml {
+
+// Free variables of 'e' in first-occurrence order, skipping anything in 'bound'.
+static void freeVars(const Expr& e, std::vector<std::string>& bound, std::vector<std::string>& out) {
+  auto isBound = [&](const std::string& x) { return std::find(bound.begin(), bound.end(), x) != bound.end(); };
+  std::visit([&](auto const& n) {
+    using T = std::decay_t<decltype(n)>;
+    if constexpr (std::is_same_v<T, EVar>) {
+      if (!isBound(n.name) && std::find(out.begin(), out.end(), n.name) == out.end()) out.push_back(n.name);
+    } else if constexpr (std::is_same_v<T, ELitTuple>) {
+      for (auto& el : n.elems) freeVars(*el, bound, out);
+    } else if constexpr (std::is_same_v<T, ELam>) {
+      bound.push_back(n.param);
+      freeVars(*n.body, bound, out);
+      bound.pop_back();
+    } else if constexpr (std::is_same_v<T, EApp>) {
+      freeVars(*n.fn, bound, out);
+      freeVars(*n.arg, bound, out);
+    } else if constexpr (std::is_same_v<T, ELet>) {
+      freeVars(*n.rhs, bound, out);
+      bound.push_back(n.name);
+      freeVars(*n.body, bound, out);
+      bound.pop_back();
+    } else if constexpr (std::is_same_v<T, EIf>) {
+      freeVars(*n.cond, bound, out);
+      freeVars(*n.thenE, bound, out);
+      freeVars(*n.elseE, bound, out);
+    } else if constexpr (std::is_same_v<T, EUnOp>) {
+      freeVars(*n.expr, bound, out);
+    } else if constexpr (std::is_same_v<T, EBinOp>) {
+      freeVars(*n.lhs, bound, out);
+      freeVars(*n.rhs, bound, out);
+    }
+  }, e);
+}
+
+namespace {
+
+// Builds one IRFunc. Nested lambdas get their own builder; the finished
+// function is stored at the index reserved for it in 'prog.funcs'.
+struct FnBuilder {
+  IRProgram& prog;
+  const TypeAnnotations* types;
+  IRFunc f;
+  int cur = 0;
+  std::vector<std::pair<std::string, Temp>> scope;   // innermost binding last
+
+  FnBuilder(IRProgram& p, const TypeAnnotations* t, std::string name) : prog(p), types(t) {
+    f.name = std::move(name);
+    f.blocks.emplace_back();
+  }
+
+  int newBlock() {
+    f.blocks.emplace_back();
+    return static_cast<int>(f.blocks.size()) - 1;
+  }
+
+  Temp emitTo(Temp dst, IRInstr in) {
+    in.dst = dst;
+    f.blocks[cur].body.push_back(std::move(in));
+    return dst;
+  }
+  Temp emit(IRInstr in) { return emitTo(f.newTemp(), std::move(in)); }
+
+  void terminate(IRTerm t) { f.blocks[cur].term = t; }
+
+  Temp lookup(const std::string& name, const SrcLoc& loc) const {
+    for (auto it = scope.rbegin(); it != scope.rend(); ++it)
+      if (it->first == name) return it->second;
+    throw LowerError(loc.file + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.col) +
+                     ": lower: unbound variable '" + name + "'");
+  }
+
+  Temp gen(const Expr& e) {
+    return std::visit([&](auto const& n) -> Temp {
+      using T = std::decay_t<decltype(n)>;
+      if constexpr (std::is_same_v<T, EVar>) {
+        return lookup(n.name, n.loc);
+      } else if constexpr (std::is_same_v<T, ELitInt>) {
+        return emit({IROp::Const, -1, {}, static_cast<long>(n.value), {}, {}, n.loc});
+      } else if constexpr (std::is_same_v<T, ELitBool>) {
+        return emit({IROp::Bool, -1, {}, n.value ? 1L : 0L, {}, {}, n.loc});
+      } else if constexpr (std::is_same_v<T, ELitTuple>) {
+        std::vector<Temp> elems;
+        elems.reserve(n.elems.size());
+        for (auto& el : n.elems) elems.push_back(gen(*el));
+        return emit({IROp::Tuple, -1, std::move(elems), 0, {}, {}, n.loc});
+      } else if constexpr (std::is_same_v<T, ELam>) {
+        return genLam(n);
+      } else if constexpr (std::is_same_v<T, EApp>) {
+        auto fn = gen(*n.fn);
+        auto arg = gen(*n.arg);
+        return emit({IROp::Call, -1, {fn, arg}, 0, {}, {}, n.loc});
+      } else if constexpr (std::is_same_v<T, ELet>) {
+        auto v = gen(*n.rhs);
+        scope.emplace_back(n.name, v);
+        auto r = gen(*n.body);
+        scope.pop_back();
+        return r;
+      } else if constexpr (std::is_same_v<T, EIf>) {
+        auto c = gen(*n.cond);
+        return genBranch(c, n.loc,
+                         [&] { return gen(*n.thenE); },
+                         [&] { return gen(*n.elseE); });
+      } else if constexpr (std::is_same_v<T, EUnOp>) {
+        auto v = gen(*n.expr);
+        return emit({IROp::Un, -1, {v}, 0, {}, n.op, n.loc});
+      } else if constexpr (std::is_same_v<T, EBinOp>) {
+        auto l = gen(*n.lhs);
+        // short-circuit And/Or: the right operand only runs on one branch
+        if (n.op == BinOp::And) {
+          return genBranch(l, n.loc,
+                           [&] { return gen(*n.rhs); },
+                           [&] { return emit({IROp::Bool, -1, {}, 0, {}, {}, n.loc}); });
+        }
+        if (n.op == BinOp::Or) {
+          return genBranch(l, n.loc,
+                           [&] { return emit({IROp::Bool, -1, {}, 1, {}, {}, n.loc}); },
+                           [&] { return gen(*n.rhs); });
+        }
+        auto r = gen(*n.rhs);
+        IRInstr in{IROp::Bin, -1, {l, r}, 0, n.op, {}, n.loc};
+        if (types && (n.op == BinOp::Eq || n.op == BinOp::Neq)) {
+          auto it = types->eqOperands.find(&n);
+          if (it != types->eqOperands.end()) in.operandType = it->second;
+        }
+        return emit(std::move(in));
+      } else {
+        static_assert(sizeof(T) == 0, "Unhandled Expr alternative in lower");
+      }
+    }, e);
+  }
+
+  // br c, then, else; both arms copy their value into one result temp at the join block.
+  template <class ThenFn, class ElseFn>
+  Temp genBranch(Temp c, const SrcLoc& loc, ThenFn genThen, ElseFn genElse) {
+    int thenB = newBlock(), elseB = newBlock(), joinB = newBlock();
+    terminate({IRTermKind::Br, c, thenB, elseB});
+    Temp result = f.newTemp();
+
+    cur = thenB;
+    auto tv = genThen();
+    emitTo(result, {IROp::Copy, -1, {tv}, 0, {}, {}, loc});
+    terminate({IRTermKind::Jmp, -1, joinB, -1});
+
+    cur = elseB;
+    auto ev = genElse();
+    emitTo(result, {IROp::Copy, -1, {ev}, 0, {}, {}, loc});
+    terminate({IRTermKind::Jmp, -1, joinB, -1});
+
+    cur = joinB;
+    return result;
+  }
+
+  Temp genLam(const ELam& n) {
+    std::vector<std::string> bound{n.param}, fv;
+    freeVars(*n.body, bound, fv);
+
+    int idx = static_cast<int>(prog.funcs.size());
+    prog.funcs.emplace_back();   // reserve the slot; nested lambdas are appended after it
+
+    FnBuilder child(prog, types, "lambda_" + std::to_string(n.loc.line) + "_" + std::to_string(n.loc.col));
+    child.f.param = n.param;
+    child.f.captures = fv;
+    child.scope.emplace_back(n.param, child.emit({IROp::Param, -1, {}, 0, {}, {}, n.loc}));
+    for (size_t i = 0; i < fv.size(); ++i)
+      child.scope.emplace_back(fv[i], child.emit({IROp::Capture, -1, {}, static_cast<long>(i), {}, {}, n.loc}));
+    auto r = child.gen(*n.body);
+    child.terminate({IRTermKind::Ret, r, -1, -1});
+    prog.funcs[idx] = std::move(child.f);
+
+    std::vector<Temp> captured;
+    captured.reserve(fv.size());
+    for (auto& x : fv) captured.push_back(lookup(x, n.loc));
+    return emit({IROp::Closure, -1, std::move(captured), idx, {}, {}, n.loc});
+  }
+};
+
+} // namespace
+
+IRProgram lower(const Expr& e, const TypeAnnotations* types) {
+  IRProgram prog;
+  prog.funcs.emplace_back();
+  prog.entry = 0;
+
+  FnBuilder main(prog, types, "main");
+  auto r = main.gen(e);
+  main.terminate({IRTermKind::Ret, r, -1, -1});
+  prog.funcs[0] = std::move(main.f);
+  return prog;
+}
+
+} // namespace miniml
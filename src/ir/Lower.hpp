@@ -0,0 +1,20 @@
+#pragma once
+#include <stdexcept>
+#include "IR.hpp"
+#include "../types/Infer.hpp"
+
+namespace miniml {
+
+    struct LowerError : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    // Lower a (scope-checked) expression to IR. Every lambda becomes its own
+    // IRFunc taking one parameter plus the free variables it captures;
+    // 'if', '&&' and '||' become conditional branches between blocks.
+    // With 'types' (from infer), equality instructions carry their operand type.
+    IRProgram lower(const Expr& e, const TypeAnnotations* types = nullptr);
+
+    inline IRProgram lower(const ExprPtr& e, const TypeAnnotations* types = nullptr) { return lower(*e, types); }
+
+} // namespace miniml
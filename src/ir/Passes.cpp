@@ -0,0 +1,490 @@
+#include "Passes.hpp"
+#include "CFG.hpp"
+#include "SSA.hpp"
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+#include <sstream>
+#include <iomanip>
+
+namespace miniml {
+
+// ---------- shared helpers ----------
+
+// Follow replacement chains (repl[t] == t means "keep t").
+static Temp resolve(std::vector<Temp>& repl, Temp t) {
+  Temp r = t;
+  while (repl[r] != r) r = repl[r];
+  while (repl[t] != r) { Temp n = repl[t]; repl[t] = r; t = n; }
+  return r;
+}
+
+static void applyReplacements(IRFunc& f, std::vector<Temp>& repl) {
+  forEachUse(f, [&](Temp& t) { if (t >= 0) t = resolve(repl, t); });
+}
+
+static std::vector<Temp> identity(const IRFunc& f) {
+  std::vector<Temp> repl(f.nextTemp);
+  for (Temp t = 0; t < f.nextTemp; ++t) repl[t] = t;
+  return repl;
+}
+
+// Drop the instructions whose destination is flagged in 'dead'; returns how many went.
+static int sweep(IRFunc& f, const std::vector<char>& dead) {
+  int removed = 0;
+  for (auto& b : f.blocks) {
+    auto it = std::remove_if(b.body.begin(), b.body.end(), [&](const IRInstr& in) { return dead[in.dst] != 0; });
+    removed += static_cast<int>(b.body.end() - it);
+    b.body.erase(it, b.body.end());
+  }
+  return removed;
+}
+
+// ---------- sparse conditional constant propagation ----------
+
+namespace {
+struct Lattice {
+  enum Kind { Top, Const, Bottom } k = Top;
+  bool isBool = false;
+  long v = 0;
+
+  bool operator==(const Lattice& o) const {
+    return k == o.k && (k != Const || (isBool == o.isBool && v == o.v));
+  }
+};
+
+Lattice constInt(long v)  { return {Lattice::Const, false, v}; }
+Lattice constBool(bool b) { return {Lattice::Const, true, b ? 1L : 0L}; }
+const Lattice kBottom{Lattice::Bottom};
+
+Lattice meet(const Lattice& a, const Lattice& b) {
+  if (a.k == Lattice::Top) return b;
+  if (b.k == Lattice::Top) return a;
+  if (a.k == Lattice::Bottom || b.k == Lattice::Bottom) return kBottom;
+  return a == b ? a : kBottom;
+}
+
+// Folding follows the evaluator exactly; anything ill-typed stays Bottom so
+// the runtime error still happens at run time.
+Lattice foldBin(BinOp op, const Lattice& l, const Lattice& r) {
+  if (l.k == Lattice::Bottom || r.k == Lattice::Bottom) return kBottom;
+  if (l.k == Lattice::Top || r.k == Lattice::Top) return {};
+  if (op == BinOp::Eq || op == BinOp::Neq) {
+    if (l.isBool != r.isBool) return kBottom;
+    return constBool((l.v == r.v) == (op == BinOp::Eq));
+  }
+  if (l.isBool || r.isBool) return kBottom;
+  long x = l.v, y = r.v;
+  switch (op) {
+    case BinOp::Add: return constInt(intAdd(x, y));
+    case BinOp::Sub: return constInt(intSub(x, y));
+    case BinOp::Mul: return constInt(intMul(x, y));
+    case BinOp::Div: return constInt(intDiv(x, y));
+    case BinOp::Lt:  return constBool(x <  y);
+    case BinOp::Le:  return constBool(x <= y);
+    case BinOp::Gt:  return constBool(x >  y);
+    case BinOp::Ge:  return constBool(x >= y);
+    default: return kBottom;
+  }
+}
+} // namespace
+
+PassResult sccp(IRFunc& f) {
+  const int nb = static_cast<int>(f.blocks.size());
+  std::vector<Lattice> val(f.nextTemp);
+
+  // use sites; index -1 stands for the block terminator
+  std::vector<std::vector<std::pair<int, int>>> uses(f.nextTemp);
+  for (int b = 0; b < nb; ++b) {
+    auto& blk = f.blocks[b];
+    for (int i = 0; i < static_cast<int>(blk.body.size()); ++i)
+      for (Temp a : blk.body[i].args) uses[a].emplace_back(b, i);
+    if (blk.term.k != IRTermKind::Jmp) uses[blk.term.value].emplace_back(b, -1);
+  }
+
+  std::vector<char> execBlock(nb, 0);
+  std::set<std::pair<int, int>> execEdge;
+  std::vector<std::pair<int, int>> flowWork{{-1, 0}};
+  std::vector<Temp> ssaWork;
+
+  auto evalInstr = [&](int b, int i) {
+    const IRInstr& in = f.blocks[b].body[i];
+    Lattice nv;
+    switch (in.op) {
+      case IROp::Const: nv = constInt(in.imm); break;
+      case IROp::Bool:  nv = constBool(in.imm != 0); break;
+      case IROp::Copy:  nv = val[in.args[0]]; break;
+      case IROp::Bin:
+        // x = x holds for every value, closures included (they compare by identity)
+        if ((in.bop == BinOp::Eq || in.bop == BinOp::Neq) && in.args[0] == in.args[1])
+          nv = constBool(in.bop == BinOp::Eq);
+        else
+          nv = foldBin(in.bop, val[in.args[0]], val[in.args[1]]);
+        break;
+      case IROp::Un: {
+        auto& a = val[in.args[0]];
+        if (a.k == Lattice::Const) nv = a.isBool ? constBool(a.v == 0) : kBottom;
+        else nv = a;
+        break;
+      }
+      case IROp::Phi:
+        for (size_t k = 0; k < in.args.size(); ++k)
+          if (execEdge.count({in.preds[k], b})) nv = meet(nv, val[in.args[k]]);
+        break;
+      case IROp::Tuple:
+      case IROp::Closure:
+      case IROp::Capture:
+      case IROp::Param:
+      case IROp::Call:
+        nv = kBottom;
+        break;
+    }
+    if (val[in.dst].k == Lattice::Bottom || nv == val[in.dst]) return;
+    val[in.dst] = nv;
+    ssaWork.push_back(in.dst);
+  };
+
+  auto evalTerm = [&](int b) {
+    const IRTerm& t = f.blocks[b].term;
+    if (t.k == IRTermKind::Jmp) {
+      flowWork.emplace_back(b, t.target);
+    } else if (t.k == IRTermKind::Br) {
+      auto& c = val[t.value];
+      if (c.k == Lattice::Const && c.isBool) flowWork.emplace_back(b, c.v ? t.target : t.otherwise);
+      else if (c.k != Lattice::Top) { flowWork.emplace_back(b, t.target); flowWork.emplace_back(b, t.otherwise); }
+    }
+  };
+
+  while (!flowWork.empty() || !ssaWork.empty()) {
+    while (!flowWork.empty()) {
+      auto [p, b] = flowWork.back();
+      flowWork.pop_back();
+      if (p >= 0 && !execEdge.insert({p, b}).second) continue;
+      auto& body = f.blocks[b].body;
+      if (!execBlock[b]) {
+        execBlock[b] = 1;
+        for (int i = 0; i < static_cast<int>(body.size()); ++i) evalInstr(b, i);
+        evalTerm(b);
+      } else {
+        // a new incoming edge can only change the phis
+        for (int i = 0; i < static_cast<int>(body.size()) && body[i].op == IROp::Phi; ++i) evalInstr(b, i);
+      }
+    }
+    while (!ssaWork.empty()) {
+      Temp t = ssaWork.back();
+      ssaWork.pop_back();
+      for (auto [b, i] : uses[t]) {
+        if (!execBlock[b]) continue;
+        if (i < 0) evalTerm(b); else evalInstr(b, i);
+      }
+    }
+  }
+
+  // Rewrite: constant results become literals, decided branches become jumps.
+  PassResult r;
+  for (int b = 0; b < nb; ++b) {
+    if (!execBlock[b]) continue;
+    auto& blk = f.blocks[b];
+    std::vector<IRInstr> phis, consts, rest;
+    for (auto& in : blk.body) {
+      const Lattice& lv = val[in.dst];
+      bool literal = in.op == IROp::Const || in.op == IROp::Bool;
+      if (lv.k == Lattice::Const && !literal) {
+        IRInstr c{lv.isBool ? IROp::Bool : IROp::Const, in.dst, {}, lv.v};
+        c.loc = in.loc;
+        consts.push_back(std::move(c));   // kept after the phis so phis still lead the block
+        r.changed = true;
+        continue;
+      }
+      if (in.op == IROp::Phi) {
+        size_t w = 0;
+        for (size_t k = 0; k < in.args.size(); ++k) {
+          if (!execEdge.count({in.preds[k], b})) { r.changed = true; continue; }
+          in.args[w] = in.args[k];
+          in.preds[w] = in.preds[k];
+          ++w;
+        }
+        in.args.resize(w);
+        in.preds.resize(w);
+        phis.push_back(std::move(in));
+      } else {
+        rest.push_back(std::move(in));
+      }
+    }
+    blk.body = std::move(phis);
+    blk.body.insert(blk.body.end(), std::make_move_iterator(consts.begin()), std::make_move_iterator(consts.end()));
+    blk.body.insert(blk.body.end(), std::make_move_iterator(rest.begin()), std::make_move_iterator(rest.end()));
+
+    if (blk.term.k == IRTermKind::Br) {
+      auto& c = val[blk.term.value];
+      if (c.k == Lattice::Const && c.isBool) {
+        blk.term = {IRTermKind::Jmp, -1, c.v ? blk.term.target : blk.term.otherwise, -1};
+        r.changed = true;
+      }
+    }
+  }
+
+  r.instrsRemoved = removeUnreachableBlocks(f);
+  r.blocksRemoved = nb - static_cast<int>(f.blocks.size());
+  r.changed |= r.blocksRemoved > 0;
+  return r;
+}
+
+// ---------- copy propagation ----------
+
+PassResult copyPropagation(IRFunc& f) {
+  auto repl = identity(f);
+  std::vector<char> dead(f.nextTemp, 0);
+  for (auto& b : f.blocks) {
+    for (auto& in : b.body) {
+      if (in.op == IROp::Copy) {
+        repl[in.dst] = resolve(repl, in.args[0]);
+        dead[in.dst] = 1;
+      } else if (in.op == IROp::Phi) {
+        // a phi whose inputs are all the same temp (or itself) is just that temp
+        Temp only = -1;
+        bool trivial = true;
+        for (Temp a : in.args) {
+          a = resolve(repl, a);
+          if (a == in.dst || a == only) continue;
+          if (only >= 0) { trivial = false; break; }
+          only = a;
+        }
+        if (trivial && only >= 0) {
+          repl[in.dst] = only;
+          dead[in.dst] = 1;
+        }
+      }
+    }
+  }
+  PassResult r;
+  r.instrsRemoved = sweep(f, dead);
+  r.changed = r.instrsRemoved > 0;
+  if (r.changed) applyReplacements(f, repl);
+  return r;
+}
+
+// ---------- common subexpression elimination ----------
+
+PassResult cse(IRFunc& f) {
+  using Key = std::tuple<int, long, int, int, std::vector<Temp>>;
+  auto idom = immediateDominators(f);
+  std::vector<std::vector<int>> children(f.blocks.size());
+  for (size_t b = 1; b < f.blocks.size(); ++b) if (idom[b] >= 0) children[idom[b]].push_back(b);
+
+  auto repl = identity(f);
+  std::vector<char> dead(f.nextTemp, 0);
+  std::map<Key, Temp> available;
+
+  // Closures are compared by identity, so two closure instructions are never interchangeable.
+  auto eligible = [](const IRInstr& in) {
+    return in.op != IROp::Closure && in.op != IROp::Phi && in.op != IROp::Copy;
+  };
+  auto commutative = [](BinOp op) {
+    return op == BinOp::Add || op == BinOp::Mul || op == BinOp::Eq || op == BinOp::Neq;
+  };
+
+  std::function<void(int)> walk = [&](int b) {
+    std::vector<Key> scoped;
+    for (auto& in : f.blocks[b].body) {
+      for (auto& a : in.args) a = resolve(repl, a);
+      if (!eligible(in)) continue;
+      auto args = in.args;
+      if (in.op == IROp::Bin && commutative(in.bop)) std::sort(args.begin(), args.end());
+      Key k{static_cast<int>(in.op), in.imm,
+            in.op == IROp::Bin ? static_cast<int>(in.bop) : 0,
+            in.op == IROp::Un ? static_cast<int>(in.uop) : 0,
+            std::move(args)};
+      auto [it, inserted] = available.emplace(k, in.dst);
+      if (inserted) {
+        scoped.push_back(std::move(k));
+      } else {
+        repl[in.dst] = it->second;
+        dead[in.dst] = 1;
+      }
+    }
+    for (int c : children[b]) walk(c);
+    for (auto& k : scoped) available.erase(k);
+  };
+  walk(0);
+
+  PassResult r;
+  r.instrsRemoved = sweep(f, dead);
+  r.changed = r.instrsRemoved > 0;
+  if (r.changed) applyReplacements(f, repl);
+  return r;
+}
+
+// ---------- dead code elimination ----------
+
+PassResult dce(IRFunc& f) {
+  std::vector<const IRInstr*> def(f.nextTemp, nullptr);
+  for (auto& b : f.blocks)
+    for (auto& in : b.body) def[in.dst] = &in;
+
+  std::vector<char> live(f.nextTemp, 0);
+  std::vector<Temp> work;
+  auto mark = [&](Temp t) { if (!live[t]) { live[t] = 1; work.push_back(t); } };
+  for (auto& b : f.blocks)
+    if (b.term.k != IRTermKind::Jmp) mark(b.term.value);
+  while (!work.empty()) {
+    Temp t = work.back();
+    work.pop_back();
+    if (def[t]) for (Temp a : def[t]->args) mark(a);
+  }
+
+  std::vector<char> dead(f.nextTemp, 0);
+  for (Temp t = 0; t < f.nextTemp; ++t) dead[t] = !live[t];
+  PassResult r;
+  r.instrsRemoved = sweep(f, dead);
+  r.changed = r.instrsRemoved > 0;
+  return r;
+}
+
+// ---------- control-flow simplification ----------
+
+static bool hasPhis(const IRBlock& b) { return !b.body.empty() && b.body.front().op == IROp::Phi; }
+
+// One rewrite per call; the caller re-runs until nothing applies.
+static bool simplifyOnce(IRFunc& f) {
+  const int nb = static_cast<int>(f.blocks.size());
+
+  // br c, X, X  =>  jmp X   (phis in X must agree on both edges)
+  for (int b = 0; b < nb; ++b) {
+    auto& t = f.blocks[b].term;
+    if (t.k != IRTermKind::Br || t.target != t.otherwise) continue;
+    bool agree = true;
+    for (auto& in : f.blocks[t.target].body) {
+      if (in.op != IROp::Phi) break;
+      Temp seen = -1;
+      for (size_t k = 0; k < in.preds.size(); ++k) {
+        if (in.preds[k] != b) continue;
+        if (seen >= 0 && in.args[k] != seen) agree = false;
+        seen = in.args[k];
+      }
+    }
+    if (!agree) continue;
+    for (auto& in : f.blocks[t.target].body) {
+      if (in.op != IROp::Phi) break;
+      auto k = std::find(in.preds.begin(), in.preds.end(), b) - in.preds.begin();
+      auto k2 = std::find(in.preds.begin() + k + 1, in.preds.end(), b) - in.preds.begin();
+      if (k2 < static_cast<long>(in.preds.size())) {
+        in.preds.erase(in.preds.begin() + k2);
+        in.args.erase(in.args.begin() + k2);
+      }
+    }
+    t = {IRTermKind::Jmp, -1, t.target, -1};
+    return true;
+  }
+
+  auto preds = predecessors(f);
+
+  // An empty block that only jumps on is bypassed (unless its target needs to
+  // know the edge for a phi).
+  for (int e = 1; e < nb; ++e) {
+    auto& blk = f.blocks[e];
+    if (!blk.body.empty() || blk.term.k != IRTermKind::Jmp || preds[e].empty()) continue;
+    int target = blk.term.target;
+    if (target == e || hasPhis(f.blocks[target])) continue;
+    for (int p : preds[e]) {
+      auto& t = f.blocks[p].term;
+      if (t.target == e) t.target = target;
+      if (t.otherwise == e) t.otherwise = target;
+    }
+    return true;
+  }
+
+  // A block entered only by an unconditional jump is appended to its predecessor.
+  for (int b = 1; b < nb; ++b) {
+    if (preds[b].size() != 1) continue;
+    int p = preds[b][0];
+    if (p == b || f.blocks[p].term.k != IRTermKind::Jmp) continue;
+    auto& from = f.blocks[b];
+    auto& into = f.blocks[p];
+    for (auto& in : from.body) {
+      if (in.op == IROp::Phi) {   // single incoming edge
+        in.op = IROp::Copy;
+        in.args.resize(1);
+        in.preds.clear();
+      }
+      into.body.push_back(std::move(in));
+    }
+    from.body.clear();
+    into.term = from.term;
+    from.term = {IRTermKind::Jmp, -1, b, -1};   // now unreachable; removed by the caller
+    for (int s : successors(into))
+      for (auto& in : f.blocks[s].body) {
+        if (in.op != IROp::Phi) break;
+        for (auto& q : in.preds) if (q == b) q = p;
+      }
+    return true;
+  }
+  return false;
+}
+
+PassResult simplifyCFG(IRFunc& f) {
+  PassResult r;
+  const int nb0 = static_cast<int>(f.blocks.size());
+  r.instrsRemoved += removeUnreachableBlocks(f);
+  while (simplifyOnce(f)) {
+    r.changed = true;
+    r.instrsRemoved += removeUnreachableBlocks(f);
+  }
+  r.blocksRemoved = nb0 - static_cast<int>(f.blocks.size());
+  r.changed |= r.blocksRemoved > 0;
+  return r;
+}
+
+// ---------- pass manager ----------
+
+std::vector<PassReport> PassManager::run(IRProgram& prog, int maxRounds) const {
+  std::vector<PassReport> reports;
+  for (auto& p : passes_) reports.push_back({p.name, {}, 0});
+
+  for (auto& f : prog.funcs) {
+    toSSA(f);
+    if (verifyEachPass) verifySSA(f);
+    for (int round = 0; round < maxRounds; ++round) {
+      bool changed = false;
+      for (size_t i = 0; i < passes_.size(); ++i) {
+        auto r = passes_[i].fn(f);
+        reports[i].total += r;
+        reports[i].runs++;
+        changed |= r.changed;
+        if (verifyEachPass) {
+          try { verifySSA(f); }
+          catch (const IRVerifyError& e) { throw IRVerifyError("after " + passes_[i].name + ": " + e.what()); }
+        }
+      }
+      if (!changed) break;
+    }
+  }
+  return reports;
+}
+
+PassManager PassManager::standard() {
+  PassManager pm;
+  pm.add("sccp", sccp);
+  pm.add("copyprop", copyPropagation);
+  pm.add("cse", cse);
+  pm.add("dce", dce);
+  pm.add("simplifycfg", simplifyCFG);
+  return pm;
+}
+
+std::string showPassReports(const std::vector<PassReport>& reports) {
+  std::ostringstream os;
+  int total = 0;
+  for (auto& r : reports) {
+    os << std::left << std::setw(12) << r.name
+       << " removed " << r.total.instrsRemoved << " instructions";
+    if (r.total.blocksRemoved) os << ", " << r.total.blocksRemoved << " blocks";
+    os << "\n";
+    total += r.total.instrsRemoved;
+  }
+  os << std::left << std::setw(12) << "total" << " removed " << total << " instructions\n";
+  return os.str();
+}
+
+} // namespace miniml
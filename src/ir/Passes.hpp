@@ -0,0 +1,61 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+#include "IR.hpp"
+
+namespace miniml {
+
+    // What a single pass did to one function.
+    struct PassResult {
+        int instrsRemoved = 0;
+        int blocksRemoved = 0;
+        bool changed = false;   // also true for rewrites that remove nothing (e.g. folding)
+
+        PassResult& operator+=(const PassResult& o) {
+            instrsRemoved += o.instrsRemoved;
+            blocksRemoved += o.blocksRemoved;
+            changed |= o.changed;
+            return *this;
+        }
+    };
+
+    // Totals for one pass over a whole PassManager::run.
+    struct PassReport {
+        std::string name;
+        PassResult total;
+        int runs = 0;
+    };
+
+    // The passes expect SSA form (see toSSA). All of them treat every
+    // instruction as pure, which holds for MiniML: a Call can only compute a value.
+    PassResult sccp(IRFunc& f);             // sparse conditional constant propagation
+    PassResult copyPropagation(IRFunc& f);  // removes copies and trivial phis
+    PassResult cse(IRFunc& f);              // dominator-scoped common subexpression elimination
+    PassResult dce(IRFunc& f);              // drops instructions whose result is never used
+    PassResult simplifyCFG(IRFunc& f);      // folds trivial branches, merges and drops blocks
+
+    class PassManager {
+    public:
+        using PassFn = std::function<PassResult(IRFunc&)>;
+
+        void add(std::string name, PassFn fn) { passes_.push_back({std::move(name), std::move(fn)}); }
+
+        // Run verifySSA after every pass (slow; meant for tests and debugging).
+        bool verifyEachPass = false;
+
+        // Convert every function to SSA, then run the pipeline until nothing
+        // changes or 'maxRounds' is reached. One report per pass, in pipeline order.
+        std::vector<PassReport> run(IRProgram& prog, int maxRounds = 4) const;
+
+        // sccp, copyprop, cse, dce, simplifycfg
+        static PassManager standard();
+
+    private:
+        struct Entry { std::string name; PassFn fn; };
+        std::vector<Entry> passes_;
+    };
+
+    std::string showPassReports(const std::vector<PassReport>& reports);
+
+} // namespace miniml
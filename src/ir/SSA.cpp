@@ -0,0 +1,171 @@
+#include "SSA.hpp"
+#include "CFG.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace miniml {
+
+void toSSA(IRFunc& f) {
+  removeUnreachableBlocks(f);
+
+  const int nvars = f.nextTemp;
+  std::vector<int> defCount(nvars, 0);
+  for (auto& b : f.blocks)
+    for (auto& in : b.body) ++defCount[in.dst];
+  std::vector<char> multi(nvars, 0);
+  bool any = false;
+  for (int t = 0; t < nvars; ++t) if (defCount[t] > 1) multi[t] = any = true;
+  if (!any) return;
+
+  auto preds = predecessors(f);
+  auto idom = immediateDominators(f);
+  const size_t nb = f.blocks.size();
+
+  // dominance frontiers
+  std::vector<std::vector<int>> df(nb);
+  for (size_t b = 0; b < nb; ++b) {
+    if (preds[b].size() < 2) continue;
+    for (int p : preds[b]) {
+      for (int r = p; r != idom[b]; r = idom[r]) {
+        if (std::find(df[r].begin(), df[r].end(), static_cast<int>(b)) == df[r].end()) df[r].push_back(b);
+      }
+    }
+  }
+
+  // blocks where 'v' is live on entry: a use not preceded by a definition in
+  // the same block, propagated backwards through blocks that do not define it
+  auto liveIn = [&](int v) {
+    std::vector<char> live(nb, 0), defines(nb, 0);
+    std::vector<int> work;
+    for (size_t b = 0; b < nb; ++b) {
+      auto& blk = f.blocks[b];
+      bool exposed = false;
+      for (auto& in : blk.body) {
+        if (!defines[b] && std::find(in.args.begin(), in.args.end(), v) != in.args.end()) exposed = true;
+        if (in.dst == v) defines[b] = 1;
+      }
+      if (!defines[b] && blk.term.k != IRTermKind::Jmp && blk.term.value == v) exposed = true;
+      if (exposed) { live[b] = 1; work.push_back(b); }
+    }
+    while (!work.empty()) {
+      int b = work.back(); work.pop_back();
+      for (int p : preds[b])
+        if (!live[p] && !defines[p]) { live[p] = 1; work.push_back(p); }
+    }
+    return live;
+  };
+
+  // phi placement on the iterated dominance frontier of each variable's
+  // definitions, pruned to the blocks where the variable is live: a temp
+  // defined by an if nested in one branch of another if has no definition on
+  // the other path into the outer join and must not get a phi there
+  for (int v = 0; v < nvars; ++v) {
+    if (!multi[v]) continue;
+    auto live = liveIn(v);
+    std::vector<int> work;
+    std::vector<char> hasPhi(nb, 0), queued(nb, 0);
+    for (size_t b = 0; b < nb; ++b)
+      for (auto& in : f.blocks[b].body)
+        if (in.dst == v && !queued[b]) { queued[b] = 1; work.push_back(b); }
+    while (!work.empty()) {
+      int b = work.back(); work.pop_back();
+      for (int d : df[b]) {
+        if (hasPhi[d] || !live[d]) continue;
+        hasPhi[d] = 1;
+        IRInstr phi{IROp::Phi, v, std::vector<Temp>(preds[d].size(), v)};
+        phi.preds = preds[d];
+        auto& body = f.blocks[d].body;
+        body.insert(body.begin(), std::move(phi));
+        if (!queued[d]) { queued[d] = 1; work.push_back(d); }
+      }
+    }
+  }
+
+  // renaming along the dominator tree
+  std::vector<std::vector<int>> children(nb);
+  for (size_t b = 1; b < nb; ++b) if (idom[b] >= 0) children[idom[b]].push_back(b);
+  std::vector<std::vector<Temp>> stack(nvars);
+  auto top = [&](Temp v) {
+    if (stack[v].empty())
+      throw IRVerifyError("toSSA: %t" + std::to_string(v) + " used before any definition in " + f.name);
+    return stack[v].back();
+  };
+
+  std::function<void(int)> rename = [&](int b) {
+    std::vector<Temp> pushed;
+    auto& blk = f.blocks[b];
+    for (auto& in : blk.body) {
+      if (in.op != IROp::Phi)
+        for (auto& a : in.args) if (a < nvars && multi[a]) a = top(a);
+      if (in.dst < nvars && multi[in.dst]) {
+        Temp fresh = f.newTemp();
+        stack[in.dst].push_back(fresh);
+        pushed.push_back(in.dst);
+        in.dst = fresh;
+      }
+    }
+    if (blk.term.k != IRTermKind::Jmp && blk.term.value < nvars && multi[blk.term.value])
+      blk.term.value = top(blk.term.value);
+
+    for (int s : successors(blk)) {
+      for (auto& in : f.blocks[s].body) {
+        if (in.op != IROp::Phi) break;
+        for (size_t i = 0; i < in.preds.size(); ++i)
+          if (in.preds[i] == b && in.args[i] < nvars && multi[in.args[i]]) in.args[i] = top(in.args[i]);
+      }
+    }
+    for (int c : children[b]) rename(c);
+    for (Temp v : pushed) stack[v].pop_back();
+  };
+  rename(0);
+}
+
+void verifySSA(const IRFunc& f) {
+  auto fail = [&](const std::string& msg) { throw IRVerifyError(f.name + ": " + msg); };
+  auto idom = immediateDominators(f);
+  auto preds = predecessors(f);
+
+  std::vector<int> defBlock(f.nextTemp, -1), defIndex(f.nextTemp, -1);
+  for (size_t b = 0; b < f.blocks.size(); ++b) {
+    bool phis = true;
+    for (size_t i = 0; i < f.blocks[b].body.size(); ++i) {
+      auto& in = f.blocks[b].body[i];
+      if (in.dst < 0 || in.dst >= f.nextTemp) fail("bad destination %t" + std::to_string(in.dst));
+      if (defBlock[in.dst] >= 0) fail("%t" + std::to_string(in.dst) + " defined twice");
+      defBlock[in.dst] = static_cast<int>(b);
+      defIndex[in.dst] = static_cast<int>(i);
+      if (in.op == IROp::Phi && !phis) fail("phi after a non-phi in b" + std::to_string(b));
+      if (in.op != IROp::Phi) phis = false;
+    }
+  }
+
+  auto checkUse = [&](Temp t, int b, int i) {
+    if (t < 0 || t >= f.nextTemp || defBlock[t] < 0) fail("use of undefined %t" + std::to_string(t));
+    bool ok = defBlock[t] == b ? defIndex[t] < i : dominates(idom, defBlock[t], b);
+    if (!ok) fail("definition of %t" + std::to_string(t) + " does not dominate its use in b" + std::to_string(b));
+  };
+
+  for (size_t b = 0; b < f.blocks.size(); ++b) {
+    if (idom[b] < 0) continue;   // unreachable code is not checked
+    auto& blk = f.blocks[b];
+    for (size_t i = 0; i < blk.body.size(); ++i) {
+      auto& in = blk.body[i];
+      if (in.op == IROp::Phi) {
+        if (in.preds.size() != in.args.size()) fail("malformed phi %t" + std::to_string(in.dst));
+        for (size_t k = 0; k < in.args.size(); ++k) {
+          int p = in.preds[k];
+          if (std::find(preds[b].begin(), preds[b].end(), p) == preds[b].end())
+            fail("phi %t" + std::to_string(in.dst) + " names b" + std::to_string(p) + " which is no predecessor");
+          // the input must be available at the end of the predecessor
+          checkUse(in.args[k], p, static_cast<int>(f.blocks[p].body.size()));
+        }
+      } else {
+        for (Temp a : in.args) checkUse(a, static_cast<int>(b), static_cast<int>(i));
+      }
+    }
+    if (blk.term.k != IRTermKind::Jmp)
+      checkUse(blk.term.value, static_cast<int>(b), static_cast<int>(blk.body.size()));
+  }
+}
+
+} // namespace miniml
@@ -0,0 +1,23 @@
+#pragma once
+#include <stdexcept>
+#include "IR.hpp"
+
+namespace miniml {
+
+    struct IRVerifyError : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    // Put a function into SSA form: every temp assigned in more than one place
+    // (lowering does this for the result of if/&&/||) is split into one temp
+    // per definition, joined by phis on the iterated dominance frontier where
+    // the temp is live (pruned SSA).
+    void toSSA(IRFunc& f);
+
+    inline void toSSA(IRProgram& p) { for (auto& f : p.funcs) toSSA(f); }
+
+    // Throws IRVerifyError unless every temp has exactly one definition that
+    // dominates all of its uses and phis only lead their blocks.
+    void verifySSA(const IRFunc& f);
+
+} // namespace miniml
@@ -11,7 +11,7 @@ expr
 
 letExpr     : LET ID EQ expr IN expr ;
 ifExpr      : IF expr THEN expr ELSE expr ;
-lamExpr     : LAMBDA ID ARROW expr ;
+lamExpr     : MEMO? LAMBDA ID ARROW expr ;
 
 orExpr      : andExpr (OR andExpr)* ;
 andExpr     : eqExpr (AND eqExpr)* ;
@@ -47,6 +47,7 @@ ELSE        : 'else' ;
 TRUE        : 'true';
 FALSE       : 'false';
 LAMBDA      : '\\' ;
+MEMO        : '[@memo]' ;
 ARROW       : '->' ;
 NOT         : 'not';
 
@@ -1,17 +1,77 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <new>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 #include "parser/parse_to_ast.hpp"
 #include "semantic/ScopeCheck.hpp"   // hvis du valgte mappen "semantic/"
+#include "semantic/Escape.hpp"
+#include "semantic/LastUse.hpp"
+#include "semantic/Parallel.hpp"
 #include "types/Type.hpp"
 #include "evaluator/Eval.hpp"       // eval(...) + showVal(...)
+#include "evaluator/Limits.hpp"
+#include "evaluator/Memo.hpp"
+#include "evaluator/Profiler.hpp"
+#include "evaluator/Stats.hpp"
 #include "types/Scheme.hpp"
 #include "types/Unify.hpp"
+#include "types/Constraints.hpp"
 #include "types/Infer.hpp"
 #include "types/Pretty.hpp"
+#include "ir/Lower.hpp"
+#include "ir/IRInterp.hpp"
+#include "ir/Passes.hpp"
+#include "backends/c/CBackend.hpp"
+#include "utils/PhaseTimer.hpp"
+#include "utils/WorkStealingPool.hpp"
+#include "driver/Batch.hpp"
+#include "driver/CompileCache.hpp"
+#include "driver/Server.hpp"
+#ifdef MINIML_HAVE_LLVM
+#include "backends/llvm/LLVMBackend.hpp"
+#endif
 // (ellers "scope/ScopeCheck.hpp")
 
+// Allocation counting for --time-phases. Only the compiler driver replaces
+// the global operator new; the library just reads the totals.
+static bool g_countAllocs = false;
+static std::atomic<std::uint64_t> g_allocCount{0}, g_allocBytes{0};
+
+void* operator new(std::size_t n) {
+    if (g_countAllocs) {
+        g_allocCount.fetch_add(1, std::memory_order_relaxed);
+        g_allocBytes.fetch_add(n, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"   // GCC pairs free() with new, not with malloc above
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// Ctrl-C during eval cancels the run instead of killing the process
+static miniml::CancellationToken g_interrupt;
+extern "C" void onInterrupt(int) { g_interrupt.cancel(); }
+
+static miniml::AllocCounts allocCounts() {
+    return {g_allocCount.load(std::memory_order_relaxed), g_allocBytes.load(std::memory_order_relaxed)};
+}
+
 static std::string readAll(const char* path) {
     std::ifstream in(path);
     if (!in) throw std::runtime_error(std::string("Cannot open file: ") + path);
@@ -20,40 +80,335 @@ static std::string readAll(const char* path) {
 
 int main(int argc, char** argv) {
     try {
+        // Flags: --emit-ir prints the lowered IR, --eval-ir runs the IR interpreter instead of eval,
+        // -O runs the SSA optimization pipeline on the IR first.
+        // Native code (LLVM builds only): --emit-llvm prints LLVM IR, --emit-obj <file> writes
+        // an object file, -o <exe> links a standalone executable against runtime/miniml_rt.c.
+        // --emit-c <file> writes portable C instead (no LLVM needed); with -o it is linked as well.
+        // --profile[=<file>] profiles eval: report on stdout, folded stacks to <file> (profile.folded)
+        // --stats[=json] reports eval allocations, peak live bytes, env chain walks and depth
+        // --time-phases[=<file>] reports wall/CPU time, allocations and RSS growth per compiler
+        // phase on stdout, and writes the same as JSON to <file>
+        // --fuel=<n>, --timeout=<ms>, --max-heap=<bytes>, --max-depth=<n> bound eval; a run
+        // that hits one exits with status 3; Ctrl-C during eval unwinds it and exits with 130
+        // --serve[=<socket>] answers RUN/STATS/QUIT requests on stdin (or a Unix domain socket)
+        // with a warm pipeline and an LRU result cache of --cache-size=<n> entries (256)
+        // --cache-dir=<dir> keeps parsed, checked and typed programs on disk; a hit skips
+        // the parser, scope check and inference
+        // --parallel[=<threads>] evaluates independent costly subexpressions on a work-stealing
+        // pool; --fork-threshold=<n> sets the estimated cost (AST nodes) worth a task
+        // --infer=constraints type-checks by constraint generation and solving instead of
+        // algorithm W (--infer=w); with --parallel, constraints are generated on the pool too
+        // --memo[=<entries>] caches calls of [@memo] lambdas in an LRU cache of <entries> (4096);
+        // --memo-hot=<calls> caches those of any lambda from its <calls>-th call on
+        // --lazy evaluates let right-hand sides and tuple elements only when needed (call-by-need)
+        // Several files, or --manifest=<file> listing them, are checked and evaluated on -j<n>
+        // (--jobs=<n>) threads; outputs come in file order, followed by a summary with per-file
+        // phase timings. The exit status is 1 if any file failed.
+        bool emitIR = false, evalIR = false, optimize = false, emitLLVM = false, profile = false;
+        bool stats = false, statsJson = false, timePhases = false, serve = false;
+        std::string socketPath, cacheDir;
+        std::size_t cacheSize = 256;
+        std::size_t maxRequestBytes = miniml::CompileServer::kDefaultMaxRequestBytes;
+        bool parallel = false, constraintInfer = false;
+        bool memo = false, lazy = false;
+        std::size_t memoEntries = miniml::kDefaultMemoEntries;
+        std::uint64_t memoHot = 0;
+        unsigned threads = 0;
+        std::size_t forkThreshold = miniml::kDefaultForkThreshold;
+        std::string objPath, exePath, cPath, foldedPath = "profile.folded", phasesPath;
+        miniml::EvalLimits limits;
+        bool limited = false;
+        long timeoutMs = 0;
+        std::vector<std::string> paths;
+        std::string manifest;
+        unsigned jobs = 0;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("missing argument for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--emit-ir") emitIR = true;
+            else if (arg == "--eval-ir") evalIR = true;
+            else if (arg == "-O") optimize = true;
+            else if (arg == "--emit-llvm") emitLLVM = true;
+            else if (arg == "--emit-obj") objPath = value();
+            else if (arg == "-o") exePath = value();
+            else if (arg == "--emit-c") cPath = value();
+            else if (arg == "--profile") profile = true;
+            else if (arg.rfind("--profile=", 0) == 0) { profile = true; foldedPath = arg.substr(10); }
+            else if (arg == "--stats") stats = true;
+            else if (arg == "--stats=json") stats = statsJson = true;
+            else if (arg == "--time-phases") timePhases = true;
+            else if (arg.rfind("--time-phases=", 0) == 0) { timePhases = true; phasesPath = arg.substr(14); }
+            else if (arg.rfind("--fuel=", 0) == 0) { limited = true; limits.fuel = std::stoull(arg.substr(7)); }
+            else if (arg.rfind("--timeout=", 0) == 0) { limited = true; timeoutMs = std::stol(arg.substr(10)); }
+            else if (arg.rfind("--max-heap=", 0) == 0) { limited = true; limits.maxHeapBytes = std::stoull(arg.substr(11)); }
+            else if (arg.rfind("--max-depth=", 0) == 0) { limited = true; limits.maxDepth = std::stoull(arg.substr(12)); }
+            else if (arg == "--serve") serve = true;
+            else if (arg.rfind("--serve=", 0) == 0) { serve = true; socketPath = arg.substr(8); }
+            else if (arg.rfind("--cache-size=", 0) == 0) cacheSize = std::stoull(arg.substr(13));
+            else if (arg.rfind("--max-request=", 0) == 0) maxRequestBytes = std::stoull(arg.substr(14));
+            else if (arg.rfind("--cache-dir=", 0) == 0) cacheDir = arg.substr(12);
+            else if (arg == "--parallel") parallel = true;
+            else if (arg.rfind("--parallel=", 0) == 0) { parallel = true; threads = std::stoul(arg.substr(11)); }
+            else if (arg == "--memo") memo = true;
+            else if (arg.rfind("--memo=", 0) == 0) { memo = true; memoEntries = std::stoull(arg.substr(7)); }
+            else if (arg.rfind("--memo-hot=", 0) == 0) { memo = true; memoHot = std::stoull(arg.substr(11)); }
+            else if (arg == "--lazy") lazy = true;
+            else if (arg == "--infer=constraints") constraintInfer = true;
+            else if (arg == "--infer=w") constraintInfer = false;
+            else if (arg.rfind("--fork-threshold=", 0) == 0) forkThreshold = std::stoull(arg.substr(17));
+            else if (arg.rfind("--manifest=", 0) == 0) manifest = arg.substr(11);
+            else if (arg.rfind("--jobs=", 0) == 0) jobs = std::stoul(arg.substr(7));
+            else if (arg.rfind("-j", 0) == 0 && arg.size() > 2) jobs = std::stoul(arg.substr(2));
+            else if (arg.rfind("--", 0) == 0) throw std::runtime_error("unknown option: " + arg);
+            else paths.push_back(arg);
+        }
+
+        if (serve) {
+            if (emitIR || evalIR || emitLLVM || !objPath.empty() || !exePath.empty() || !cPath.empty() ||
+                profile || stats || timePhases || !cacheDir.empty() || parallel ||
+                constraintInfer || memo || lazy || !paths.empty() || !manifest.empty())
+                throw std::runtime_error("with --serve only the evaluation limits, --cache-size and --max-request apply");
+            miniml::RunOptions opts;
+            opts.fuel = limits.fuel;
+            opts.timeout = std::chrono::milliseconds(timeoutMs);
+            opts.maxHeapBytes = limits.maxHeapBytes;
+            opts.maxDepth = limits.maxDepth;
+            miniml::Pipeline pipeline(opts);
+            miniml::CompileServer server(pipeline, cacheSize, maxRequestBytes);
+            if (socketPath.empty()) server.serve(std::cin, std::cout);
+            else server.listen(socketPath);
+            return 0;
+        }
+
+        if (!manifest.empty()) {
+            auto listed = miniml::readManifest(manifest);
+            paths.insert(paths.end(), listed.begin(), listed.end());
+        }
+        if (paths.size() > 1 || !manifest.empty()) {
+            if (emitIR || evalIR || emitLLVM || !objPath.empty() || !exePath.empty() || !cPath.empty() ||
+                profile || stats || timePhases || !cacheDir.empty() || parallel ||
+                constraintInfer || memo || lazy)
+                throw std::runtime_error("with several files only the evaluation limits apply");
+            miniml::RunOptions opts;
+            opts.fuel = limits.fuel;
+            opts.timeout = std::chrono::milliseconds(timeoutMs);
+            opts.maxHeapBytes = limits.maxHeapBytes;
+            opts.maxDepth = limits.maxDepth;
+            opts.cancel = &g_interrupt;
+            miniml::Pipeline pipeline(opts);
+            if (jobs == 0) jobs = std::max(1u, std::thread::hardware_concurrency());
+            auto previous = std::signal(SIGINT, onInterrupt);
+            auto start = std::chrono::steady_clock::now();
+            auto files = miniml::runBatch(pipeline, paths, jobs);
+            double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::signal(SIGINT, previous);
+            std::cout << miniml::batchOutput(files) << miniml::batchSummary(files, jobs, wallMs);
+            bool allOk = std::all_of(files.begin(), files.end(), [](const miniml::BatchFile& f) {
+                return f.result.status == miniml::RunResult::Status::Ok;
+            });
+            return allOk ? 0 : 1;
+        }
+
+        g_countAllocs = timePhases;
+        miniml::PhaseTimer timer(allocCounts);
+        miniml::PhaseTimer* phases = timePhases ? &timer : nullptr;
+        auto done = [&]() -> int {
+            if (!timePhases) return 0;
+            std::cout << "=== Phases ===\n" << timer.report();
+            if (!phasesPath.empty()) {
+                std::ofstream out(phasesPath);
+                if (!out) throw std::runtime_error("Cannot write file: " + phasesPath);
+                out << timer.json() << "\n";
+                std::cout << "phase timings written to " << phasesPath << "\n";
+            }
+            return 0;
+        };
+
         std::string filename = "<stdin>";
         std::string code;
-        if (argc > 1) {
-            filename = argv[1];
-            code = readAll(argv[1]);
+        if (!paths.empty()) {
+            filename = paths[0];
+            code = readAll(paths[0].c_str());
         } else {
             // fallback-program hvis ingen fil gives
             code = "let id = \\x -> x in id 42";
         }
 
-        // 1) Parse → AST (med kildelokationer)
-        auto ast = miniml::parse_to_ast(code, filename);
+        // 0) On-disk cache of the next three steps
+        std::optional<miniml::CompileCache> diskCache;
+        std::optional<miniml::CheckedProgram> cached;
+        if (!cacheDir.empty()) {
+            diskCache.emplace(cacheDir);
+            miniml::PhaseTimer::Scope phase(phases, "cache_load");
+            cached = diskCache->load(code, filename);
+        }
 
-        // 2) Navneresolution / scope-check
-        miniml::ScopeConfig cfg;
-        cfg.warn_on_shadow = true;
-        cfg.on_warning = [](const std::string& msg){ std::cerr << "warning: " << msg << "\n"; };
+        std::optional<miniml::WorkStealingPool> pool;
+        if (parallel) pool.emplace(threads);
 
-        miniml::ScopeChecker checker(cfg);
-        checker.check(ast);
+        miniml::ExprPtr ast;
+        miniml::TypeAnnotations notes; // operand types for the code generators
+        miniml::InferResult ir;
+        if (cached) {
+            ast = cached->ast;
+            ir.type = cached->type;
+            notes = std::move(cached->notes);
+        } else {
+            // 1) Parse → AST (med kildelokationer)
+            {
+                miniml::PhaseTimer::Scope phase(phases, "parse");
+                ast = miniml::parse_to_ast(code, filename, phases);
+            }
 
-        // 3) Type inference (HM-lite, monomorphic let for now)
-        miniml::TypeEnv gamma;        // add prelude bindings here later, if any
-        auto ir = miniml::infer(ast, gamma);
+            // 2) Navneresolution / scope-check
+            miniml::ScopeConfig cfg;
+            cfg.warn_on_shadow = true;
+            cfg.on_warning = [](const std::string& msg){ std::cerr << "warning: " << msg << "\n"; };
+
+            miniml::ScopeChecker checker(cfg);
+            {
+                miniml::PhaseTimer::Scope phase(phases, "scope_check");
+                checker.check(ast);
+            }
+
+            // 3) Type inference (HM-lite, monomorphic let for now)
+            miniml::TypeEnv gamma;        // add prelude bindings here later, if any
+            {
+                miniml::PhaseTimer::Scope phase(phases, "infer");
+                if (constraintInfer) ir = miniml::inferConstraints(*ast, gamma, &notes, pool ? &*pool : nullptr);
+                else ir = miniml::infer(ast, gamma, notes);
+            }
+
+            if (diskCache) {
+                miniml::PhaseTimer::Scope phase(phases, "cache_store");
+                diskCache->store(code, filename, {ast, miniml::apply_type(ir.subst, ir.type), notes});
+            }
+        }
 
         std::cout << "OK: parsed + scope-checked " << filename << "\n";
-        std::cout << "Type: " << miniml::showType(ir.type) << "\n";
+        std::cout << "Type: " << miniml::showTypeCanonical(miniml::apply_type(ir.subst, ir.type)) << "\n";
+
+        // Lower to IR and, with -O, run the pass pipeline
+        std::vector<miniml::PassReport> reports;
+        auto lowerProgram = [&]() {
+            miniml::IRProgram prog;
+            {
+                miniml::PhaseTimer::Scope phase(phases, "lower");
+                prog = miniml::lower(ast, &notes);
+            }
+            if (optimize) {
+                miniml::PhaseTimer::Scope phase(phases, "optimize");
+                reports = miniml::PassManager::standard().run(prog);
+            }
+            return prog;
+        };
+
+        // 4) Native code generation
+        if (!cPath.empty()) {
+            auto prog = lowerProgram();
+            {
+                miniml::PhaseTimer::Scope phase(phases, "codegen");
+                std::ofstream out(cPath);
+                if (!out) throw std::runtime_error("Cannot write file: " + cPath);
+                out << miniml::emitC(prog, miniml::apply_type(ir.subst, ir.type));
+            }
+            if (!exePath.empty()) {
+                miniml::PhaseTimer::Scope phase(phases, "link");
+                miniml::linkWithRuntime({cPath}, exePath);
+            }
+            return done();
+        }
+        if (emitLLVM || !objPath.empty() || !exePath.empty()) {
+#ifdef MINIML_HAVE_LLVM
+            auto prog = lowerProgram();
+            auto resultType = miniml::apply_type(ir.subst, ir.type);
+            miniml::PhaseTimer::Scope phase(phases, "codegen");
+            if (emitLLVM) std::cout << "=== LLVM ===\n" << miniml::emitLLVMIR(prog, resultType);
+            if (!objPath.empty()) miniml::emitObjectFile(prog, resultType, objPath);
+            if (!exePath.empty()) miniml::buildNativeExecutable(prog, resultType, exePath);
+            return done();
+#else
+            throw std::runtime_error("minimlc was built without LLVM (configure with -DENABLE_LLVM=ON)");
+#endif
+        }
 
-        // after type inference:
-        auto v = miniml::eval(ast, miniml::prelude());
+        // 5) Lowering to IR (only when asked for)
+        if (emitIR || evalIR) {
+            auto prog = lowerProgram();
+            if (emitIR && optimize) std::cout << "=== Passes ===\n" << miniml::showPassReports(reports);
+            if (emitIR) std::cout << "=== IR ===\n" << prog.str();
+            if (evalIR) {
+                miniml::IRVal v;
+                {
+                    miniml::PhaseTimer::Scope phase(phases, "eval");
+                    v = miniml::runIR(prog);
+                }
+                std::cout << "Value: " << miniml::showIRVal(v) << "\n";
+                return done();
+            }
+        }
+
+        // after type inference: allocations that cannot escape go on the stack, and last
+        // reads of a binding move its value out
+        {
+            miniml::PhaseTimer::Scope phase(phases, "escape");
+            miniml::analyzeEscapes(ast);
+            miniml::analyzeLastUses(ast);
+            if (parallel) miniml::analyzeParallelism(ast, forkThreshold);
+        }
+        miniml::Profiler profiler;
+        miniml::EvalStats evalStats;
+        miniml::EvalContext ctx;
+        if (profile) ctx.profiler = &profiler;
+        if (stats) ctx.stats = &evalStats;
+        if (limited) {
+            if (timeoutMs > 0) limits.setTimeout(std::chrono::milliseconds(timeoutMs));
+            ctx.limits = &limits;
+        }
+        ctx.cancel = &g_interrupt;
+        if (pool) ctx.pool = &*pool;
+        std::optional<miniml::CallMemo> callMemo;
+        if (memo) ctx.memo = &callMemo.emplace(memoEntries, memoHot);
+        ctx.lazy = lazy;
+        miniml::Val v;
+        {
+            miniml::PhaseTimer::Scope phase(phases, "eval");
+            auto previous = std::signal(SIGINT, onInterrupt);
+            struct Restore {
+                decltype(previous) h;
+                ~Restore() { std::signal(SIGINT, h); }
+            } restore{previous};
+            v = miniml::eval(ast, miniml::prelude(), ctx);
+            if (lazy) miniml::forceAll(v);
+        }
         std::cout << "Value: " << miniml::showVal(v) << "\n";
 
-        return 0;
+        if (profile) {
+            std::cout << "=== Profile ===\n" << profiler.report();
+            std::ofstream folded(foldedPath);
+            if (!folded) throw std::runtime_error("Cannot write file: " + foldedPath);
+            folded << profiler.folded();
+            std::cout << "folded stacks written to " << foldedPath << "\n";
+        }
+        if (callMemo) std::cout << "=== Memo ===\n" << callMemo->str();
+        if (stats) {
+            std::cout << "=== Stats ===\n";
+            if (statsJson) std::cout << evalStats.json() << "\n";
+            else std::cout << evalStats.str();
+        }
+
+        return done();
 
+    } catch (const miniml::EvalCancelled& e) {
+        std::cerr << "Interrupted: " << e.what() << "\n";
+        return 130;
+    } catch (const miniml::EvalLimitError& e) {
+        std::cerr << "Limit exceeded: " << e.what() << "\n";
+        return 3;
     } catch (const miniml::TypeError& e) {     // type errors (from unify/infer)
         std::cerr << "Type error: " << e.what() << "\n";
         return 2;
@@ -55,7 +55,9 @@ namespace miniml {
       auto L = loc_from(ctx->getStart(), currentFile);
       auto x = ctx->ID()->getText();
       auto b = asExpr(visit(ctx->expr()));
-      return Ptr(lam(x, b, L));
+      auto r = lam(x, b, L);
+      std::get<ELam>(*r).memo = ctx->MEMO() != nullptr;
+      return Ptr(r);
     }
 
     // orExpr: andExpr ( '||' andExpr )*
@@ -8,9 +8,13 @@
 #include "MiniMLParser.h"
 #include "AstBuilder.hpp"
 #include "../ast/Nodes.hpp"
+#include "../utils/PhaseTimer.hpp"
 
 namespace miniml {
-    inline ExprPtr parse_to_ast(const std::string& code, std::string filename = "<stdin>") {
+    // With a timer, lexing, building the parse tree and building the AST are
+    // timed as separate phases.
+    inline ExprPtr parse_to_ast(const std::string& code, std::string filename = "<stdin>",
+                                PhaseTimer* timer = nullptr) {
         antlr4::ANTLRInputStream input(code);
         MiniMLLexer lexer(&input);
         StrictErrorListener lexErr(filename);
@@ -18,14 +22,22 @@ namespace miniml {
         lexer.addErrorListener(&lexErr);
 
         antlr4::CommonTokenStream tokens(&lexer);
-        tokens.fill();
+        {
+            PhaseTimer::Scope phase(timer, "lex");
+            tokens.fill();
+        }
 
         MiniMLParser parser(&tokens);
         StrictErrorListener parseErr(filename);   // <-- and here
         parser.removeErrorListeners();
         parser.addErrorListener(&parseErr);
 
-        auto* tree = parser.prog();
+        MiniMLParser::ProgContext* tree;
+        {
+            PhaseTimer::Scope phase(timer, "parse_tree");
+            tree = parser.prog();
+        }
+        PhaseTimer::Scope phase(timer, "build_ast");
         AstBuilder builder;
         builder.currentFile = filename;
         return std::any_cast<ExprPtr>(builder.visit(tree));
@@ -0,0 +1,149 @@
+#include "Escape.hpp"
+#include <type_traits>
+
+namespace miniml {
+
+namespace {
+
+bool occursFree(const Expr& e, const std::string& x) {
+  return std::visit([&](auto const& n) -> bool {
+    using T = std::decay_t<decltype(n)>;
+    if constexpr (std::is_same_v<T, EVar>) {
+      return n.name == x;
+    } else if constexpr (std::is_same_v<T, ELitInt> || std::is_same_v<T, ELitBool>) {
+      return false;
+    } else if constexpr (std::is_same_v<T, ELitTuple>) {
+      for (auto& el : n.elems) if (occursFree(*el, x)) return true;
+      return false;
+    } else if constexpr (std::is_same_v<T, ELam>) {
+      return n.param != x && occursFree(*n.body, x);
+    } else if constexpr (std::is_same_v<T, EApp>) {
+      return occursFree(*n.fn, x) || occursFree(*n.arg, x);
+    } else if constexpr (std::is_same_v<T, ELet>) {
+      return occursFree(*n.rhs, x) || (n.name != x && occursFree(*n.body, x));
+    } else if constexpr (std::is_same_v<T, EIf>) {
+      return occursFree(*n.cond, x) || occursFree(*n.thenE, x) || occursFree(*n.elseE, x);
+    } else if constexpr (std::is_same_v<T, EUnOp>) {
+      return occursFree(*n.expr, x);
+    } else {
+      return occursFree(*n.lhs, x) || occursFree(*n.rhs, x);
+    }
+  }, e);
+}
+
+enum class Use { Called, Compared };
+
+bool isVar(const ExprPtr& e, const std::string& x) {
+  auto v = std::get_if<EVar>(e.get());
+  return v && v->name == x;
+}
+
+// True if every free occurrence of x in e is of the given kind ('x a' or an
+// operand of '=' / '<>') and none is inside a lambda.
+bool usedOnlyAs(const Expr& e, const std::string& x, Use use) {
+  return std::visit([&](auto const& n) -> bool {
+    using T = std::decay_t<decltype(n)>;
+    if constexpr (std::is_same_v<T, EVar>) {
+      return n.name != x;
+    } else if constexpr (std::is_same_v<T, ELitInt> || std::is_same_v<T, ELitBool>) {
+      return true;
+    } else if constexpr (std::is_same_v<T, ELitTuple>) {
+      for (auto& el : n.elems) if (!usedOnlyAs(*el, x, use)) return false;
+      return true;
+    } else if constexpr (std::is_same_v<T, ELam>) {
+      return n.param == x || !occursFree(*n.body, x);
+    } else if constexpr (std::is_same_v<T, EApp>) {
+      bool fnOk = (use == Use::Called && isVar(n.fn, x)) || usedOnlyAs(*n.fn, x, use);
+      return fnOk && usedOnlyAs(*n.arg, x, use);
+    } else if constexpr (std::is_same_v<T, ELet>) {
+      return usedOnlyAs(*n.rhs, x, use) && (n.name == x || usedOnlyAs(*n.body, x, use));
+    } else if constexpr (std::is_same_v<T, EIf>) {
+      return usedOnlyAs(*n.cond, x, use) && usedOnlyAs(*n.thenE, x, use) && usedOnlyAs(*n.elseE, x, use);
+    } else if constexpr (std::is_same_v<T, EUnOp>) {
+      return usedOnlyAs(*n.expr, x, use);
+    } else {
+      bool compared = use == Use::Compared && (n.op == BinOp::Eq || n.op == BinOp::Neq);
+      return (compared && isVar(n.lhs, x) ? true : usedOnlyAs(*n.lhs, x, use)) &&
+             (compared && isVar(n.rhs, x) ? true : usedOnlyAs(*n.rhs, x, use));
+    }
+  }, e);
+}
+
+struct Marker {
+  EscapeStats stats;
+
+  void compareOnly(const ExprPtr& e) {
+    if (auto t = std::get_if<ELitTuple>(e.get()); t && t->escapes) {
+      t->escapes = false;
+      ++stats.tuples;
+    }
+  }
+
+  void callOnly(ELam& lam) {
+    if (lam.escapes && !lam.memo) {   // memoized calls keep their closure
+      lam.escapes = false;
+      ++stats.closures;
+    }
+  }
+
+  void frame(bool& frameEscapes, bool captured) {
+    if (!captured && frameEscapes) ++stats.frames;
+    frameEscapes = captured;
+  }
+
+  // Marks the subtree; returns true if it contains a lambda that still escapes,
+  // i.e. evaluating 'e' may create a closure holding on to the current frames.
+  bool mark(Expr& e) {
+    return std::visit([&](auto& n) -> bool {
+      using T = std::decay_t<decltype(n)>;
+      if constexpr (std::is_same_v<T, EVar> || std::is_same_v<T, ELitInt> || std::is_same_v<T, ELitBool>) {
+        return false;
+      } else if constexpr (std::is_same_v<T, ELitTuple>) {
+        bool r = false;
+        for (auto& el : n.elems) r |= mark(*el);
+        return r;
+      } else if constexpr (std::is_same_v<T, ELam>) {
+        bool inner = mark(*n.body);
+        frame(n.frameEscapes, inner);
+        return n.escapes || inner;
+      } else if constexpr (std::is_same_v<T, EApp>) {
+        if (auto lam = std::get_if<ELam>(n.fn.get())) callOnly(*lam);
+        bool r = mark(*n.fn);
+        return mark(*n.arg) || r;
+      } else if constexpr (std::is_same_v<T, ELet>) {
+        // the value is kept in the let's frame: a captured frame holds it past the let
+        bool inner = mark(*n.body);
+        if (auto lam = std::get_if<ELam>(n.rhs.get()); lam && !inner && usedOnlyAs(*n.body, n.name, Use::Called))
+          callOnly(*lam);
+        if (std::get_if<ELitTuple>(n.rhs.get()) && !inner && usedOnlyAs(*n.body, n.name, Use::Compared))
+          compareOnly(n.rhs);
+        bool r = mark(*n.rhs);
+        frame(n.frameEscapes, inner);
+        return r || inner;
+      } else if constexpr (std::is_same_v<T, EIf>) {
+        bool r = mark(*n.cond);
+        r |= mark(*n.thenE);
+        return mark(*n.elseE) || r;
+      } else if constexpr (std::is_same_v<T, EUnOp>) {
+        return mark(*n.expr);
+      } else {
+        if (n.op == BinOp::Eq || n.op == BinOp::Neq) {
+          compareOnly(n.lhs);
+          compareOnly(n.rhs);
+        }
+        bool r = mark(*n.lhs);
+        return mark(*n.rhs) || r;
+      }
+    }, e);
+  }
+};
+
+} // namespace
+
+EscapeStats analyzeEscapes(const ExprPtr& e) {
+  Marker m;
+  m.mark(*e);
+  return m.stats;
+}
+
+} // namespace miniml
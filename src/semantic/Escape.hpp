@@ -0,0 +1,29 @@
+#pragma once
+#include "../ast/Nodes.hpp"
+
+namespace miniml {
+
+// Escape analysis over a (scope-checked) AST. Clears the 'escapes' /
+// 'frameEscapes' flags of nodes whose allocation cannot outlive the
+// expression that creates it, so the evaluator can build them on the stack:
+//
+//  - a lambda applied on the spot, '(\x -> e) a', needs no closure at all;
+//  - 'let f = \x -> e in body' where body only ever calls f (outside any
+//    lambda) gets a closure that lives as long as the let, unless the let's
+//    frame can be captured (the frame would keep it);
+//  - a tuple literal that is an operand of '=' / '<>', or let-bound and only
+//    used as such (outside any lambda, frame not captured), is only compared;
+//  - the environment frame of a let or of a call cannot be captured when no
+//    escaping lambda occurs in its scope (closures capture their lexical
+//    environment, so only lambdas written inside the scope can retain it).
+//
+// Without this pass every flag stays at its conservative default.
+struct EscapeStats {
+    int tuples = 0;     // tuple literals marked non-escaping
+    int closures = 0;   // lambdas marked non-escaping
+    int frames = 0;     // lets and lambdas whose frames do not escape
+};
+
+EscapeStats analyzeEscapes(const ExprPtr& e);
+
+} // namespace miniml
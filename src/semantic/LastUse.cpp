@@ -0,0 +1,126 @@
+#include "LastUse.hpp"
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace miniml {
+
+namespace {
+
+// Pass 1: the binders (ELet / ELam nodes) read from inside a lambda nested in
+// their scope.
+struct Captures {
+  struct Binder {
+    const void* node;
+    int depth;   // lambdas around the binding
+  };
+  std::unordered_map<std::string, std::vector<Binder>> scope;
+  std::unordered_set<const void*> captured;
+
+  void walk(const Expr& e, int depth) {
+    std::visit([&](auto const& n) {
+      using T = std::decay_t<decltype(n)>;
+      if constexpr (std::is_same_v<T, EVar>) {
+        auto it = scope.find(n.name);
+        if (it != scope.end() && !it->second.empty() && it->second.back().depth < depth)
+          captured.insert(it->second.back().node);
+      } else if constexpr (std::is_same_v<T, ELitInt> || std::is_same_v<T, ELitBool>) {
+      } else if constexpr (std::is_same_v<T, ELitTuple>) {
+        for (auto& el : n.elems) walk(*el, depth);
+      } else if constexpr (std::is_same_v<T, ELam>) {
+        scope[n.param].push_back({&n, depth + 1});
+        walk(*n.body, depth + 1);
+        scope[n.param].pop_back();
+      } else if constexpr (std::is_same_v<T, EApp>) {
+        walk(*n.fn, depth);
+        walk(*n.arg, depth);
+      } else if constexpr (std::is_same_v<T, ELet>) {
+        walk(*n.rhs, depth);
+        scope[n.name].push_back({&n, depth});
+        walk(*n.body, depth);
+        scope[n.name].pop_back();
+      } else if constexpr (std::is_same_v<T, EIf>) {
+        walk(*n.cond, depth);
+        walk(*n.thenE, depth);
+        walk(*n.elseE, depth);
+      } else if constexpr (std::is_same_v<T, EUnOp>) {
+        walk(*n.expr, depth);
+      } else {
+        walk(*n.lhs, depth);
+        walk(*n.rhs, depth);
+      }
+    }, e);
+  }
+};
+
+// Pass 2: liveness, backwards in evaluation order.
+struct Marker {
+  using Live = std::unordered_set<std::string>;
+
+  const std::unordered_set<const void*>& captured;
+  std::unordered_map<std::string, std::vector<bool>> movable;   // innermost binding last
+  int marked = 0;
+
+  void bind(const std::string& x, const void* binder) { movable[x].push_back(!captured.count(binder)); }
+  void unbind(const std::string& x) { movable[x].pop_back(); }
+
+  // On entry 'live' holds the variables read after 'e'; on return, those read from its start on.
+  void mark(Expr& e, Live& live) {
+    std::visit([&](auto& n) {
+      using T = std::decay_t<decltype(n)>;
+      if constexpr (std::is_same_v<T, EVar>) {
+        auto it = movable.find(n.name);
+        bool bound = it != movable.end() && !it->second.empty() && it->second.back();
+        n.lastUse = bound && !live.count(n.name);
+        if (n.lastUse) ++marked;
+        live.insert(n.name);
+      } else if constexpr (std::is_same_v<T, ELitInt> || std::is_same_v<T, ELitBool>) {
+      } else if constexpr (std::is_same_v<T, ELitTuple>) {
+        for (auto it = n.elems.rbegin(); it != n.elems.rend(); ++it) mark(**it, live);
+      } else if constexpr (std::is_same_v<T, ELam>) {
+        Live body;
+        bind(n.param, &n);
+        mark(*n.body, body);
+        unbind(n.param);
+        body.erase(n.param);
+        live.insert(body.begin(), body.end());
+      } else if constexpr (std::is_same_v<T, EApp>) {
+        mark(*n.arg, live);
+        mark(*n.fn, live);
+      } else if constexpr (std::is_same_v<T, ELet>) {
+        bool outer = live.erase(n.name) > 0;
+        bind(n.name, &n);
+        mark(*n.body, live);
+        unbind(n.name);
+        live.erase(n.name);
+        if (outer) live.insert(n.name);
+        mark(*n.rhs, live);
+      } else if constexpr (std::is_same_v<T, EIf>) {
+        Live otherwise = live;
+        mark(*n.thenE, live);
+        mark(*n.elseE, otherwise);
+        live.insert(otherwise.begin(), otherwise.end());
+        mark(*n.cond, live);
+      } else if constexpr (std::is_same_v<T, EUnOp>) {
+        mark(*n.expr, live);
+      } else {
+        mark(*n.rhs, live);   // with && and ||, only maybe: 'live' only grows
+        mark(*n.lhs, live);
+      }
+    }, e);
+  }
+};
+
+} // namespace
+
+int analyzeLastUses(const ExprPtr& e) {
+  Captures c;
+  c.walk(*e, 0);
+  Marker m{c.captured, {}};
+  Marker::Live live;
+  m.mark(*e, live);
+  return m.marked;
+}
+
+} // namespace miniml
@@ -0,0 +1,21 @@
+#pragma once
+#include "../ast/Nodes.hpp"
+
+namespace miniml {
+
+// Last-use analysis over a (scope-checked) AST. Sets EVar::lastUse on reads
+// of a let- or lambda-bound variable after which no evaluation order reads
+// that binding again, so the evaluator can move the value out of its frame
+// instead of adding a reference; a value passed on at its last use stays
+// uniquely owned, and dies (its cell free for reuse) as soon as its new
+// owner is done with it.
+//
+// Bindings read inside a lambda in their scope are never marked: a closure
+// may read them any number of times. Variables bound outside the tree (the
+// prelude, a host environment) are not marked either. Running the pass again
+// after the tree changed recomputes every flag.
+//
+// Returns the number of reads marked.
+int analyzeLastUses(const ExprPtr& e);
+
+} // namespace miniml
@@ -0,0 +1,136 @@
+#include "Parallel.hpp"
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace miniml {
+
+namespace {
+
+class Marker {
+ public:
+  Marker(std::size_t threshold, ParallelStats& stats) : threshold_(threshold), stats_(stats) {}
+
+  // Marks forks below 'e' and returns its estimated cost.
+  std::size_t visit(Expr& e) {
+    return std::visit([&](auto& n) -> std::size_t {
+      using T = std::decay_t<decltype(n)>;
+      if constexpr (std::is_same_v<T, EVar> || std::is_same_v<T, ELitInt> || std::is_same_v<T, ELitBool>) {
+        return 1;
+      } else if constexpr (std::is_same_v<T, ELitTuple>) {
+        std::vector<std::size_t> costs;
+        std::size_t total = 1;
+        for (auto& el : n.elems) {
+          costs.push_back(visit(*el));
+          total += costs.back();
+        }
+        n.fork.assign(n.elems.size(), false);
+        std::size_t last = n.elems.size();   // the last costly element stays on this thread
+        for (std::size_t i = 0; i < costs.size(); ++i) if (costly(costs[i])) last = i;
+        for (std::size_t i = 0; i < costs.size(); ++i) {
+          if (i != last && costly(costs[i])) {
+            n.fork[i] = true;
+            ++stats_.forks;
+          }
+        }
+        if (std::none_of(n.fork.begin(), n.fork.end(), [](bool f) { return f; })) n.fork.clear();
+        return total;
+      } else if constexpr (std::is_same_v<T, ELam>) {
+        function(n);   // the body is not evaluated where the lambda is
+        return 1;
+      } else if constexpr (std::is_same_v<T, EApp>) {
+        std::size_t fn = 1, body = 0;
+        if (auto lam = std::get_if<ELam>(n.fn.get())) body = function(*lam).bodyCost;   // applied on the spot
+        else fn = visit(*n.fn);
+        std::size_t arg = visit(*n.arg);
+        n.forkArg = costly(fn) && costly(arg);
+        if (n.forkArg) ++stats_.forks;
+        return 1 + fn + arg + kCallCost + body + saturatedCall(n);
+      } else if constexpr (std::is_same_v<T, ELet>) {
+        Known k{n.name, 0, 0};
+        if (auto lam = std::get_if<ELam>(n.rhs.get())) {
+          auto f = function(*lam);
+          k.arity = f.arity;
+          k.bodyCost = f.bodyCost;
+        } else {
+          visit(*n.rhs);
+        }
+        known_.push_back(k);
+        std::size_t body = visit(*n.body);
+        known_.pop_back();
+        return 1 + 1 + body;
+      } else if constexpr (std::is_same_v<T, EIf>) {
+        std::size_t c = visit(*n.cond);
+        std::size_t t = visit(*n.thenE);
+        return 1 + c + std::max(t, visit(*n.elseE));
+      } else if constexpr (std::is_same_v<T, EUnOp>) {
+        return 1 + visit(*n.expr);
+      } else {
+        std::size_t l = visit(*n.lhs), r = visit(*n.rhs);
+        bool independent = n.op != BinOp::And && n.op != BinOp::Or && n.op != BinOp::Eq && n.op != BinOp::Neq;
+        n.forkRhs = independent && costly(l) && costly(r);
+        if (n.forkRhs) ++stats_.forks;
+        return 1 + l + r;
+      }
+    }, e);
+  }
+
+ private:
+  // A variable in scope; let-bound lambdas know what a full call costs.
+  struct Known {
+    std::string name;
+    std::size_t arity;      // 0: not a known function
+    std::size_t bodyCost;
+  };
+  struct Function {
+    std::size_t arity, bodyCost;
+  };
+
+  std::size_t threshold_;
+  ParallelStats& stats_;
+  std::vector<Known> known_;
+
+  bool costly(std::size_t cost) const { return cost >= threshold_; }
+
+  // \a -> \b -> ... -> body: visits the body with the parameters in scope
+  Function function(ELam& lam) {
+    Function f{0, 0};
+    ELam* l = &lam;
+    for (;;) {
+      known_.push_back(Known{l->param, 0, 0});
+      ++f.arity;
+      auto inner = std::get_if<ELam>(l->body.get());
+      if (!inner) break;
+      l = inner;
+    }
+    f.bodyCost = visit(*l->body);
+    known_.resize(known_.size() - f.arity);
+    return f;
+  }
+
+  // Body cost of a let-bound function when 'n' passes its last argument.
+  std::size_t saturatedCall(const EApp& n) const {
+    std::size_t args = 1;
+    const Expr* head = n.fn.get();
+    while (auto app = std::get_if<EApp>(head)) {
+      ++args;
+      head = app->fn.get();
+    }
+    auto v = std::get_if<EVar>(head);
+    if (!v) return 0;
+    for (auto it = known_.rbegin(); it != known_.rend(); ++it)
+      if (it->name == v->name) return it->arity == args ? it->bodyCost : 0;
+    return 0;
+  }
+};
+
+} // namespace
+
+ParallelStats analyzeParallelism(const ExprPtr& e, std::size_t threshold) {
+  ParallelStats stats;
+  Marker(threshold, stats).visit(*e);
+  return stats;
+}
+
+} // namespace miniml
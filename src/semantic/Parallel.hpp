@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include "../ast/Nodes.hpp"
+
+namespace miniml {
+
+// Picks the subexpressions parallel evaluation forks. MiniML has no side
+// effects, so tuple elements, the operands of arithmetic and comparisons,
+// and the function and argument of an application are independent. They
+// are forked when their estimated cost reaches 'threshold' and there is
+// other costly work to overlap with:
+//
+//  - in a tuple, every costly element but the last runs as a task;
+//  - in 'f a' and 'a op b' the argument / right operand runs as a task when
+//    both sides are costly ('&&', '||', '=' and '<>' are never forked).
+//
+// The cost of an expression is a static estimate: its number of nodes, with
+// kCallCost extra per application, plus the body of the callee when it is
+// known: a lambda applied on the spot, or a let-bound lambda given all its
+// arguments. Sets ELitTuple::fork, EApp::forkArg and EBinOp::forkRhs;
+// without this pass nothing is forked.
+struct ParallelStats {
+    int forks = 0;   // subexpressions marked to run as tasks
+};
+
+constexpr std::size_t kCallCost = 16;
+constexpr std::size_t kDefaultForkThreshold = 64;
+
+ParallelStats analyzeParallelism(const ExprPtr& e, std::size_t threshold = kDefaultForkThreshold);
+
+} // namespace miniml
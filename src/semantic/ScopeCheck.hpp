@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include <string>
 #include <variant>
 #include <stdexcept>
@@ -19,7 +20,7 @@ struct ScopeError : std::runtime_error {
 
 struct ScopeConfig {
   bool warn_on_shadow = false;
-  void (*on_warning)(const std::string& msg) = nullptr;  // optional hook
+  std::function<void(const std::string& msg)> on_warning;  // optional hook
 };
 
 class ScopeChecker {
@@ -62,7 +63,9 @@ private:
       },
       [&](const ELitInt&) { /* ok */ },
       [&](const ELitBool&) { /* ok */ },
-      [&](const ELitTuple&) { /* ok */ },
+      [&](const ELitTuple& n) {
+        for (auto& x : n.elems) check_expr(*x);
+      },
       [&](const ELam& n) {
         env_.push();
         bind_with_warning(n.param, n.loc);
@@ -0,0 +1,569 @@
+#include "Constraints.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <unordered_map>
+#include <utility>
+#include "InferStats.hpp"
+
+namespace miniml {
+
+// ---------- Constraints ----------
+
+struct Block;
+
+// One step of the solution, in the order infer() takes it.
+struct Item {
+  enum class Kind {
+    Eq,        // a = b, checked at 'loc'
+    Gen,       // a is the type of the right-hand side of 'let', at 'level'
+    Inst,      // a is a fresh instance of the scheme of 'let', used at 'level'
+    Unbound,   // 'var' is not in scope
+    Note,      // a is the operand type of the '=' or '<>' node 'eq'
+    Sub        // the steps of a subtree generated as a task of its own
+  };
+  Kind kind;
+  TypePtr a, b;
+  const SrcLoc* loc = nullptr;
+  const ELet* let = nullptr;
+  const EVar* var = nullptr;
+  const EBinOp* eq = nullptr;
+  int level = 0;
+  std::unique_ptr<Block> sub;
+};
+
+struct Block {
+  std::vector<std::pair<int, int>> vars;   // type variables created here, with their levels
+  std::vector<Item> items;
+};
+
+// Names in scope: lambda parameters have one type, let-bound names a scheme
+// known only once solving reaches the let. Shared by the tasks below a node.
+struct Binding {
+  const std::string* name;
+  TypePtr mono;
+  const ELet* let = nullptr;
+  std::shared_ptr<const Binding> next;
+};
+using Scope = std::shared_ptr<const Binding>;
+
+template <class F>
+static void forEachChild(const Expr& e, F f) {
+  std::visit([&](auto const& n) {
+    using T = std::decay_t<decltype(n)>;
+    if constexpr (std::is_same_v<T, ELam>) {
+      f(*n.body);
+    } else if constexpr (std::is_same_v<T, EApp>) {
+      f(*n.fn); f(*n.arg);
+    } else if constexpr (std::is_same_v<T, ELet>) {
+      f(*n.rhs); f(*n.body);
+    } else if constexpr (std::is_same_v<T, ELitTuple>) {
+      for (auto& el : n.elems) f(*el);
+    } else if constexpr (std::is_same_v<T, EIf>) {
+      f(*n.cond); f(*n.thenE); f(*n.elseE);
+    } else if constexpr (std::is_same_v<T, EUnOp>) {
+      f(*n.expr);
+    } else if constexpr (std::is_same_v<T, EBinOp>) {
+      f(*n.lhs); f(*n.rhs);
+    }
+  }, e);
+}
+
+// Subtree sizes in preorder: the first child of the node at 'i' is at i + 1,
+// each next one after the subtree of the one before.
+static std::uint32_t measure(const Expr& e, std::vector<std::uint32_t>& sizes) {
+  auto at = sizes.size();
+  sizes.push_back(0);
+  std::uint32_t n = 1;
+  forEachChild(e, [&](const Expr& c) { n += measure(c, sizes); });
+  sizes[at] = n;
+  return n;
+}
+
+class Generator {
+public:
+  Generator(const TypeEnv& gamma, WorkStealingPool* pool, std::size_t forkNodes, const Expr& root)
+      : gamma_(gamma), pool_(pool), forkNodes_(forkNodes) {
+    if (pool_) measure(root, sizes_);
+  }
+
+  TypePtr gen(const Expr& e, std::size_t idx, const Scope& scope, int level, Block& out) {
+    return std::visit([&](auto const& n) -> TypePtr {
+      using T = std::decay_t<decltype(n)>;
+      if constexpr (std::is_same_v<T, ELitInt>) {
+        return Type::tInt();
+      } else if constexpr (std::is_same_v<T, ELitBool>) {
+        return Type::tBool();
+      } else if constexpr (std::is_same_v<T, EVar>) {
+        return var(n, scope, level, out);
+      } else if constexpr (std::is_same_v<T, ELam>) {
+        auto a = fresh(level, out);
+        auto body = gen(*n.body, idx + 1, bind(&n.param, a, nullptr, scope), level, out);
+        return Type::tFun(a, body);
+      } else if constexpr (std::is_same_v<T, EApp>) {
+        TypePtr t[2];
+        each(idx, {{n.fn.get(), scope, level}, {n.arg.get(), scope, level}}, t, out, [](std::size_t) {});
+        auto b = fresh(level, out);
+        eq(t[0], Type::tFun(t[1], b), n.loc, out);
+        return b;
+      } else if constexpr (std::is_same_v<T, ELet>) {
+        TypePtr t[2];
+        each(idx, {{n.rhs.get(), scope, level + 1}, {n.body.get(), bind(&n.name, nullptr, &n, scope), level}}, t, out,
+             [&](std::size_t i) {
+               if (i != 0) return;
+               Item g{Item::Kind::Gen, t[0]};
+               g.let = &n;
+               g.level = level;
+               out.items.push_back(std::move(g));
+             });
+        return t[1];
+      } else if constexpr (std::is_same_v<T, ELitTuple>) {
+        std::vector<Child> kids;
+        kids.reserve(n.elems.size());
+        for (auto& el : n.elems) kids.push_back({el.get(), scope, level});
+        std::vector<TypePtr> t(kids.size());
+        each(idx, kids, t.data(), out, [](std::size_t) {});
+        return Type::tTuple(std::move(t));
+      } else if constexpr (std::is_same_v<T, EIf>) {
+        TypePtr t[3];
+        each(idx, {{n.cond.get(), scope, level}, {n.thenE.get(), scope, level}, {n.elseE.get(), scope, level}}, t,
+             out, [&](std::size_t i) {
+               if (i == 0) eq(t[0], Type::tBool(), n.loc, out);
+               if (i == 2) eq(t[1], t[2], n.loc, out);
+             });
+        return t[1];
+      } else if constexpr (std::is_same_v<T, EUnOp>) {
+        auto t = gen(*n.expr, idx + 1, scope, level, out);
+        eq(t, Type::tBool(), n.loc, out);
+        return Type::tBool();
+      } else if constexpr (std::is_same_v<T, EBinOp>) {
+        TypePtr t[2];
+        each(idx, {{n.lhs.get(), scope, level}, {n.rhs.get(), scope, level}}, t, out, [](std::size_t) {});
+        return binop(n, t[0], t[1], out);
+      } else {
+        static_assert(sizeof(T) == 0, "Unhandled Expr alternative in Generator::gen");
+      }
+    }, e);
+  }
+
+private:
+  struct Child {
+    const Expr* e;
+    Scope scope;
+    int level;
+  };
+
+  const TypeEnv& gamma_;
+  WorkStealingPool* pool_;
+  std::size_t forkNodes_;
+  std::vector<std::uint32_t> sizes_;   // only with a pool
+
+  static Scope bind(const std::string* name, TypePtr mono, const ELet* let, const Scope& next) {
+    return std::make_shared<const Binding>(Binding{name, std::move(mono), let, next});
+  }
+
+  static TypePtr fresh(int level, Block& out) {
+    int id = freshTypeVarId();
+    out.vars.emplace_back(id, level);
+    return Type::tVar(id);
+  }
+
+  static void eq(TypePtr a, TypePtr b, const SrcLoc& loc, Block& out) {
+    Item i{Item::Kind::Eq, std::move(a), std::move(b)};
+    i.loc = &loc;
+    out.items.push_back(std::move(i));
+  }
+
+  TypePtr var(const EVar& n, const Scope& scope, int level, Block& out) {
+    for (auto* b = scope.get(); b; b = b->next.get()) {
+      if (*b->name != n.name) continue;
+      if (!b->let) return b->mono;
+      auto t = fresh(level, out);
+      Item i{Item::Kind::Inst, t};
+      i.let = b->let;
+      i.level = level;
+      out.items.push_back(std::move(i));
+      return t;
+    }
+    if (auto it = gamma_.find(n.name); it != gamma_.end()) {
+      Subst s;
+      for (int q : it->second.quant) s.m[q] = fresh(level, out);
+      return s.apply(it->second.body);
+    }
+    Item i{Item::Kind::Unbound};
+    i.var = &n;
+    out.items.push_back(std::move(i));
+    return fresh(level, out);
+  }
+
+  static TypePtr binop(const EBinOp& n, const TypePtr& l, const TypePtr& r, Block& out) {
+    switch (n.op) {
+      case BinOp::Add:
+      case BinOp::Sub:
+      case BinOp::Mul:
+      case BinOp::Div:
+        eq(l, Type::tInt(), n.loc, out);
+        eq(r, Type::tInt(), n.loc, out);
+        return Type::tInt();
+      case BinOp::And:
+      case BinOp::Or:
+        eq(l, Type::tBool(), n.loc, out);
+        eq(r, Type::tBool(), n.loc, out);
+        return Type::tBool();
+      case BinOp::Lt:
+      case BinOp::Le:
+      case BinOp::Gt:
+      case BinOp::Ge:
+        eq(l, Type::tInt(), n.loc, out);
+        eq(r, Type::tInt(), n.loc, out);
+        return Type::tBool();
+      case BinOp::Eq:
+      case BinOp::Neq: {
+        eq(l, r, n.loc, out);
+        Item i{Item::Kind::Note, l};
+        i.eq = &n;
+        out.items.push_back(std::move(i));
+        return Type::tBool();
+      }
+    }
+    return Type::tBool();
+  }
+
+  // Generates 'kids' into 'out' in order, their types into 't'; 'own(i)'
+  // adds the node's own steps that follow child i. With a pool, large
+  // children but the last run as tasks into blocks of their own, beside the
+  // rest, which then get blocks too so that the steps keep their order.
+  template <class Own>
+  void each(std::size_t idx, const std::vector<Child>& kids, TypePtr* t, Block& out, Own own) {
+    std::size_t n = kids.size();
+    std::vector<std::size_t> at(n, 0);
+    bool fork = false;
+    if (pool_) {
+      for (std::size_t i = 0; i < n; ++i) {
+        at[i] = i ? at[i - 1] + sizes_[at[i - 1]] : idx + 1;
+        if (i + 1 < n && sizes_[at[i]] >= forkNodes_) fork = true;
+      }
+    }
+    if (!fork) {
+      for (std::size_t i = 0; i < n; ++i) {
+        t[i] = gen(*kids[i].e, at[i], kids[i].scope, kids[i].level, out);
+        own(i);
+      }
+      return;
+    }
+
+    std::vector<std::unique_ptr<Block>> blocks(n);
+    for (auto& b : blocks) b = std::make_unique<Block>();
+    std::deque<WorkStealingPool::Task> tasks;
+    std::vector<WorkStealingPool::Task*> forked(n, nullptr);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+      if (sizes_[at[i]] < forkNodes_) continue;
+      forked[i] = &tasks.emplace_back([&, i] { t[i] = gen(*kids[i].e, at[i], kids[i].scope, kids[i].level, *blocks[i]); });
+      pool_->fork(*forked[i]);
+    }
+    // every task is joined before leaving: they refer to this frame
+    std::exception_ptr error;
+    try {
+      for (std::size_t i = 0; i < n; ++i)
+        if (!forked[i]) t[i] = gen(*kids[i].e, at[i], kids[i].scope, kids[i].level, *blocks[i]);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    for (auto* task : forked) {
+      if (!task) continue;
+      try {
+        pool_->join(*task);
+      } catch (...) {
+        if (!error) error = std::current_exception();
+      }
+    }
+    if (error) std::rethrow_exception(error);
+    for (std::size_t i = 0; i < n; ++i) {
+      Item s{Item::Kind::Sub};
+      s.sub = std::move(blocks[i]);
+      out.items.push_back(std::move(s));
+      own(i);
+    }
+  }
+};
+
+// ---------- Solving ----------
+
+class Solver {
+public:
+  explicit Solver(InferStats* stats) : stats_(stats) {
+    nodes_.push_back(Node{TKind::INT, 0, 0});
+    nodes_.push_back(Node{TKind::BOOL, 1, 0});
+  }
+
+  void solve(const Block& b) {
+    for (auto [id, level] : b.vars) varNode(id, level);
+    for (auto& i : b.items) {
+      switch (i.kind) {
+        case Item::Kind::Eq:
+          if (stats_) ++stats_->unifyCalls;
+          unify(node(i.a), node(i.b), *i.loc);
+          break;
+        case Item::Kind::Gen: {
+          int t = node(i.a);
+          if (stats_) {
+            stats_->noteType(type(t));
+            types_.clear();   // solving goes on
+          }
+          generalize(t, i.level);
+          schemes_[i.let] = t;
+          break;
+        }
+        case Item::Kind::Inst: {
+          std::unordered_map<int, int> copies;
+          int t = instantiate(schemes_.at(i.let), i.level, copies);
+          nodes_[find(node(i.a))].parent = t;
+          break;
+        }
+        case Item::Kind::Unbound: {
+          auto& loc = i.var->loc;
+          throw TypeError(loc.file + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.col) +
+                          ": unbound variable '" + i.var->name + "'");
+        }
+        case Item::Kind::Note:
+          notes_.emplace_back(i.eq, node(i.a));
+          break;
+        case Item::Kind::Sub:
+          solve(*i.sub);
+          break;
+      }
+    }
+  }
+
+  int node(const TypePtr& t) {
+    switch (t->k) {
+      case TKind::INT: return 0;
+      case TKind::BOOL: return 1;
+      case TKind::VAR: return varNode(t->v.id, 0);   // from gamma unless created while generating
+      case TKind::FUN: {
+        int a = node(t->f.a), b = node(t->f.b);
+        return add(Node{TKind::FUN, 0, std::max(levelOf(a), levelOf(b)), -1, a, b});
+      }
+      case TKind::TUPLE: {
+        Node n{TKind::TUPLE, 0, 0};
+        for (auto& e : t->tupleElems) {
+          n.elems.push_back(node(e));
+          n.level = std::max(n.level, levelOf(n.elems.back()));
+        }
+        return add(std::move(n));
+      }
+    }
+    return 0;
+  }
+
+  // The solved type of node 'n', sharing what the union-find shares.
+  TypePtr type(int n) {
+    n = find(n);
+    if (auto it = types_.find(n); it != types_.end()) return it->second;
+    TypePtr t;
+    switch (nodes_[n].k) {
+      case TKind::INT: t = Type::tInt(); break;
+      case TKind::BOOL: t = Type::tBool(); break;
+      case TKind::VAR: t = Type::tVar(nodes_[n].var); break;
+      case TKind::FUN: t = Type::tFun(type(nodes_[n].a), type(nodes_[n].b)); break;
+      case TKind::TUPLE: {
+        std::vector<TypePtr> elems;
+        for (std::size_t i = 0; i < nodes_[n].elems.size(); ++i) elems.push_back(type(nodes_[n].elems[i]));
+        t = Type::tTuple(std::move(elems));
+        break;
+      }
+    }
+    types_.emplace(n, t);
+    return t;
+  }
+
+  // The solution for type variable 'id', if it has one.
+  TypePtr solution(int id) {
+    auto it = vars_.find(id);
+    if (it == vars_.end()) return nullptr;
+    int n = find(it->second);
+    if (nodes_[n].k == TKind::VAR && nodes_[n].var == id) return nullptr;
+    return type(n);
+  }
+
+  const std::vector<std::pair<const EBinOp*, int>>& notes() const { return notes_; }
+
+private:
+  // A type in the union-find: the representative of its class if it is its
+  // own parent. 'level' is that of a variable, and for a function or tuple
+  // at least that of every variable in it, so walks can skip it when lower.
+  struct Node {
+    TKind k;
+    int parent;
+    int level;
+    int var = -1;        // VAR: its id
+    int a = -1, b = -1;  // FUN
+    std::vector<int> elems;
+  };
+
+  static constexpr int kGeneric = INT_MAX;   // level of the quantified variables of a scheme
+
+  InferStats* stats_;
+  std::vector<Node> nodes_;
+  std::vector<unsigned> seen_;   // walk in which a node was last visited
+  unsigned walk_ = 0;
+  std::unordered_map<int, int> vars_;
+  std::unordered_map<const ELet*, int> schemes_;
+  std::unordered_map<int, TypePtr> types_;
+  std::vector<std::pair<const EBinOp*, int>> notes_;
+
+  int add(Node n) {
+    n.parent = static_cast<int>(nodes_.size());
+    nodes_.push_back(std::move(n));
+    return nodes_.back().parent;
+  }
+
+  int varNode(int id, int level) {
+    auto [it, added] = vars_.try_emplace(id, 0);
+    if (added) it->second = add(Node{TKind::VAR, 0, level, id});
+    return it->second;
+  }
+
+  int levelOf(int n) { return nodes_[find(n)].level; }
+
+  int find(int n) {
+    int root = n;
+    while (nodes_[root].parent != root) root = nodes_[root].parent;
+    while (nodes_[n].parent != root) n = std::exchange(nodes_[n].parent, root);
+    return root;
+  }
+
+  [[noreturn]] static void fail(const SrcLoc& where, const char* what) {
+    throw TypeError(where.file + ":" + std::to_string(where.line) + ":" + std::to_string(where.col) + ": " + what);
+  }
+
+  // Same decisions, in the same order, as unify(): the first mismatch found
+  // is the one it reports.
+  void unify(int a, int b, const SrcLoc& where) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return;
+    if (nodes_[a].k == TKind::VAR) return bindVar(a, b, where);
+    if (nodes_[b].k == TKind::VAR) return bindVar(b, a, where);
+    TKind ka = nodes_[a].k, kb = nodes_[b].k;
+    if (ka != kb) fail(where, "type mismatch during unification");
+    if (ka == TKind::FUN) {
+      unify(nodes_[a].a, nodes_[b].a, where);
+      unify(nodes_[a].b, nodes_[b].b, where);
+    } else if (ka == TKind::TUPLE) {
+      if (nodes_[a].elems.size() != nodes_[b].elems.size()) fail(where, "tuple arity mismatch");
+      for (std::size_t i = 0; i < nodes_[a].elems.size(); ++i) unify(nodes_[a].elems[i], nodes_[b].elems[i], where);
+    }
+    if (ka == TKind::FUN || ka == TKind::TUPLE) {
+      // equal now: one node stands for both from here on
+      a = find(a);
+      b = find(b);
+      if (a == b) return;
+      nodes_[b].level = std::min(nodes_[a].level, nodes_[b].level);
+      nodes_[a].parent = b;
+    }
+  }
+
+  void bindVar(int v, int t, const SrcLoc& where) {
+    int level = nodes_[v].level;
+    if (nodes_[t].k != TKind::VAR) {
+      ++walk_;
+      seen_.resize(nodes_.size(), 0);
+      if (occursLowering(v, t, level)) fail(where, "occurs check fails");
+    }
+    nodes_[t].level = std::min(nodes_[t].level, level);
+    nodes_[v].parent = t;
+  }
+
+  // Whether variable 'v' occurs in 't', lowering the levels in 't' to
+  // 'level' (that of 'v') on the way. Parts at a lower level cannot hold 'v'.
+  bool occursLowering(int v, int t, int level) {
+    t = find(t);
+    if (t == v) return true;
+    Node& n = nodes_[t];
+    if (n.level < level || n.k == TKind::INT || n.k == TKind::BOOL) return false;
+    if (n.k == TKind::VAR) {
+      n.level = level;
+      return false;
+    }
+    if (seen_[t] == walk_) return false;
+    seen_[t] = walk_;
+    n.level = level;
+    if (n.k == TKind::FUN) return occursLowering(v, nodes_[t].a, level) || occursLowering(v, nodes_[t].b, level);
+    for (std::size_t i = 0; i < nodes_[t].elems.size(); ++i)
+      if (occursLowering(v, nodes_[t].elems[i], level)) return true;
+    return false;
+  }
+
+  // Quantifies the variables of 't' above 'level', those that no type
+  // outside the let can reach. Nothing else refers to them afterwards, so
+  // they are marked in place. Returns whether 't' has any.
+  bool generalize(int t, int level) {
+    t = find(t);
+    Node& n = nodes_[t];
+    if (n.level <= level || n.k == TKind::INT || n.k == TKind::BOOL) return false;
+    if (n.k == TKind::VAR) {
+      n.level = kGeneric;
+      return true;
+    }
+    bool any = false;
+    if (n.k == TKind::FUN) {
+      any |= generalize(nodes_[t].a, level);
+      any |= generalize(nodes_[t].b, level);
+    } else {
+      for (std::size_t i = 0; i < nodes_[t].elems.size(); ++i) any |= generalize(nodes_[t].elems[i], level);
+    }
+    nodes_[t].level = any ? kGeneric : level;
+    return any;
+  }
+
+  // A copy of scheme 't' with fresh variables at 'level' for its quantified
+  // ones; the parts without any are shared.
+  int instantiate(int t, int level, std::unordered_map<int, int>& copies) {
+    t = find(t);
+    if (nodes_[t].level != kGeneric) return t;
+    if (auto it = copies.find(t); it != copies.end()) return it->second;
+    int c;
+    if (nodes_[t].k == TKind::VAR) {
+      c = varNode(freshTypeVarId(), level);
+    } else if (nodes_[t].k == TKind::FUN) {
+      int a = instantiate(nodes_[t].a, level, copies);
+      int b = instantiate(nodes_[t].b, level, copies);
+      c = add(Node{TKind::FUN, 0, level, -1, a, b});
+    } else {
+      Node n{TKind::TUPLE, 0, level};
+      for (std::size_t i = 0; i < nodes_[t].elems.size(); ++i)
+        n.elems.push_back(instantiate(nodes_[t].elems[i], level, copies));
+      c = add(std::move(n));
+    }
+    copies.emplace(t, c);
+    return c;
+  }
+};
+
+InferResult inferConstraints(const Expr& expr, const TypeEnv& gamma, TypeAnnotations* notes,
+                             WorkStealingPool* pool, std::size_t forkNodes) {
+  Block root;
+  TypePtr t;
+  {
+    Generator g(gamma, pool, forkNodes, expr);
+    t = g.gen(expr, 0, nullptr, 0, root);
+  }
+
+  auto* stats = InferStats::active();
+  Solver solver(stats);
+  solver.solve(root);
+
+  InferResult r;
+  r.type = solver.type(solver.node(t));
+  for (int id : ftv(gamma))
+    if (auto s = solver.solution(id)) r.subst.m.emplace(id, std::move(s));
+  if (notes)
+    for (auto& [node, n] : solver.notes()) notes->eqOperands[node] = solver.type(n);
+  if (stats) stats->noteType(r.type);
+  return r;
+}
+
+} // namespace miniml
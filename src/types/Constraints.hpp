@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include "Infer.hpp"
+#include "../utils/WorkStealingPool.hpp"
+
+namespace miniml {
+
+  // Subtrees of at least this many AST nodes are worth a task of their own
+  // while generating constraints.
+  constexpr std::size_t kConstraintForkNodes = 256;
+
+  // Alternative to infer(), in two phases. The first walks the tree and
+  // generates its constraints: equalities, in the order infer() would unify
+  // them, and for every let the point where its right-hand side is
+  // generalized and the uses that instantiate it. With a 'pool', subtrees
+  // of at least 'forkNodes' nodes are generated as tasks of their own (the
+  // right-hand side of a let runs beside its body). The second phase solves
+  // the constraints in that order, in one pass over a union-find of types,
+  // and generalizes by levels instead of the free variables of Γ.
+  //
+  // The result, 'notes' and any TypeError, message and location included,
+  // are those of infer() up to the names of type variables. The returned
+  // substitution only covers the type variables free in 'gamma'.
+  InferResult inferConstraints(const Expr& expr, const TypeEnv& gamma, TypeAnnotations* notes = nullptr,
+                               WorkStealingPool* pool = nullptr, std::size_t forkNodes = kConstraintForkNodes);
+
+  inline InferResult inferConstraints(const std::shared_ptr<Expr>& expr, const TypeEnv& gamma,
+                                      TypeAnnotations* notes = nullptr, WorkStealingPool* pool = nullptr) {
+    return inferConstraints(*expr, gamma, notes, pool);
+  }
+} // namespace miniml
@@ -1,10 +1,17 @@
 #include "Infer.hpp"
 #include <functional>
+#include "InferStats.hpp"
 
 namespace miniml {
 
 static InferResult infer_rec(const Expr& e, TypeEnv gamma);
 
+// Annotations requested by the running infer() call, if any
+static thread_local TypeAnnotations* g_notes = nullptr;
+
+// Memo of the running infer() call, if any
+static thread_local InferMemo* g_memo = nullptr;
+
 // Helper to compose substitutions (s2 after s1): result applies s2, then s1
 static inline Subst compose(Subst s1, const Subst& s2) { s1.compose(s2); return s1; }
 
@@ -89,7 +96,9 @@ static InferResult infer_let(const ELet& n, const TypeEnv& gamma0) {
   auto gamma1 = apply_env(r_rhs.subst, gamma0);
 
   // generalize the RHS type w.r.t. gamma1
-  auto sigma = generalize(gamma1, apply_type(r_rhs.subst, r_rhs.type));
+  auto rhsType = apply_type(r_rhs.subst, r_rhs.type);
+  if (auto* stats = InferStats::active()) stats->noteType(rhsType);
+  auto sigma = generalize(gamma1, rhsType);
 
   // extend env and infer body
   TypeEnv gamma2 = gamma1;
@@ -144,13 +153,14 @@ static InferResult infer_binop(const EBinOp& n, const TypeEnv& gamma0) {
   auto lhsT = apply_type(s2, rl.type);
   auto rhsT = apply_type(s2, rr.type);
 
-  auto needInt = [&](const TypePtr& t) {
+  // unify 't' with Int/Bool on top of the substitution 's' found so far
+  auto needInt = [&](const TypePtr& t, const Subst& s) {
     auto su = unify(t, Type::tInt(), n.loc);
-    return compose(su, s2);
+    return compose(su, s);
   };
-  auto needBool = [&](const TypePtr& t) {
+  auto needBool = [&](const TypePtr& t, const Subst& s) {
     auto su = unify(t, Type::tBool(), n.loc);
-    return compose(su, s2);
+    return compose(su, s);
   };
 
   switch (n.op) {
@@ -158,15 +168,15 @@ static InferResult infer_binop(const EBinOp& n, const TypeEnv& gamma0) {
     case BinOp::Sub:
     case BinOp::Mul:
     case BinOp::Div: {
-      auto s3 = needInt(lhsT);
-      auto s4 = needInt(apply_type(s3, rhsT));
+      auto s3 = needInt(lhsT, s2);
+      auto s4 = needInt(apply_type(s3, rhsT), s3);
       return { s4, Type::tInt() };
     }
 
     case BinOp::And:
     case BinOp::Or: {
-      auto s3 = needBool(lhsT);
-      auto s4 = needBool(apply_type(s3, rhsT));
+      auto s3 = needBool(lhsT, s2);
+      auto s4 = needBool(apply_type(s3, rhsT), s3);
       return { s4, Type::tBool() };
     }
 
@@ -174,8 +184,8 @@ static InferResult infer_binop(const EBinOp& n, const TypeEnv& gamma0) {
     case BinOp::Le:
     case BinOp::Gt:
     case BinOp::Ge: {
-      auto s3 = needInt(lhsT);
-      auto s4 = needInt(apply_type(s3, rhsT));
+      auto s3 = needInt(lhsT, s2);
+      auto s4 = needInt(apply_type(s3, rhsT), s3);
       return { s4, Type::tBool() };
     }
 
@@ -184,6 +194,7 @@ static InferResult infer_binop(const EBinOp& n, const TypeEnv& gamma0) {
       // α × α → Bool (allow any type that can unify)
       auto su = unify(lhsT, rhsT, n.loc);
       auto s3 = compose(su, s2);
+      if (g_notes) g_notes->eqOperands[&n] = apply_type(s3, lhsT);
       return { s3, Type::tBool() };
     }
   }
@@ -192,7 +203,7 @@ static InferResult infer_binop(const EBinOp& n, const TypeEnv& gamma0) {
   return { s2, Type::tBool() };
 }
 
-static InferResult infer_rec(const Expr& e, TypeEnv gamma) {
+static InferResult infer_node(const Expr& e, TypeEnv gamma) {
   return std::visit([&](auto const& node) -> InferResult {
     using T = std::decay_t<decltype(node)>;
     if constexpr (std::is_same_v<T, ELitInt>) {
@@ -216,13 +227,46 @@ static InferResult infer_rec(const Expr& e, TypeEnv gamma) {
     } else if constexpr (std::is_same_v<T, EBinOp>) {
       return infer_binop(node, gamma);
     } else {
-      static_assert(sizeof(T) == 0, "Unhandled Expr alternative in infer_rec");
+      static_assert(sizeof(T) == 0, "Unhandled Expr alternative in infer_node");
     }
   }, e);
 }
 
+static InferResult infer_rec(const Expr& e, TypeEnv gamma) {
+  if (!g_memo) return infer_node(e, std::move(gamma));
+  if (auto hit = g_memo->find(e, gamma)) return std::move(*hit);
+  auto r = infer_node(e, gamma);
+  g_memo->store(e, gamma, r);
+  return r;
+}
+
 InferResult infer(const Expr& expr, const TypeEnv& gamma) {
-  return infer_rec(expr, gamma);
+  auto r = infer_rec(expr, gamma);
+  if (auto* stats = InferStats::active()) stats->noteType(apply_type(r.subst, r.type));
+  return r;
+}
+
+InferResult infer(const Expr& expr, const TypeEnv& gamma, TypeAnnotations& notes) {
+  struct Scope {
+    TypeAnnotations* saved = g_notes;
+    ~Scope() { g_notes = saved; }
+  } scope;
+  g_notes = &notes;
+  auto r = infer_rec(expr, gamma);
+  for (auto& [node, t] : notes.eqOperands) t = apply_type(r.subst, t);
+  if (auto* stats = InferStats::active()) stats->noteType(apply_type(r.subst, r.type));
+  return r;
+}
+
+InferResult infer(const Expr& expr, const TypeEnv& gamma, InferMemo& memo) {
+  struct Scope {
+    InferMemo* saved = g_memo;
+    ~Scope() { g_memo = saved; }
+  } scope;
+  g_memo = &memo;
+  auto r = infer_rec(expr, gamma);
+  if (auto* stats = InferStats::active()) stats->noteType(apply_type(r.subst, r.type));
+  return r;
 }
 
 } // namespace miniml
@@ -1,4 +1,6 @@
 #pragma once
+#include <optional>
+#include <unordered_map>
 #include <utility>
 #include "../ast/Nodes.hpp"
 #include "Scheme.hpp"
@@ -12,11 +14,37 @@ namespace miniml {
     TypePtr type;
   };
 
+  // Types recorded for later phases (code generators), final substitution applied.
+  // Operand types stay type variables where the operands are polymorphic.
+  struct TypeAnnotations {
+    std::unordered_map<const EBinOp*, TypePtr> eqOperands;   // '=' and '<>' nodes
+  };
+
+  // Results kept from earlier infer() calls (see IncrementalAnalyzer). While
+  // infer() runs with a memo, it looks every node up before inferring it, and
+  // offers the memo the result of every node it did infer.
+  class InferMemo {
+  public:
+    virtual ~InferMemo() = default;
+    virtual std::optional<InferResult> find(const Expr& e, const TypeEnv& gamma) = 0;
+    virtual void store(const Expr& e, const TypeEnv& gamma, const InferResult& r) = 0;
+  };
+
 // Infer type of expression under environment 'gamma'.
 // Returns {S, T} such that S ∘ gamma ⊢ expr : T
   InferResult infer(const Expr& expr, const TypeEnv& gamma);
 
+// Same, additionally filling 'notes'.
+  InferResult infer(const Expr& expr, const TypeEnv& gamma, TypeAnnotations& notes);
+
+// Same, reusing and recording results in 'memo'.
+  InferResult infer(const Expr& expr, const TypeEnv& gamma, InferMemo& memo);
+
   inline InferResult infer(const std::shared_ptr<Expr>& expr, const TypeEnv& gamma) {
     return infer(*expr, gamma);
   }
+
+  inline InferResult infer(const std::shared_ptr<Expr>& expr, const TypeEnv& gamma, TypeAnnotations& notes) {
+    return infer(*expr, gamma, notes);
+  }
 } // namespace miniml
@@ -0,0 +1,18 @@
+#include "InferStats.hpp"
+#include <algorithm>
+
+namespace miniml {
+
+    static thread_local InferStats* g_active = nullptr;
+
+    InferStats* InferStats::active() { return g_active; }
+
+    InferStats::Scope::Scope(InferStats& stats) : saved(g_active) { g_active = &stats; }
+    InferStats::Scope::~Scope() { g_active = saved; }
+
+    void InferStats::noteType(const TypePtr& t) {
+        maxTypeSize = std::max(maxTypeSize, typeTreeSize(t));
+        maxTypeNodes = std::max(maxTypeNodes, typeDagSize(t));
+    }
+
+} // namespace miniml
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include "Type.hpp"
+
+namespace miniml {
+
+    // Counters for one or more infer() runs on the current thread, collected
+    // while an InferStats::Scope is alive. Without one, the hooks in Subst,
+    // unify and infer cost a thread-local null check.
+    struct InferStats {
+        std::uint64_t composeCalls = 0;    // Subst::compose
+        std::uint64_t unifyCalls = 0;      // top-level unify()
+        std::uint64_t maxTypeSize = 0;     // largest let-bound or result type, as a tree (typeTreeSize)
+        std::size_t maxTypeNodes = 0;      // ... and its distinct nodes (typeDagSize)
+
+        void noteType(const TypePtr& t);
+
+        struct Scope {
+            InferStats* saved;
+            explicit Scope(InferStats& stats);
+            ~Scope();
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+        static InferStats* active();
+    };
+
+} // namespace miniml
@@ -0,0 +1,117 @@
+#include "Pretty.hpp"
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace miniml {
+
+    namespace {
+
+    struct SharedPrinter {
+        std::unordered_map<const Type*, int> refs;    // parents per compound node
+        std::unordered_map<const Type*, int> names;   // tN for shared ones, by first use
+        std::deque<const Type*> pending;              // named, definition not printed yet
+        std::ostringstream out;
+
+        static bool compound(const Type* t) { return t->k == TKind::FUN || t->k == TKind::TUPLE; }
+
+        void count(const TypePtr& root) {
+            std::vector<const Type*> todo{root.get()};
+            while (!todo.empty()) {
+                auto n = todo.back();
+                todo.pop_back();
+                if (!n || !compound(n) || refs[n]++ > 0) continue;   // children counted on first visit only
+                if (n->k == TKind::FUN) { todo.push_back(n->f.a.get()); todo.push_back(n->f.b.get()); }
+                else for (auto& e : n->tupleElems) todo.push_back(e.get());
+            }
+        }
+
+        // like showTypeRec, but shared compound subterms print as their name
+        void print(const Type* t, int prec, bool definition = false) {
+            if (!t) { out << "?"; return; }
+            if (!definition && compound(t) && refs[t] > 1) {
+                auto [it, fresh] = names.emplace(t, static_cast<int>(names.size()));
+                if (fresh) pending.push_back(t);
+                out << "t" << it->second;
+                return;
+            }
+            switch (t->k) {
+                case TKind::INT:  out << "Int";  return;
+                case TKind::BOOL: out << "Bool"; return;
+                case TKind::VAR:  out << "a" << t->v.id; return;
+                case TKind::FUN:
+                    if (prec > 0) out << "(";
+                    print(t->f.a.get(), 1);
+                    out << " -> ";
+                    print(t->f.b.get(), 0);
+                    if (prec > 0) out << ")";
+                    return;
+                case TKind::TUPLE:
+                    out << "(";
+                    for (size_t i = 0; i < t->tupleElems.size(); ++i) {
+                        if (i) out << ", ";
+                        print(t->tupleElems[i].get(), 0);
+                    }
+                    out << ")";
+                    return;
+            }
+        }
+    };
+
+    struct VarRenamer {
+        std::unordered_map<int, int> vars;                   // old id -> new id
+        std::unordered_map<const Type*, TypePtr> done;       // keeps DAG sharing
+
+        TypePtr rename(const TypePtr& t) {
+            if (!t) return t;
+            switch (t->k) {
+                case TKind::INT:
+                case TKind::BOOL: return t;
+                case TKind::VAR: {
+                    auto [it, fresh] = vars.emplace(t->v.id, static_cast<int>(vars.size()));
+                    return it->second == t->v.id ? t : Type::tVar(it->second);
+                }
+                default: break;
+            }
+            if (auto it = done.find(t.get()); it != done.end()) return it->second;
+            TypePtr r;
+            if (t->k == TKind::FUN) {
+                auto a = rename(t->f.a);   // left to right: order of appearance
+                auto b = rename(t->f.b);
+                r = a == t->f.a && b == t->f.b ? t : Type::tFun(a, b);
+            } else {
+                std::vector<TypePtr> elems;
+                elems.reserve(t->tupleElems.size());
+                bool same = true;
+                for (auto& e : t->tupleElems) {
+                    elems.push_back(rename(e));
+                    same = same && elems.back() == e;
+                }
+                r = same ? t : Type::tTuple(std::move(elems));
+            }
+            done.emplace(t.get(), r);
+            return r;
+        }
+    };
+
+    } // namespace
+
+    TypePtr canonicalTypeVars(const TypePtr& t) {
+        VarRenamer r;
+        return r.rename(t);
+    }
+
+    std::string showTypeShared(const TypePtr& t) {
+        SharedPrinter p;
+        p.count(t);
+        p.print(t.get(), 0, /*definition=*/true);
+        for (bool first = true; !p.pending.empty(); first = false) {
+            auto n = p.pending.front();
+            p.pending.pop_front();
+            p.out << (first ? " where t" : ", t") << p.names[n] << " = ";
+            p.print(n, 0, /*definition=*/true);
+        }
+        return p.out.str();
+    }
+
+} // namespace miniml
@@ -42,10 +42,27 @@ namespace miniml {
         }
     }
 
+    // Types larger than this (as trees) print with shared subterms named:
+    // "(t0, t0) where t0 = (t1, t1), t1 = (Int, Int)". Substitution builds
+    // such DAGs, and printing them as trees takes exponential time and space.
+    constexpr std::uint64_t kShowTypeTreeLimit = 200;
+
+    std::string showTypeShared(const TypePtr& t);
+
     inline std::string showType(const TypePtr& t) {
+        if (typeTreeSize(t) > kShowTypeTreeLimit) return showTypeShared(t);
         std::ostringstream out;
         showTypeRec(t, out, 0);
         return out.str();
     }
 
+    // 't' with its type variables renumbered a0, a1, ... in order of first
+    // appearance; shared subterms stay shared.
+    TypePtr canonicalTypeVars(const TypePtr& t);
+
+    // showType of the canonical form. Fresh variables come from one counter
+    // shared by all threads, so the raw names depend on what else was
+    // inferred before; output meant to be diffed uses this instead.
+    inline std::string showTypeCanonical(const TypePtr& t) { return showType(canonicalTypeVars(t)); }
+
 }
\ No newline at end of file
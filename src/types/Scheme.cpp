@@ -10,7 +10,15 @@ namespace miniml {
     int freshTypeVarId() { return g_fresh++; }
 
     // ------- ftv over Type -------
-    static void ftvTypeRec(const TypePtr& t, std::unordered_set<int>& out) {
+    // Shared compound subterms are walked once, past the first 64 nodes
+    // (see Subst::apply)
+    struct FtvWalk {
+        int visited = 0;
+        std::unordered_set<const Type*> seen;
+        bool skip(const TypePtr& t) { return ++visited > 64 && t.use_count() > 1 && !seen.insert(t.get()).second; }
+    };
+
+    static void ftvTypeRec(const TypePtr& t, std::unordered_set<int>& out, FtvWalk& seen) {
         if (!t) return;
         switch (t->k) {
             case TKind::INT:
@@ -20,18 +28,21 @@ namespace miniml {
                 out.insert(t->v.id);
                 return;
             case TKind::FUN:
-                ftvTypeRec(t->f.a, out);
-                ftvTypeRec(t->f.b, out);
+                if (seen.skip(t)) return;
+                ftvTypeRec(t->f.a, out, seen);
+                ftvTypeRec(t->f.b, out, seen);
                 return;
             case TKind::TUPLE:
-                for (auto& e : t->tupleElems) ftvTypeRec(e, out);
+                if (seen.skip(t)) return;
+                for (auto& e : t->tupleElems) ftvTypeRec(e, out, seen);
                 return;
         }
     }
 
     std::unordered_set<int> ftv(const TypePtr& t) {
         std::unordered_set<int> r;
-        ftvTypeRec(t, r);
+        FtvWalk seen;
+        ftvTypeRec(t, r, seen);
         return r;
     }
 
@@ -1,37 +1,61 @@
 #include "Subst.hpp"
+#include "InferStats.hpp"
 #include <algorithm>
 
 namespace miniml {
 
-    TypePtr Subst::apply(const TypePtr& t) const {
-        if (!t) return t;
+    // Types built by substitution share subterms, and walking them as trees
+    // is exponential in the worst case. Once an apply() has visited more than
+    // kMemoAfter nodes, subterms reached through more than one pointer are
+    // rewritten once; small types never pay for the table.
+    constexpr int kMemoAfter = 64;
+
+    struct SharedMemo {
+        int visited = 0;
+        std::unordered_map<const Type*, TypePtr> done;
+    };
+
+    static TypePtr applyRec(const Subst& s, const TypePtr& t, SharedMemo& memo) {
         switch (t->k) {
             case TKind::INT:
             case TKind::BOOL:
               return t;
             case TKind::VAR: {
-                auto it = m.find(t->v.id);
-                return it == m.end() ? t : apply(it->second);
+                auto it = s.m.find(t->v.id);
+                return it == s.m.end() ? t : applyRec(s, it->second, memo);
             }
-            case TKind::FUN: {
-                auto a = apply(t->f.a);
-                auto b = apply(t->f.b);
-                if (a.get() == t->f.a.get() && b.get() == t->f.b.get()) return t;
-                return Type::tFun(a, b);
-            }
-            case TKind::TUPLE: {                     // ← add this block
-                bool changed = false;
-                std::vector<TypePtr> es; es.reserve(t->tupleElems.size());
-                for (auto& e : t->tupleElems) {
-                    auto ae = apply(e);
-                    changed |= (ae.get() != e.get());
-                    es.push_back(ae);
-                }
-                if (!changed) return t;
-                return Type::tTuple(std::move(es));
+            case TKind::FUN:
+            case TKind::TUPLE:
+              break;
+        }
+        bool shared = ++memo.visited > kMemoAfter && t.use_count() > 1;
+        if (shared) {
+            auto it = memo.done.find(t.get());
+            if (it != memo.done.end()) return it->second;
+        }
+        TypePtr r = t;
+        if (t->k == TKind::FUN) {
+            auto a = applyRec(s, t->f.a, memo);
+            auto b = applyRec(s, t->f.b, memo);
+            if (a.get() != t->f.a.get() || b.get() != t->f.b.get()) r = Type::tFun(a, b);
+        } else {
+            bool changed = false;
+            std::vector<TypePtr> es; es.reserve(t->tupleElems.size());
+            for (auto& e : t->tupleElems) {
+                auto ae = applyRec(s, e, memo);
+                changed |= (ae.get() != e.get());
+                es.push_back(ae);
             }
+            if (changed) r = Type::tTuple(std::move(es));
         }
-        return t;
+        if (shared) memo.done.emplace(t.get(), r);
+        return r;
+    }
+
+    TypePtr Subst::apply(const TypePtr& t) const {
+        if (!t || m.empty()) return t;
+        SharedMemo memo;
+        return applyRec(*this, t, memo);
     }
 
     TypeScheme Subst::apply(const TypeScheme& sc) const {
@@ -46,6 +70,7 @@ namespace miniml {
     }
 
     void Subst::compose(const Subst& other) {
+        if (auto* stats = InferStats::active()) ++stats->composeCalls;
         // Update our codomain under 'other'
         for (auto& [k, v] : m) {
             m[k] = other.apply(v);
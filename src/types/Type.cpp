@@ -1,4 +1,6 @@
 #include "Type.hpp"
+#include <unordered_map>
+#include <unordered_set>
 
 namespace miniml {
 
@@ -24,4 +26,37 @@ namespace miniml {
         return t;
     }
 
+    static std::uint64_t treeSize(const Type* t, std::unordered_map<const Type*, std::uint64_t>& memo) {
+        if (!t) return 0;
+        auto it = memo.find(t);
+        if (it != memo.end()) return it->second;
+        std::uint64_t n = 1;
+        auto add = [&](const TypePtr& c) {
+            auto k = treeSize(c.get(), memo);
+            n = k > UINT64_MAX - n ? UINT64_MAX : n + k;
+        };
+        if (t->k == TKind::FUN) { add(t->f.a); add(t->f.b); }
+        else if (t->k == TKind::TUPLE) for (auto& e : t->tupleElems) add(e);
+        memo.emplace(t, n);
+        return n;
+    }
+
+    std::uint64_t typeTreeSize(const TypePtr& t) {
+        std::unordered_map<const Type*, std::uint64_t> memo;
+        return treeSize(t.get(), memo);
+    }
+
+    std::size_t typeDagSize(const TypePtr& t) {
+        std::unordered_set<const Type*> seen;
+        std::vector<const Type*> todo{t.get()};
+        while (!todo.empty()) {
+            auto n = todo.back();
+            todo.pop_back();
+            if (!n || !seen.insert(n).second) continue;
+            if (n->k == TKind::FUN) { todo.push_back(n->f.a.get()); todo.push_back(n->f.b.get()); }
+            else if (n->k == TKind::TUPLE) for (auto& e : n->tupleElems) todo.push_back(e.get());
+        }
+        return seen.size();
+    }
+
 } // namespace miniml
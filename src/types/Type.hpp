@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <new>   // for placement new
@@ -64,4 +65,10 @@ namespace miniml {
         static TypePtr tTuple(std::vector<TypePtr> elems);
     };
 
+    // Size of a type as a tree, i.e. as printed without sharing (saturates at
+    // UINT64_MAX), and its number of distinct nodes. Substitution shares
+    // subterms, so the first can be exponential in the second.
+    std::uint64_t typeTreeSize(const TypePtr& t);
+    std::size_t typeDagSize(const TypePtr& t);
+
 } // namespace miniml
@@ -1,9 +1,20 @@
 #include "Unify.hpp"
+#include <functional>
+#include <unordered_set>
+#include "InferStats.hpp"
 
 namespace miniml {
 
-    static bool occursIn(int varId, TypePtr t, const Subst& s) {
-        t = s.apply(t);
+    // Unification builds DAG-shaped types whose tree size can be exponential:
+    // past the first kSeenAfter nodes, each shared subterm is searched once.
+    constexpr int kSeenAfter = 64;
+
+    struct OccursWalk {
+        int visited = 0;
+        std::unordered_set<const Type*> seen;
+    };
+
+    static bool occursIn(int varId, const TypePtr& t, OccursWalk& w) {
         switch (t->k) {
             case TKind::INT:
             case TKind::BOOL:
@@ -11,17 +22,19 @@ namespace miniml {
             case TKind::VAR:
                 return t->v.id == varId;
             case TKind::FUN:
-                return occursIn(varId, t->f.a, s) || occursIn(varId, t->f.b, s);
-            case TKind::TUPLE:                             // ← add this case
-                for (auto& e : t->tupleElems) if (occursIn(varId, e, s)) return true;
-                return false;
+            case TKind::TUPLE:
+              break;
         }
+        if (++w.visited > kSeenAfter && t.use_count() > 1 && !w.seen.insert(t.get()).second) return false;
+        if (t->k == TKind::FUN) return occursIn(varId, t->f.a, w) || occursIn(varId, t->f.b, w);
+        for (auto& e : t->tupleElems) if (occursIn(varId, e, w)) return true;
         return false;
     }
 
     static Subst bindVar(int varId, TypePtr t, const SrcLoc& where) {
         if (t->k == TKind::VAR && t->v.id == varId) return {};
-        if (occursIn(varId, t, {})) {
+        OccursWalk walk;
+        if (occursIn(varId, t, walk)) {
             throw TypeError(where.file + ":" + std::to_string(where.line) + ":" +
                             std::to_string(where.col) + ": occurs check fails");
         }
@@ -31,6 +44,7 @@ namespace miniml {
     }
 
     Subst unify(TypePtr t1, TypePtr t2, const SrcLoc& where) {
+        if (auto* stats = InferStats::active()) ++stats->unifyCalls;
         Subst s;
         // recursive lambda captures by reference
         std::function<Subst(TypePtr, TypePtr)> go = [&](TypePtr a, TypePtr b) -> Subst {
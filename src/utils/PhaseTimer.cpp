@@ -0,0 +1,83 @@
+#include "PhaseTimer.hpp"
+#include <cstdio>
+#include <ctime>
+#include <stdexcept>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace miniml {
+
+static double cpuNowMs() {
+  return 1000.0 * static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+std::int64_t residentSetKb() {
+#if defined(__linux__)
+  // stdio rather than a stream: no operator new inside a measured phase
+  std::FILE* statm = std::fopen("/proc/self/statm", "r");
+  if (!statm) return 0;
+  long long size = 0, resident = 0;
+  int n = std::fscanf(statm, "%lld %lld", &size, &resident);
+  std::fclose(statm);
+  if (n == 2) return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#endif
+  return 0;
+}
+
+void PhaseTimer::begin(const std::string& name) {
+  Phase p;
+  p.name = name;
+  p.depth = static_cast<int>(open_.size());
+  phases_.push_back(std::move(p));
+  open_.push_back(Open{phases_.size() - 1, Clock::now(), cpuNowMs(),
+                       allocs_ ? allocs_() : AllocCounts{}, residentSetKb()});
+}
+
+void PhaseTimer::end() {
+  if (open_.empty()) throw std::logic_error("PhaseTimer::end without begin");
+  auto o = open_.back();
+  open_.pop_back();
+  auto& p = phases_[o.index];
+  p.wallMs = std::chrono::duration<double, std::milli>(Clock::now() - o.wall).count();
+  p.cpuMs = cpuNowMs() - o.cpuMs;
+  if (allocs_) {
+    auto now = allocs_();
+    p.allocs = now.count - o.allocs.count;
+    p.allocBytes = now.bytes - o.allocs.bytes;
+  }
+  p.rssDeltaKb = residentSetKb() - o.rssKb;
+}
+
+std::string PhaseTimer::report() const {
+  std::string out = "phase                  wall ms     cpu ms     allocs    alloc KiB   rss +KiB\n";
+  char buf[160];
+  for (auto& p : phases_) {
+    std::string name = std::string(2 * p.depth, ' ') + p.name;
+    std::snprintf(buf, sizeof buf, "%-20s %9.3f  %9.3f  %9llu  %11.1f  %9lld\n", name.c_str(), p.wallMs, p.cpuMs,
+                  static_cast<unsigned long long>(p.allocs), static_cast<double>(p.allocBytes) / 1024.0,
+                  static_cast<long long>(p.rssDeltaKb));
+    out += buf;
+  }
+  return out;
+}
+
+std::string PhaseTimer::json() const {
+  std::string out = "{\"phases\":[";
+  char buf[256];
+  for (size_t i = 0; i < phases_.size(); ++i) {
+    auto& p = phases_[i];
+    std::snprintf(buf, sizeof buf,
+                  "%s{\"name\":\"%s\",\"depth\":%d,\"wall_ms\":%.3f,\"cpu_ms\":%.3f,\"allocs\":%llu,"
+                  "\"alloc_bytes\":%llu,\"rss_delta_kb\":%lld}",
+                  i ? "," : "", p.name.c_str(), p.depth, p.wallMs, p.cpuMs,
+                  static_cast<unsigned long long>(p.allocs), static_cast<unsigned long long>(p.allocBytes),
+                  static_cast<long long>(p.rssDeltaKb));
+    out += buf;
+  }
+  out += "],\"counts_allocations\":";
+  out += allocs_ ? "true" : "false";
+  return out + "}";
+}
+
+} // namespace miniml
@@ -0,0 +1,70 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace miniml {
+
+    // Allocation totals since process start, as reported by whoever counts
+    // them (minimlc replaces the global operator new; see main.cpp).
+    struct AllocCounts {
+        std::uint64_t count = 0;
+        std::uint64_t bytes = 0;
+    };
+    using AllocSource = AllocCounts (*)();
+
+    // Wall time, CPU time, allocations and resident set growth per compiler
+    // phase. Phases nest: a phase started while another is running is
+    // reported below it (parse → lex / parse / build_ast).
+    class PhaseTimer {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Phase {
+            std::string name;
+            int depth = 0;
+            double wallMs = 0;
+            double cpuMs = 0;
+            std::uint64_t allocs = 0;       // 0 without an AllocSource
+            std::uint64_t allocBytes = 0;
+            std::int64_t rssDeltaKb = 0;    // resident set size after - before
+        };
+
+        explicit PhaseTimer(AllocSource allocs = nullptr) : allocs_(allocs) {}
+
+        void begin(const std::string& name);
+        void end();
+
+        struct Scope {
+            PhaseTimer* t;
+            Scope(PhaseTimer* timer, const std::string& name) : t(timer) { if (t) t->begin(name); }
+            ~Scope() { if (t) t->end(); }
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+        const std::vector<Phase>& phases() const { return phases_; }
+        bool countsAllocations() const { return allocs_ != nullptr; }
+
+        std::string report() const;   // indented table, one row per phase
+        std::string json() const;     // {"phases":[...]} for metrics pipelines
+
+    private:
+        struct Open {
+            size_t index;
+            Clock::time_point wall;
+            double cpuMs;
+            AllocCounts allocs;
+            std::int64_t rssKb;
+        };
+
+        AllocSource allocs_;
+        std::vector<Phase> phases_;   // in start order
+        std::vector<Open> open_;
+    };
+
+    // Current resident set size in KiB (0 where the platform does not say).
+    std::int64_t residentSetKb();
+
+} // namespace miniml
@@ -0,0 +1,112 @@
+#include "WorkStealingPool.hpp"
+
+namespace miniml {
+
+// Deque index of the current thread for each pool it works for.
+static thread_local const WorkStealingPool* t_pool = nullptr;
+static thread_local std::size_t t_index = 0;
+
+void WorkStealingPool::Task::run() {
+  try {
+    fn_();
+  } catch (...) {
+    error_ = std::current_exception();
+  }
+  done_.store(true, std::memory_order_release);
+}
+
+WorkStealingPool::WorkStealingPool(unsigned threads) {
+  if (threads == 0) {
+    unsigned hw = std::thread::hardware_concurrency();
+    threads = hw > 1 ? hw - 1 : 1;
+  }
+  for (unsigned i = 0; i <= threads; ++i) deques_.push_back(std::make_unique<Deque>());
+  for (unsigned i = 0; i < threads; ++i) workers_.emplace_back([this, i] { work(i); });
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleepM_);
+    stop_.store(true);
+  }
+  sleepCv_.notify_all();
+  for (auto& w : workers_) w.join();
+}
+
+std::size_t WorkStealingPool::self() const {
+  return t_pool == this ? t_index : deques_.size() - 1;
+}
+
+void WorkStealingPool::fork(Task& t) {
+  auto& d = *deques_[self()];
+  {
+    std::lock_guard<std::mutex> lock(d.m);
+    d.tasks.push_back(&t);
+  }
+  queued_.fetch_add(1, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(sleepM_);   // no wake-up lost between a worker's check and its wait
+  }
+  sleepCv_.notify_one();
+}
+
+// Newest task of our own deque, else the oldest of someone else's.
+WorkStealingPool::Task* WorkStealingPool::take(std::size_t self) {
+  if (queued_.load(std::memory_order_acquire) == 0) return nullptr;
+  {
+    auto& d = *deques_[self];
+    std::lock_guard<std::mutex> lock(d.m);
+    if (!d.tasks.empty()) {
+      Task* t = d.tasks.back();
+      d.tasks.pop_back();
+      queued_.fetch_sub(1, std::memory_order_relaxed);
+      return t;
+    }
+  }
+  for (std::size_t k = 1; k < deques_.size(); ++k) {
+    auto& d = *deques_[(self + k) % deques_.size()];
+    std::lock_guard<std::mutex> lock(d.m);
+    if (!d.tasks.empty()) {
+      Task* t = d.tasks.front();
+      d.tasks.pop_front();
+      queued_.fetch_sub(1, std::memory_order_relaxed);
+      steals_.fetch_add(1, std::memory_order_relaxed);
+      return t;
+    }
+  }
+  return nullptr;
+}
+
+void WorkStealingPool::join(Task& t) {
+  std::size_t me = self();
+  {
+    auto& d = *deques_[me];
+    std::unique_lock<std::mutex> lock(d.m);
+    if (!d.tasks.empty() && d.tasks.back() == &t) {   // nobody took it: run it here
+      d.tasks.pop_back();
+      queued_.fetch_sub(1, std::memory_order_relaxed);
+      lock.unlock();
+      t.run();
+    }
+  }
+  while (!t.done()) {
+    if (Task* other = take(me)) other->run();
+    else std::this_thread::yield();
+  }
+  if (t.error_) std::rethrow_exception(t.error_);
+}
+
+void WorkStealingPool::work(std::size_t index) {
+  t_pool = this;
+  t_index = index;
+  while (!stop_.load(std::memory_order_relaxed)) {
+    if (Task* t = take(index)) {
+      t->run();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleepM_);
+    sleepCv_.wait(lock, [&] { return stop_.load() || queued_.load(std::memory_order_acquire) > 0; });
+  }
+}
+
+} // namespace miniml
@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace miniml {
+
+    // Fork-join thread pool with one deque per worker. fork() pushes on the
+    // calling thread's deque; idle workers steal from the other end of other
+    // deques. join() runs the task itself if nobody has taken it yet and
+    // otherwise runs other queued tasks until it is done, so a waiting thread
+    // never blocks a worker.
+    //
+    // Threads that are not workers (the one that starts an evaluation) share
+    // one extra deque.
+    class WorkStealingPool {
+    public:
+        // Work for fork()/join(). Lives in the forking frame, which joins it
+        // before returning.
+        class Task {
+        public:
+            explicit Task(std::function<void()> fn) : fn_(std::move(fn)) {}
+            Task(const Task&) = delete;
+            Task& operator=(const Task&) = delete;
+
+            bool done() const { return done_.load(std::memory_order_acquire); }
+
+        private:
+            friend class WorkStealingPool;
+            std::function<void()> fn_;
+            std::exception_ptr error_;
+            std::atomic<bool> done_{false};
+
+            void run();
+        };
+
+        // 'threads' background workers; 0 means one per hardware thread, less the caller.
+        explicit WorkStealingPool(unsigned threads = 0);
+        ~WorkStealingPool();
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        void fork(Task& t);
+        // Waits for 't'; rethrows what its function threw.
+        void join(Task& t);
+
+        unsigned threads() const { return static_cast<unsigned>(workers_.size()); }
+        std::uint64_t steals() const { return steals_.load(std::memory_order_relaxed); }
+
+    private:
+        struct Deque {
+            std::mutex m;
+            std::deque<Task*> tasks;
+        };
+
+        std::vector<std::unique_ptr<Deque>> deques_;   // one per worker, the last for other threads
+        std::vector<std::thread> workers_;
+        std::atomic<std::size_t> queued_{0};
+        std::atomic<std::uint64_t> steals_{0};
+        std::atomic<bool> stop_{false};
+        std::mutex sleepM_;
+        std::condition_variable sleepCv_;
+
+        std::size_t self() const;
+        Task* take(std::size_t self);
+        void work(std::size_t index);
+    };
+
+} // namespace miniml
@@ -0,0 +1,53 @@
+let f0 = \f0_a0 -> \f0_a1 -> \f0_a2 -> \f0_a3 -> \f0_a4 -> \f0_a5 -> \f0_a6 -> \f0_a7 -> \f0_a8 -> \f0_a9 -> \f0_a10 -> \f0_a11 -> \f0_a12 -> \f0_a13 -> \f0_a14 -> \f0_a15 -> \f0_a16 -> \f0_a17 -> \f0_a18 -> \f0_a19 -> \f0_a20 -> \f0_a21 -> \f0_a22 -> \f0_a23 -> \f0_a24 -> \f0_a25 -> \f0_a26 -> \f0_a27 -> \f0_a28 -> \f0_a29 -> \f0_a30 -> \f0_a31 -> \f0_a32 -> \f0_a33 -> \f0_a34 -> \f0_a35 -> \f0_a36 -> \f0_a37 -> \f0_a38 -> \f0_a39 -> \f0_a40 -> \f0_a41 -> \f0_a42 -> \f0_a43 -> \f0_a44 -> \f0_a45 -> \f0_a46 -> \f0_a47 -> \f0_a48 -> \f0_a49 -> \f0_a50 -> \f0_a51 -> \f0_a52 -> \f0_a53 -> \f0_a54 -> \f0_a55 -> \f0_a56 -> \f0_a57 -> \f0_a58 -> \f0_a59 -> \f0_a60 -> \f0_a61 -> \f0_a62 -> \f0_a63 -> \f0_a64 -> \f0_a65 -> \f0_a66 -> \f0_a67 -> \f0_a68 -> \f0_a69 -> \f0_a70 -> \f0_a71 -> \f0_a72 -> \f0_a73 -> \f0_a74 -> \f0_a75 -> \f0_a76 -> \f0_a77 -> \f0_a78 -> \f0_a79 -> \f0_a80 -> \f0_a81 -> \f0_a82 -> \f0_a83 -> \f0_a84 -> \f0_a85 -> \f0_a86 -> \f0_a87 -> \f0_a88 -> \f0_a89 -> \f0_a90 -> \f0_a91 -> \f0_a92 -> \f0_a93 -> \f0_a94 -> \f0_a95 -> \f0_a96 -> \f0_a97 -> \f0_a98 -> \f0_a99 -> (f0_a0 + f0_a1 + (if f0_a2 then 1 else 0) + f0_a3 + f0_a4 + (if f0_a5 then 1 else 0) + f0_a6 + f0_a7 + (if f0_a8 then 1 else 0) + f0_a9 + f0_a10 + (if f0_a11 then 1 else 0) + f0_a12 + f0_a13 + (if f0_a14 then 1 else 0) + f0_a15 + f0_a16 + (if f0_a17 then 1 else 0) + f0_a18 + f0_a19 + (if f0_a20 then 1 else 0) + f0_a21 + f0_a22 + (if f0_a23 then 1 else 0) + f0_a24 + f0_a25 + (if f0_a26 then 1 else 0) + f0_a27 + f0_a28 + (if f0_a29 then 1 else 0) + f0_a30 + f0_a31 + (if f0_a32 then 1 else 0) + f0_a33 + f0_a34 + (if f0_a35 then 1 else 0) + f0_a36 + f0_a37 + (if f0_a38 then 1 else 0) + f0_a39 + f0_a40 + (if f0_a41 then 1 else 0) + f0_a42 + f0_a43 + (if f0_a44 then 1 else 0) + f0_a45 + f0_a46 + (if f0_a47 then 1 else 0) + f0_a48 + f0_a49 + (if f0_a50 then 1 else 0) + f0_a51 + f0_a52 + (if f0_a53 then 1 else 0) + f0_a54 + f0_a55 + (if f0_a56 then 1 else 0) + f0_a57 + f0_a58 + (if f0_a59 then 1 else 0) + f0_a60 + f0_a61 + (if f0_a62 then 1 else 0) + f0_a63 + f0_a64 + (if f0_a65 then 1 else 0) + f0_a66 + f0_a67 + (if f0_a68 then 1 else 0) + f0_a69 + f0_a70 + (if f0_a71 then 1 else 0) + f0_a72 + f0_a73 + (if f0_a74 then 1 else 0) + f0_a75 + f0_a76 + (if f0_a77 then 1 else 0) + f0_a78 + f0_a79 + (if f0_a80 then 1 else 0) + f0_a81 + f0_a82 + (if f0_a83 then 1 else 0) + f0_a84 + f0_a85 + (if f0_a86 then 1 else 0) + f0_a87 + f0_a88 + (if f0_a89 then 1 else 0) + f0_a90 + f0_a91 + (if f0_a92 then 1 else 0) + f0_a93 + f0_a94 + (if f0_a95 then 1 else 0) + f0_a96 + f0_a97 + (if f0_a98 then 1 else 0) + f0_a99) in
+let g3 = f0 ((84 + 8)) ((76 - 7)) (true) ((let l1 = 83 in l1)) ((39 - 0)) ((if true then true else false)) ((84 + 4)) ((99 + 0)) (false) ((let l2 = true in 58)) ((48 + 9)) in
+let c10 = g3 (false) (92) ((39 - 3)) ((90 <= 25)) (20) ((91 - 2)) (true) ((95 - 1)) ((2 - 8)) ((47 >= 8)) ((let l4 = (17, 79) in 83)) ((let l5 = true in 59)) ((not true)) ((40 - 3)) ((83 - 8)) ((not false)) (87) ((54 - 0)) (true) (31) (9) ((38 >= 91)) ((20 - 4)) (43) ((70 = 66)) ((67 - 2)) (84) ((let l6 = 14 in true)) ((16 - 3)) ((66 + 6)) ((98 >= 60)) ((85 - 8)) ((71 - 1)) ((true || true)) ((if true then 47 else 64)) (88) ((if true then true else true)) ((42 - 3)) ((86 - 6)) ((85 >= 97)) ((52 + 9)) ((10 - 3)) ((44 <> 46)) ((92 - 3)) (0) (true) (71) ((18 + 6)) ((76 >= 52)) ((if false then 95 else 98)) (60) (true) ((77 + 1)) ((34 - 6)) ((71 > 93)) ((81 + 0)) ((82 + 5)) ((36 >= 15)) (82) ((8 + 1)) ((88 = 50)) ((82 - 1)) (0) ((66 <> 2)) ((if true then 57 else 93)) ((let l7 = false in 71)) ((90 >= 71)) ((42 - 3)) (67) ((let l8 = 52 in false)) ((if true then 1 else 94)) ((44 + 9)) ((false || false)) ((79 + 1)) (93) (((false, true) <> (true, false))) ((51 + 0)) ((48 - 8)) ((71 = 40)) (88) ((if true then 16 else 91)) ((let l9 = 92 in true)) ((if true then 0 else 95)) ((31 - 8)) ((98 > 48)) ((83 - 5)) ((64 - 4)) (true) ((60 + 4)) in
+let g18 = f0 (44) ((let l11 = 95 in l11)) ((31 <= 89)) ((15 - 1)) (22) ((98 > 28)) ((75 - 6)) ((21 + 3)) (true) ((if true then 0 else 56)) (66) ((99 <= 16)) ((87 - 3)) ((0 + 8)) (true) ((63 - 8)) (13) (true) (87) ((let l12 = 85 in l12)) ((73 <> 57)) ((59 + 3)) ((56 - 3)) ((true || true)) (43) ((let l13 = 67 in l13)) ((if true then false else true)) ((86 + 1)) (89) ((42 <= 61)) ((34 - 5)) ((40 + 6)) ((27 <= 91)) ((35 + 0)) (77) ((let l14 = 19 in false)) ((65 - 1)) ((82 - 8)) ((if false then false else false)) (20) (41) ((let l15 = (28, false) in true)) ((87 + 4)) ((8 + 9)) ((let l16 = 34 in true)) ((8 + 7)) ((if false then 17 else 80)) ((not true)) ((97 + 7)) ((62 - 4)) ((not false)) (80) ((77 - 3)) (false) (76) ((7 + 0)) (((3, 35, false) = (31, 33, false))) ((52 - 5)) ((24 + 9)) ((false && false)) ((let l17 = false in 39)) ((88 + 6)) ((85 <> 59)) ((19 - 0)) ((24 + 7)) ((true || false)) (66) ((58 + 1)) ((42 >= 74)) in
+let c24 = g18 ((89 - 8)) ((85 - 5)) ((true && true)) ((89 + 1)) ((2 - 5)) ((97 <= 99)) ((95 + 4)) ((78 - 8)) ((not false)) ((let l19 = 41 in l19)) ((66 - 0)) ((2 >= 71)) ((let l20 = (true, 80, 81) in 13)) ((99 - 3)) ((true || false)) ((let l21 = 35 in l21)) (60) (true) ((let l22 = 60 in l22)) ((let l23 = true in 32)) ((false && false)) ((88 - 7)) (47) ((false || false)) ((97 - 9)) ((33 + 5)) ((76 > 63)) ((88 - 7)) ((82 - 5)) ((not true)) ((27 - 5)) in
+let g27 = f0 ((59 - 8)) ((96 + 8)) ((true && false)) ((5 + 9)) ((let l25 = 26 in l25)) ((let l26 = 13 in false)) (85) ((55 - 8)) ((85 = 77)) (52) ((if false then 59 else 28)) ((false <> false)) ((60 + 0)) ((78 - 3)) in
+let c31 = g27 ((if false then true else false)) ((29 - 9)) ((30 - 2)) ((if true then true else true)) ((98 - 6)) ((40 - 8)) (false) ((45 - 8)) ((92 - 8)) ((65 > 4)) ((if true then 50 else 64)) ((32 + 6)) (false) (50) ((if false then 71 else 22)) (true) ((17 + 8)) ((24 + 6)) ((not true)) ((79 + 1)) ((33 + 0)) ((not false)) ((97 + 8)) ((36 - 2)) ((true || false)) ((let l28 = true in 65)) ((54 - 5)) ((not false)) ((42 - 5)) (38) (false) ((64 + 1)) ((47 - 8)) (((true, true, 82) = (true, false, 15))) ((75 + 7)) (84) (false) (31) ((17 - 5)) (false) ((36 - 3)) ((91 - 1)) (true) ((96 + 5)) ((74 - 8)) ((true && false)) ((36 - 2)) ((1 + 9)) ((true || true)) ((58 + 8)) ((let l29 = true in 40)) ((52 = 46)) ((58 - 8)) ((62 + 7)) ((82 <> 51)) ((61 + 8)) ((95 + 5)) ((42 <> 53)) ((93 - 9)) ((54 - 1)) ((if false then true else false)) ((66 + 8)) ((5 + 8)) ((99 < 38)) (95) ((30 - 0)) ((not true)) ((56 - 9)) ((90 + 4)) (true) ((63 - 2)) (75) ((88 >= 79)) ((44 - 0)) ((23 + 1)) (false) ((49 - 9)) ((let l30 = false in 83)) ((true && false)) (18) ((58 - 3)) ((45 > 30)) ((40 - 2)) (95) ((if false then false else false)) ((58 - 7)) in
+let g38 = f0 ((let l32 = (84, true, false) in 67)) ((let l33 = (16, false, true) in 50)) ((not true)) ((9 + 6)) ((3 + 9)) ((true || false)) ((64 - 8)) ((95 - 0)) (false) (3) ((30 - 7)) ((14 <> 41)) ((56 - 7)) (13) (true) ((10 + 3)) ((30 - 7)) ((true || true)) ((5 + 5)) ((41 + 9)) ((25 < 74)) (82) ((11 + 2)) ((if false then true else false)) ((20 + 3)) (14) (false) (32) ((1 + 2)) ((not false)) ((8 - 3)) ((4 + 5)) (true) ((72 + 5)) ((let l34 = 60 in 75)) (false) ((71 - 5)) ((8 - 1)) (true) ((if false then 57 else 16)) ((71 - 8)) ((if true then false else false)) ((35 - 8)) (60) (true) ((68 + 7)) ((let l35 = true in 60)) (false) ((84 - 1)) (36) (true) (78) ((15 - 1)) ((not false)) ((3 + 4)) ((6 - 8)) (true) ((let l36 = true in 62)) (27) ((true <> true)) ((98 + 0)) ((97 - 3)) ((if false then true else false)) ((let l37 = (false, 20, 97) in 8)) (54) ((66 < 83)) (33) in
+let c40 = g38 ((73 + 4)) ((not false)) ((98 - 9)) ((81 + 8)) (true) (52) ((11 + 1)) (true) (96) ((75 - 8)) ((if false then true else false)) (5) ((let l39 = 89 in l39)) ((false <> true)) ((48 - 5)) ((96 - 1)) (((true, false) = (true, false))) ((30 + 7)) ((10 + 6)) ((96 = 22)) ((85 + 1)) ((78 - 8)) ((53 < 49)) (25) ((49 - 6)) ((71 >= 77)) ((8 - 6)) ((33 - 7)) ((false && true)) ((59 - 3)) ((26 - 4)) ((52 <= 32)) ((28 - 1)) in
+let g42 = f0 ((19 + 9)) ((21 + 5)) ((not true)) ((14 + 2)) (34) ((15 <> 1)) ((18 - 7)) ((99 + 2)) ((if false then true else true)) ((if false then 42 else 2)) ((15 - 9)) ((let l41 = 67 in false)) ((75 + 8)) ((79 - 3)) (true) (24) (86) ((true && false)) ((54 + 8)) ((29 - 8)) (false) ((30 + 6)) ((if true then 81 else 32)) ((false || false)) ((if false then 42 else 58)) ((if true then 7 else 81)) ((76 >= 27)) ((16 - 1)) ((20 - 8)) ((if false then false else false)) ((89 - 0)) in
+let c46 = g42 ((68 + 0)) ((5 <> 12)) (3) ((49 + 6)) ((if true then true else false)) ((80 - 9)) ((36 + 7)) (false) ((49 + 1)) ((36 - 5)) (((false, 3) <> (false, 89))) ((93 - 0)) (76) ((if true then false else false)) ((82 + 2)) ((let l43 = false in 44)) (true) ((74 - 0)) (28) (true) ((27 - 5)) ((28 + 3)) (false) ((84 - 3)) ((56 - 4)) ((28 <> 9)) ((16 + 0)) ((2 + 5)) ((false && true)) ((94 - 3)) ((29 - 5)) ((if true then false else false)) (80) ((0 - 6)) ((11 < 41)) ((91 + 0)) ((if false then 92 else 43)) ((96 > 94)) ((22 - 3)) ((52 + 1)) ((false && true)) ((58 - 7)) ((40 - 1)) ((57 >= 17)) ((44 - 6)) ((25 + 1)) ((let l44 = 65 in true)) ((64 - 1)) ((87 - 8)) ((false || true)) ((23 - 3)) ((3 - 8)) (false) ((57 - 5)) ((48 + 9)) (false) (94) (42) (((48, true) <> (54, true))) ((34 - 1)) ((2 + 7)) ((not false)) ((27 + 6)) (15) (false) (71) ((let l45 = 49 in 5)) ((16 > 38)) ((35 + 8)) in
+let g50 = f0 (98) ((9 - 2)) ((let l47 = 76 in false)) ((99 + 5)) ((let l48 = false in 6)) ((not true)) ((26 + 0)) ((99 - 6)) ((76 >= 77)) ((77 - 9)) ((if false then 54 else 67)) (true) (79) ((44 - 6)) ((88 <= 13)) ((0 - 4)) ((32 - 6)) ((let l49 = (true, false) in true)) (7) ((49 - 0)) ((false || true)) ((4 + 1)) ((17 - 5)) ((not true)) in
+let c54 = g50 (86) ((78 + 3)) ((if false then false else false)) ((39 - 4)) ((51 + 3)) ((false || true)) ((93 - 3)) ((74 + 6)) ((0 >= 69)) ((48 - 2)) ((60 + 9)) ((false || false)) ((88 + 5)) (76) ((true || true)) ((9 + 3)) ((80 + 0)) ((not true)) ((47 + 6)) (45) ((false || false)) (49) (70) ((97 <= 92)) ((25 - 8)) ((35 + 5)) ((true <> true)) (42) ((let l51 = 74 in l51)) ((if true then true else true)) (18) ((23 + 1)) ((not true)) ((42 + 2)) ((12 - 6)) ((false || true)) ((48 - 2)) ((if false then 17 else 21)) ((not true)) ((45 - 9)) ((68 + 5)) ((let l52 = 13 in false)) (14) (51) ((56 < 58)) (39) ((if false then 8 else 33)) (true) ((1 - 5)) ((22 + 9)) (true) (65) ((62 + 3)) (false) ((54 - 2)) ((91 + 7)) ((70 < 71)) ((if false then 32 else 4)) (13) (true) ((60 - 0)) ((84 + 5)) ((let l53 = 75 in true)) ((64 - 4)) ((86 - 4)) ((2 = 84)) ((1 - 7)) ((36 + 4)) ((if true then false else true)) ((30 - 3)) ((if true then 45 else 87)) ((if true then true else true)) (38) ((39 - 6)) ((not true)) ((67 - 9)) in
+let g55 = f0 ((if false then 67 else 9)) ((31 + 6)) in
+let c60 = g55 ((if true then false else true)) ((6 + 8)) ((40 - 2)) ((false || true)) ((let l56 = (false, 48) in 43)) ((39 + 7)) ((true && true)) ((if true then 77 else 59)) ((65 + 8)) ((81 < 42)) ((95 - 3)) ((48 + 1)) ((65 <= 62)) ((52 - 9)) (48) ((if true then false else false)) ((36 - 7)) (98) ((false && true)) ((40 - 2)) ((12 + 5)) ((if false then true else false)) ((95 + 5)) ((59 - 4)) ((33 <= 77)) ((50 - 7)) ((19 - 8)) ((if true then true else false)) ((96 - 1)) (68) ((if true then false else false)) (6) ((0 - 9)) ((if true then true else false)) ((70 + 3)) ((19 - 3)) ((80 <> 50)) (7) (18) ((let l57 = 1 in true)) ((55 - 9)) ((61 + 9)) ((89 > 7)) ((let l58 = 43 in 87)) ((5 - 0)) ((not true)) ((if false then 83 else 44)) ((26 - 7)) (false) ((23 - 9)) ((78 + 6)) ((if false then true else true)) ((89 - 6)) (28) (true) ((if true then 68 else 5)) ((40 - 1)) ((74 <> 43)) ((88 + 8)) ((97 + 4)) (false) ((52 - 8)) (27) ((97 = 82)) ((73 + 4)) ((67 - 1)) ((not false)) (2) (49) ((true = true)) ((34 + 0)) (74) ((true && true)) (43) (31) ((not false)) ((79 - 1)) ((65 + 4)) ((44 <= 91)) (78) ((50 + 9)) (true) ((82 - 7)) ((44 - 6)) (false) (22) ((76 - 1)) (false) (19) ((if true then 32 else 43)) (false) (86) ((let l59 = 0 in 4)) ((false && false)) ((95 - 9)) ((86 + 1)) ((21 > 34)) ((if true then 78 else 98)) in
+let g66 = f0 ((7 - 6)) ((71 - 5)) ((true || false)) ((if false then 93 else 83)) ((28 + 2)) ((not false)) ((let l61 = 29 in l61)) (13) ((if true then false else false)) ((17 + 1)) ((55 - 1)) ((if true then false else true)) ((42 + 7)) ((88 - 4)) ((88 <= 0)) ((let l62 = 73 in l62)) (28) ((35 < 89)) (26) (72) ((not true)) ((58 + 1)) ((25 + 1)) (true) ((24 - 5)) ((70 + 1)) (false) ((13 - 1)) ((45 - 6)) ((74 <> 27)) ((40 - 9)) ((32 + 5)) ((false || true)) (26) ((if true then 95 else 87)) ((false || true)) ((6 + 5)) ((86 + 8)) ((true && false)) ((14 + 9)) (1) ((55 > 80)) ((20 + 5)) (0) ((4 <> 4)) ((94 + 8)) ((6 + 2)) ((false && false)) ((17 + 9)) ((if true then 87 else 11)) ((17 <> 59)) ((65 - 2)) (14) ((false = true)) ((20 + 6)) ((35 - 6)) ((25 <= 52)) ((23 + 0)) ((30 - 1)) (false) ((84 - 6)) ((6 + 3)) ((if false then false else true)) ((if true then 68 else 15)) ((let l63 = 62 in l63)) ((99 <> 79)) ((35 - 1)) ((79 + 8)) ((30 > 76)) (18) ((1 - 4)) (((true, true) = (true, false))) ((58 + 0)) ((if false then 14 else 17)) ((let l64 = 9 in false)) ((96 - 8)) ((62 - 9)) ((if false then false else true)) ((36 - 8)) ((54 - 4)) ((23 >= 32)) ((59 - 6)) (67) ((40 >= 67)) ((let l65 = 52 in l65)) ((if false then 48 else 21)) (true) in
+let c68 = g66 ((23 + 2)) ((if true then 93 else 87)) ((if false then false else false)) ((21 + 2)) ((if false then 82 else 75)) (false) ((43 + 8)) ((62 - 9)) ((58 > 98)) ((44 + 2)) ((24 + 7)) ((let l67 = 28 in false)) ((79 - 5)) in
+let g70 = f0 ((50 + 2)) ((51 + 2)) ((not false)) ((let l69 = (85, 65) in 49)) in
+let c75 = g70 ((59 + 6)) (true) ((44 - 2)) ((76 - 9)) ((if true then false else true)) (45) ((39 + 6)) ((82 <> 47)) ((73 + 1)) (77) ((if false then false else true)) ((56 - 9)) ((22 - 2)) (true) (12) (22) ((if true then false else true)) (81) (31) ((not false)) ((35 - 1)) ((96 - 2)) (true) ((73 - 4)) ((if true then 21 else 37)) ((not false)) (3) ((9 + 9)) ((93 <> 78)) ((let l71 = 7 in l71)) (98) (false) (2) ((28 - 0)) (false) ((9 + 8)) ((66 + 7)) ((8 <= 7)) ((16 + 1)) ((17 + 6)) ((47 > 0)) (58) ((77 - 9)) ((true <> true)) ((8 - 5)) ((31 - 1)) ((let l72 = 3 in true)) ((68 - 5)) ((31 - 8)) ((let l73 = 74 in false)) ((11 - 9)) ((3 + 3)) (false) (69) ((82 - 1)) ((not true)) (57) (24) ((34 < 29)) (93) ((19 + 5)) ((false || false)) ((89 - 1)) (53) ((if true then true else false)) ((69 + 6)) (46) ((23 <= 65)) ((49 + 9)) ((14 + 5)) ((36 <> 2)) ((35 + 6)) ((89 + 5)) ((true && false)) ((33 - 3)) ((72 + 1)) (false) (22) ((62 + 3)) ((not false)) ((9 - 9)) ((61 - 0)) (false) (44) ((62 + 0)) ((57 <> 2)) ((64 - 8)) ((92 - 0)) ((false && true)) (0) (89) (((63, false, 73) = (33, false, 9))) ((32 - 3)) ((let l74 = false in 36)) (true) ((98 + 5)) in
+let g85 = f0 ((if true then 34 else 0)) (71) (false) ((if false then 26 else 68)) ((48 - 0)) ((not false)) ((46 - 1)) (24) ((not true)) ((let l76 = 4 in 81)) (76) ((false || false)) ((55 - 5)) ((3 - 9)) (false) (93) ((51 - 2)) ((not false)) ((let l77 = (63, true) in 85)) ((56 + 1)) ((80 = 85)) ((70 + 8)) ((28 + 8)) ((false || false)) ((21 + 4)) ((let l78 = 57 in l78)) ((95 < 1)) ((63 - 2)) ((37 + 4)) (true) ((68 + 3)) ((41 + 1)) ((let l79 = false in l79)) ((26 - 8)) ((81 + 0)) ((85 <= 67)) ((24 - 5)) (73) ((false <> true)) ((47 + 9)) ((6 + 5)) ((let l80 = 53 in false)) ((54 - 7)) (59) (true) (32) (72) ((not true)) ((18 + 5)) ((49 - 9)) ((not true)) ((23 - 8)) ((88 - 0)) ((44 = 86)) ((16 - 8)) ((15 - 8)) (true) ((if true then 71 else 18)) ((43 + 6)) ((35 < 45)) ((if true then 70 else 85)) ((37 - 9)) ((false && false)) ((47 + 3)) ((75 - 1)) ((27 >= 51)) ((let l81 = (false, true, 39) in 79)) ((34 + 4)) ((56 >= 15)) (84) (25) ((let l82 = 28 in false)) ((6 - 1)) ((33 - 6)) (false) ((66 + 8)) ((46 - 4)) ((1 <= 35)) ((if true then 52 else 41)) ((let l83 = 10 in l83)) ((81 = 61)) ((76 + 4)) ((if true then 60 else 68)) ((let l84 = 9 in false)) (81) ((0 - 1)) ((90 <> 86)) (68) (33) ((0 <> 88)) in
+let c86 = g85 (28) (54) ((if true then false else false)) ((58 + 0)) (16) ((82 > 58)) (40) (44) ((true || false)) ((98 + 9)) in
+let g88 = f0 (69) (18) ((76 <= 85)) ((86 + 3)) ((28 + 8)) ((true && true)) (51) ((61 - 2)) ((10 = 82)) (49) ((93 + 8)) (true) ((if false then 73 else 56)) ((91 + 2)) ((let l87 = 44 in true)) ((19 - 0)) ((if true then 94 else 91)) ((not false)) ((68 + 5)) (88) ((if true then false else false)) ((24 - 1)) in
+let c99 = g88 ((85 - 4)) ((89 >= 51)) (45) ((85 - 7)) ((14 <> 17)) ((88 + 9)) ((20 + 3)) ((not true)) ((66 + 5)) ((55 + 2)) (true) ((46 - 9)) ((69 - 1)) ((true && false)) (50) ((74 + 7)) ((not true)) ((94 - 5)) (5) ((if true then false else false)) ((24 + 2)) ((96 + 8)) ((not true)) ((9 - 3)) ((0 + 2)) ((true || true)) (88) ((40 + 7)) (true) ((22 + 8)) ((51 + 2)) ((51 <= 40)) ((let l89 = 53 in l89)) (71) ((false && true)) ((73 - 9)) ((11 + 0)) ((74 >= 12)) ((5 + 0)) ((23 - 1)) ((let l90 = false in false)) ((let l91 = 12 in l91)) ((17 + 7)) ((50 = 50)) ((17 - 4)) ((let l92 = 73 in 59)) ((let l93 = 98 in true)) ((19 - 9)) (73) ((let l94 = true in l94)) ((if true then 10 else 7)) (46) ((0 < 74)) ((let l95 = 10 in l95)) ((90 + 8)) (false) ((let l96 = false in 30)) ((38 + 3)) (false) ((if true then 55 else 78)) ((70 - 1)) ((false || true)) ((68 + 9)) ((64 + 0)) ((if false then false else false)) ((12 - 5)) (0) ((let l97 = 58 in true)) ((55 - 0)) ((let l98 = 15 in 58)) ((true || true)) ((70 + 4)) ((39 - 4)) ((true && false)) (0) (83) ((if true then true else false)) ((78 - 5)) in
+let g100 = f0 ((33 - 1)) (50) (false) ((53 - 8)) ((98 - 2)) ((true && true)) (27) ((42 - 1)) ((if true then false else true)) ((25 + 4)) (54) ((true && true)) ((44 - 8)) ((19 - 5)) ((80 <> 61)) ((14 + 4)) ((57 - 2)) ((false || true)) ((12 + 3)) in
+let c105 = g100 ((82 + 6)) ((not false)) ((61 - 7)) ((17 + 2)) ((90 >= 47)) ((24 + 1)) ((let l101 = 34 in 41)) ((not false)) (89) ((39 + 3)) ((25 <= 50)) ((3 + 2)) (44) (true) ((86 + 7)) ((15 + 0)) ((not false)) (33) ((62 - 8)) ((if false then true else true)) ((93 + 5)) ((88 - 7)) (false) (23) ((53 - 2)) ((true <> false)) ((37 - 8)) ((28 - 8)) ((let l102 = (false, true) in false)) ((26 - 5)) (21) (true) ((98 + 6)) (81) ((33 > 43)) ((71 - 8)) (15) (false) ((if false then 31 else 68)) (74) ((false || false)) ((94 + 3)) (45) ((false && true)) (17) ((92 + 5)) ((true || false)) ((let l103 = (true, true) in 92)) ((82 - 0)) ((true && true)) (88) (97) (true) ((72 + 1)) ((29 + 8)) ((let l104 = 27 in false)) (20) ((50 + 4)) ((false || false)) ((if true then 7 else 70)) (16) ((38 <> 57)) ((98 - 4)) ((51 - 0)) ((63 >= 67)) ((36 - 0)) ((25 + 1)) ((false || false)) ((46 - 0)) ((25 + 1)) (false) (50) (37) ((true <> true)) ((if false then 22 else 49)) ((63 + 8)) ((52 >= 92)) ((12 - 6)) (68) ((true || false)) ((64 + 5)) in
+let g110 = f0 ((12 - 6)) (83) (true) ((16 - 7)) ((if false then 48 else 74)) (false) ((let l106 = 98 in l106)) ((89 + 3)) ((if false then false else false)) ((36 + 6)) ((87 + 2)) ((17 >= 8)) ((45 - 7)) ((if true then 67 else 79)) (false) ((let l107 = 40 in l107)) (2) (false) ((18 - 2)) (96) ((if true then false else true)) ((79 - 0)) ((79 - 0)) ((not false)) (1) ((43 + 1)) (true) (78) ((84 - 0)) (false) ((72 - 6)) ((if true then 47 else 2)) ((92 >= 74)) (67) ((68 - 0)) ((false || true)) ((76 - 1)) ((25 + 4)) ((false && true)) ((83 + 8)) ((90 + 1)) ((false && false)) ((51 - 7)) ((62 - 2)) ((false || true)) ((75 - 0)) ((50 - 4)) ((not false)) ((6 + 9)) ((53 - 0)) ((let l108 = 93 in false)) (19) ((49 - 4)) ((false && true)) ((if true then 39 else 69)) ((47 - 7)) ((20 <> 74)) (62) ((38 + 5)) (true) ((78 - 5)) ((39 - 0)) ((63 > 58)) ((72 + 1)) (34) (false) ((if true then 50 else 40)) ((57 + 6)) ((not true)) (84) ((57 + 4)) ((33 < 80)) ((53 - 8)) ((17 - 9)) ((if false then true else true)) (41) (21) ((if false then true else true)) ((let l109 = false in 21)) in
+let c113 = g110 ((6 - 0)) ((false && true)) ((89 + 5)) ((83 + 5)) ((not true)) (31) ((56 - 1)) (false) ((if true then 14 else 29)) ((51 + 4)) (true) ((let l111 = true in 18)) (1) ((false && false)) ((23 + 1)) (56) ((let l112 = 53 in true)) ((if false then 75 else 90)) (58) ((false <> false)) (78) in
+let g116 = f0 (6) ((if true then 18 else 41)) ((77 < 44)) ((86 + 0)) ((61 - 3)) ((27 >= 83)) ((if true then 82 else 9)) ((35 - 6)) (true) ((87 + 0)) ((21 + 1)) (false) (5) ((79 - 9)) (false) ((47 + 7)) ((93 - 7)) ((not true)) ((52 - 9)) ((19 - 4)) ((if false then true else false)) ((41 - 0)) (8) ((84 = 36)) ((54 - 2)) ((31 + 1)) ((94 <> 20)) ((let l114 = false in 11)) ((96 + 6)) ((false || true)) ((26 - 3)) ((51 - 5)) ((let l115 = 98 in true)) ((32 + 3)) ((if true then 23 else 28)) ((20 <> 24)) (92) ((79 - 8)) ((true && true)) in
+let c120 = g116 ((48 - 2)) ((3 - 2)) ((not true)) ((65 + 9)) ((79 + 2)) ((55 <= 44)) ((if true then 68 else 34)) ((6 - 9)) ((not true)) ((23 - 1)) ((60 - 6)) ((not false)) (12) ((let l117 = 48 in l117)) ((not true)) ((58 + 2)) ((58 + 6)) ((false <> false)) ((72 - 6)) ((12 + 4)) ((let l118 = (false, 45, 63) in false)) ((43 - 3)) ((62 - 1)) (true) ((56 - 6)) (56) ((5 <= 94)) ((89 - 3)) ((87 + 5)) ((false && true)) ((let l119 = (true, true, 1) in 25)) (92) ((43 <= 35)) ((51 + 4)) ((if false then 8 else 55)) (true) ((37 + 3)) (16) ((44 >= 10)) ((if true then 28 else 29)) ((93 + 6)) ((false || false)) ((24 - 7)) ((11 + 2)) ((not true)) (58) (17) ((false <> true)) ((65 - 6)) ((88 - 4)) ((13 <> 1)) ((74 - 2)) ((if false then 62 else 15)) ((65 >= 96)) ((65 + 7)) (83) (false) ((79 - 9)) ((24 + 4)) ((58 <= 18)) ((17 - 9)) in
+let c127 = f0 ((31 + 0)) (25) ((if false then false else true)) ((58 + 3)) ((12 + 4)) ((false && false)) ((9 - 7)) ((3 - 6)) (false) ((17 + 6)) ((62 + 1)) ((let l121 = true in true)) ((43 - 0)) ((16 - 7)) ((true || true)) (14) ((2 - 1)) ((12 = 21)) (41) ((44 - 8)) ((false || true)) ((66 + 3)) ((31 + 7)) ((not false)) ((98 - 4)) ((28 - 0)) (true) ((60 - 0)) ((if true then 96 else 99)) ((54 <= 74)) ((let l122 = 16 in 87)) ((60 - 2)) (true) ((let l123 = (false, true, 3) in 9)) ((97 + 7)) (false) ((42 + 4)) ((35 - 9)) ((true && false)) ((1 - 3)) ((26 - 1)) ((not false)) ((43 + 1)) ((if false then 78 else 50)) ((19 < 25)) (63) (10) ((not true)) ((5 - 4)) (77) ((26 = 89)) (79) (75) ((77 < 0)) ((70 - 5)) ((77 - 1)) (true) ((if false then 89 else 60)) (8) ((true && false)) (45) (49) (true) ((36 - 6)) ((53 + 2)) ((31 >= 29)) (51) ((10 + 2)) ((not true)) ((94 + 2)) ((28 + 9)) ((54 < 1)) (69) ((81 + 7)) ((70 < 20)) ((20 + 7)) ((69 - 6)) (true) (50) ((77 + 1)) ((let l124 = (true, 40) in false)) (18) ((10 + 2)) ((16 <> 66)) ((89 + 9)) ((if true then 77 else 90)) ((let l125 = 20 in true)) ((97 - 3)) ((let l126 = true in 57)) ((not false)) ((59 + 1)) ((if true then 99 else 22)) ((true = true)) ((85 - 4)) ((93 - 4)) (false) ((84 - 5)) (20) ((58 = 20)) ((50 + 1)) in
+let g130 = f0 (63) ((4 + 0)) (true) ((81 + 8)) ((31 - 6)) (false) ((26 - 1)) ((12 - 5)) ((not true)) ((36 + 8)) (17) ((52 <= 34)) ((8 + 4)) ((5 + 0)) (false) ((83 + 1)) ((81 + 3)) ((if false then false else false)) ((27 - 1)) ((42 - 9)) ((false && false)) ((if false then 90 else 75)) ((if true then 91 else 47)) (false) ((21 - 4)) ((8 - 8)) ((true && false)) ((50 + 1)) ((9 + 2)) ((60 >= 84)) (30) (43) ((42 = 57)) ((48 - 7)) (91) ((not true)) ((10 - 0)) ((26 - 3)) ((let l128 = 4 in false)) (20) (25) ((true <> true)) ((0 + 7)) (71) ((false = false)) ((11 - 3)) ((37 + 6)) ((true && false)) ((3 + 4)) (93) (true) ((if false then 70 else 99)) ((if false then 54 else 32)) ((let l129 = (true, false, 94) in true)) (60) (12) (false) ((87 + 1)) ((44 + 3)) ((96 <> 0)) (76) ((45 - 8)) (false) ((54 - 3)) ((if false then 37 else 98)) ((59 > 60)) ((if true then 16 else 20)) in
+let c134 = g130 ((82 + 6)) (true) ((18 + 7)) (12) ((true || false)) ((92 + 9)) (44) ((true || true)) ((80 - 2)) ((95 - 8)) ((11 <> 38)) ((if false then 15 else 41)) (74) (false) ((15 + 4)) ((14 + 6)) ((if false then true else false)) ((26 + 0)) (5) ((let l131 = 78 in false)) ((76 + 7)) (62) ((75 >= 13)) ((64 - 5)) ((let l132 = 33 in 47)) ((let l133 = true in l133)) ((62 - 9)) (70) ((if false then true else false)) ((78 - 0)) ((if true then 17 else 2)) ((not true)) ((41 - 5)) in
+let g138 = f0 ((6 - 4)) ((49 + 0)) ((false = false)) ((let l135 = 89 in l135)) ((92 - 0)) ((not true)) ((99 - 7)) ((86 + 5)) ((36 <= 55)) ((87 + 6)) (58) ((false && true)) (12) (44) (false) ((44 - 6)) ((29 - 8)) ((not true)) ((24 + 2)) ((20 + 7)) (false) ((68 - 4)) (2) ((not false)) ((40 + 5)) ((45 - 3)) (false) ((51 - 5)) (50) ((if false then true else false)) ((35 - 7)) (35) ((10 <= 80)) (26) ((64 - 1)) ((55 <> 68)) (63) ((79 - 0)) (true) ((84 + 0)) ((let l136 = (false, 78) in 97)) ((12 <= 20)) (62) ((27 - 6)) ((not false)) ((22 - 6)) ((55 + 1)) ((not true)) ((47 + 4)) ((71 - 8)) ((61 <= 47)) ((let l137 = 87 in l137)) ((47 + 8)) ((true && true)) in
+let c142 = g138 (34) ((45 - 7)) ((43 > 94)) ((93 - 7)) ((84 + 6)) ((72 <> 81)) (15) (11) ((let l139 = (true, 60) in false)) ((95 - 4)) ((71 - 1)) ((false && false)) (4) ((if false then 81 else 77)) ((true && false)) ((23 - 0)) ((if false then 69 else 56)) ((32 > 34)) (28) ((78 + 2)) (true) (12) ((47 - 8)) (false) ((55 - 1)) ((41 + 6)) (false) ((60 + 4)) ((let l140 = (68, 2) in 21)) ((20 <> 56)) (92) ((41 + 5)) (true) ((85 - 9)) (0) ((25 > 36)) ((2 - 1)) ((30 + 7)) ((14 > 62)) (72) ((26 + 5)) (false) ((49 + 5)) ((90 + 4)) ((let l141 = true in true)) ((88 - 2)) in
+let g145 = f0 ((2 + 5)) (31) (((6, 12, 21) <> (58, 80, 62))) ((37 + 3)) ((let l143 = true in 53)) ((not false)) (87) ((77 - 9)) ((10 <= 1)) ((27 + 3)) ((88 - 5)) ((let l144 = 47 in true)) ((20 - 8)) ((68 + 1)) ((74 = 87)) ((34 - 5)) in
+let c155 = g145 (81) ((not false)) ((if true then 46 else 51)) (66) ((18 <= 28)) ((6 + 9)) ((92 + 5)) ((not false)) ((11 + 2)) (5) ((let l146 = 8 in true)) (25) ((9 - 0)) ((true && true)) ((76 + 6)) ((let l147 = 51 in l147)) ((not true)) (76) ((let l148 = true in 15)) (true) ((31 - 0)) ((30 + 5)) (true) ((6 + 0)) ((74 - 3)) ((let l149 = 73 in true)) ((24 - 6)) ((85 + 7)) ((false || false)) ((32 + 0)) ((69 - 6)) ((61 < 61)) ((86 + 9)) ((70 + 7)) (false) ((if true then 62 else 65)) ((let l150 = 76 in l150)) (true) ((95 - 5)) ((let l151 = 1 in l151)) (((false, 10) <> (false, 59))) ((31 + 4)) ((40 + 4)) ((6 = 73)) ((44 - 0)) (72) ((true || false)) ((56 + 5)) ((68 - 6)) (false) ((let l152 = (true, 55, false) in 25)) ((if true then 72 else 76)) (((false, 8, false) = (false, 52, true))) ((7 - 3)) ((40 + 4)) ((16 = 61)) ((26 - 5)) ((93 - 9)) ((75 <= 83)) ((51 + 4)) ((if true then 64 else 17)) ((true && false)) ((10 + 4)) ((66 - 1)) (false) (75) ((84 + 7)) (false) ((79 + 5)) ((1 + 7)) ((if true then true else false)) ((33 - 9)) (29) ((let l153 = 90 in false)) ((64 - 5)) ((10 + 0)) (true) ((9 - 7)) ((9 + 9)) ((38 >= 71)) (47) ((let l154 = (83, 16, true) in 72)) ((true || true)) ((22 - 5)) in
+let g159 = f0 ((29 - 6)) ((48 - 0)) ((let l156 = 80 in false)) ((19 + 7)) ((if true then 94 else 88)) ((not true)) ((66 - 1)) ((let l157 = 79 in l157)) ((false && true)) ((85 - 8)) (36) ((28 = 65)) ((let l158 = 67 in l158)) (79) ((53 >= 45)) in
+let c166 = g159 ((11 - 1)) (81) ((if false then false else true)) (10) ((49 - 3)) ((true = false)) ((89 + 6)) ((59 + 8)) (false) ((65 - 5)) ((50 + 6)) ((true && true)) ((5 + 0)) ((38 - 6)) ((true && true)) ((81 + 2)) ((if false then 28 else 21)) (true) ((if true then 40 else 28)) ((80 + 5)) (false) ((8 - 3)) ((if true then 87 else 98)) ((not true)) ((68 - 2)) ((35 - 8)) (true) ((72 - 0)) ((26 - 6)) (true) (47) ((61 + 5)) (false) ((let l160 = 39 in 30)) (58) ((51 < 0)) (39) (38) (false) ((69 + 4)) ((42 + 8)) ((false && true)) (76) (90) ((false && false)) (79) ((51 + 1)) ((66 <= 88)) ((95 - 4)) ((41 - 0)) ((1 = 28)) ((3 + 7)) ((6 - 7)) ((54 < 62)) (73) ((if true then 75 else 88)) (true) ((7 - 2)) ((let l161 = 6 in l161)) ((let l162 = 47 in false)) ((let l163 = 30 in 2)) ((32 + 3)) ((35 > 62)) ((84 + 7)) ((99 + 1)) (false) (84) (76) ((14 <> 40)) ((98 + 8)) (63) ((let l164 = 21 in false)) ((20 + 3)) ((let l165 = (14, false, 56) in 74)) ((56 = 75)) (22) ((9 + 3)) ((false && true)) ((64 + 2)) (99) ((false || false)) ((42 + 0)) ((if false then 1 else 80)) ((if false then false else true)) ((91 + 6)) in
+let g173 = f0 ((if true then 60 else 21)) ((24 + 7)) ((not true)) (48) ((let l167 = 87 in 16)) ((false && false)) ((60 - 2)) ((96 + 0)) ((true <> true)) ((if false then 53 else 67)) (63) ((63 = 10)) ((23 - 8)) ((let l168 = (70, false, false) in 66)) ((not true)) ((let l169 = 62 in l169)) ((if false then 35 else 86)) ((false || true)) ((21 - 0)) ((61 + 1)) ((false && true)) ((77 - 5)) ((23 + 3)) (false) ((56 + 9)) ((5 + 9)) ((false && true)) ((74 - 1)) ((66 - 4)) ((95 < 38)) (52) ((1 - 2)) ((94 <> 0)) (48) ((29 + 6)) (true) ((36 + 7)) (38) (true) ((8 - 5)) ((let l170 = 83 in 73)) ((let l171 = 20 in true)) ((83 - 5)) ((47 + 0)) ((false || false)) ((51 - 1)) ((52 + 1)) ((74 >= 14)) ((92 + 6)) (7) ((43 < 34)) ((73 + 3)) (8) ((47 = 17)) ((87 + 8)) ((69 + 5)) ((57 <> 92)) (23) ((97 + 2)) (false) ((20 + 6)) ((29 + 1)) ((if false then true else false)) (87) ((48 - 5)) (true) ((16 + 3)) ((14 - 6)) (false) ((12 - 7)) ((73 + 6)) ((if false then true else false)) ((6 + 8)) ((22 + 1)) ((99 >= 48)) ((41 - 0)) (82) ((true <> true)) ((if false then 13 else 34)) ((if true then 47 else 60)) (false) ((61 - 6)) ((35 - 1)) (false) ((40 + 9)) (78) ((64 <= 7)) ((60 + 8)) (74) ((11 = 78)) ((let l172 = 2 in l172)) ((87 - 6)) ((false || false)) (3) in
+let c175 = g173 ((let l174 = 4 in l174)) ((not true)) ((44 + 6)) ((31 - 1)) ((85 > 35)) ((54 + 0)) in
+let g178 = f0 ((90 + 5)) (9) ((if true then true else false)) ((94 - 5)) ((6 + 0)) (true) ((18 - 9)) ((45 + 6)) ((33 >= 40)) (70) ((59 - 2)) ((true || true)) (81) ((73 - 4)) ((let l176 = (54, true) in false)) (41) ((39 - 6)) ((false <> false)) ((let l177 = 23 in 73)) ((70 - 8)) ((true && true)) ((73 - 1)) ((24 + 6)) ((false || true)) ((if true then 79 else 43)) ((91 + 6)) ((not true)) ((48 + 0)) ((2 + 4)) ((4 <> 76)) (91) (38) (true) ((77 - 8)) in
+let c185 = g178 ((24 - 0)) (false) (46) (94) ((50 = 5)) ((47 - 8)) ((35 - 7)) ((true = true)) ((80 + 4)) ((62 + 6)) ((if false then true else false)) (54) ((if true then 77 else 8)) ((let l179 = false in l179)) ((32 - 2)) ((let l180 = 23 in l180)) ((42 <> 59)) ((47 - 5)) ((84 - 2)) (false) ((9 - 5)) ((let l181 = 53 in l181)) ((let l182 = 22 in false)) ((41 + 3)) ((let l183 = 81 in l183)) ((false || false)) ((30 - 4)) (75) ((89 >= 59)) ((81 - 3)) (93) ((true && true)) ((let l184 = 3 in l184)) ((52 - 0)) (false) ((96 - 8)) ((63 - 6)) (false) ((58 - 4)) ((59 - 3)) (true) (31) ((7 + 9)) ((72 = 38)) ((84 + 1)) ((50 - 0)) ((false = false)) ((85 - 7)) (70) (false) ((28 + 0)) ((7 + 1)) ((false || true)) ((23 + 3)) ((15 - 8)) ((22 >= 52)) (47) ((if true then 20 else 72)) (((17, false, false) <> (43, false, true))) ((86 - 2)) (55) ((true || true)) ((28 - 4)) ((29 + 6)) ((50 = 88)) ((54 + 6)) in
+let g187 = f0 ((58 + 9)) ((6 + 1)) ((let l186 = 38 in true)) ((if true then 64 else 26)) (91) ((11 <= 50)) in
+let c193 = g187 (7) ((let l188 = 59 in l188)) ((44 <> 19)) (36) ((47 + 0)) ((false <> true)) ((if false then 27 else 57)) ((23 + 9)) ((48 >= 60)) (0) (75) (true) (18) ((94 - 5)) ((68 >= 35)) (51) (38) ((let l189 = false in l189)) (45) ((44 + 4)) ((true || false)) ((90 - 0)) ((92 - 5)) ((true || true)) ((65 + 6)) ((16 + 9)) ((true <> true)) ((27 - 3)) ((let l190 = (33, 55, false) in 71)) ((81 >= 34)) ((90 + 5)) ((75 - 5)) (true) (26) ((94 - 6)) (false) (55) ((75 - 1)) ((96 < 56)) ((21 - 7)) ((35 + 2)) (false) ((26 + 2)) (29) ((false || false)) ((65 - 6)) ((70 + 2)) ((0 <= 50)) ((let l191 = 86 in l191)) (22) ((64 <> 90)) ((47 - 5)) (20) (false) ((72 - 9)) ((43 + 9)) ((not false)) ((49 - 2)) ((46 + 1)) ((false = true)) ((17 + 8)) ((27 - 1)) ((46 > 26)) ((20 + 8)) ((46 - 5)) ((37 <= 95)) ((65 + 9)) ((16 - 2)) ((if true then true else false)) ((92 - 8)) ((95 - 6)) ((true = true)) (13) ((12 + 6)) (true) ((26 + 5)) ((10 + 0)) ((50 >= 87)) ((69 - 8)) ((11 + 4)) ((false = false)) (39) (59) ((let l192 = 80 in false)) ((if false then 15 else 71)) ((33 + 7)) ((39 > 92)) ((98 - 4)) ((10 - 0)) (false) ((if true then 20 else 7)) (25) (true) (21) in
+let g198 = f0 ((50 - 8)) ((49 - 2)) (true) ((98 - 5)) ((20 + 9)) ((64 <= 2)) ((44 + 1)) ((let l194 = 68 in l194)) (false) ((let l195 = 25 in 84)) ((51 + 3)) ((true && false)) ((54 + 8)) ((59 + 5)) ((94 >= 27)) (22) ((73 + 1)) ((not true)) ((54 - 2)) ((let l196 = true in 79)) ((if false then true else false)) (86) ((75 - 0)) ((69 > 0)) (39) ((80 + 4)) ((false && false)) ((20 + 0)) ((85 + 6)) ((true && true)) (57) (81) ((22 >= 54)) ((let l197 = (false, false, 53) in 22)) ((92 - 1)) in
+let c201 = g198 ((63 <> 23)) ((16 + 0)) (29) ((let l199 = 31 in true)) ((16 - 0)) (81) (true) (20) ((95 - 0)) ((72 >= 0)) (90) ((31 + 5)) ((if false then false else true)) ((34 + 2)) ((85 + 1)) ((53 = 41)) ((68 + 7)) ((7 - 1)) ((false || true)) ((14 + 0)) ((75 - 7)) ((not true)) ((34 - 5)) ((85 + 7)) (true) ((35 + 4)) (77) ((true || true)) ((10 + 6)) (78) ((if false then true else false)) (69) ((55 - 2)) ((false && true)) ((54 + 6)) ((75 - 2)) ((89 > 20)) ((75 - 4)) ((37 + 0)) ((true && false)) ((35 + 3)) ((73 + 4)) ((if false then true else false)) ((28 + 6)) (88) ((true <> true)) ((85 - 0)) (28) ((not false)) ((52 + 3)) ((18 + 1)) (false) ((25 + 8)) ((6 + 7)) ((if false then false else true)) ((24 + 5)) ((60 - 9)) ((true || false)) ((98 - 9)) ((let l200 = 15 in l200)) (true) ((64 - 3)) ((if true then 96 else 27)) ((false = true)) ((65 + 0)) in
+let g206 = f0 ((88 - 6)) ((15 + 2)) ((true && false)) ((81 + 0)) ((42 - 2)) ((false || true)) ((26 - 8)) ((3 - 9)) ((84 < 14)) ((71 - 1)) ((4 - 0)) ((false || true)) ((91 - 6)) ((34 - 9)) ((52 > 75)) ((9 - 8)) ((36 - 1)) ((let l202 = 11 in false)) (38) ((40 + 7)) ((let l203 = true in true)) ((62 + 7)) (56) ((false = false)) ((44 - 4)) (91) ((if true then true else true)) ((76 + 0)) ((2 - 8)) ((false || false)) ((12 + 4)) ((if false then 75 else 49)) ((true <> false)) ((21 + 1)) (91) ((79 < 63)) ((20 + 1)) ((45 + 8)) ((if true then true else false)) ((82 + 0)) ((74 + 3)) ((6 > 83)) ((61 - 9)) (6) ((if true then true else true)) ((70 - 9)) (85) (((88, false) <> (46, true))) ((56 - 8)) ((73 - 5)) ((false && false)) ((69 + 2)) ((88 - 9)) ((if true then false else true)) (30) ((90 - 5)) ((if true then false else false)) ((let l204 = (false, false) in 43)) ((13 - 7)) ((78 = 89)) ((72 + 2)) ((81 + 2)) (true) ((22 - 4)) ((12 - 1)) ((true || false)) ((if true then 2 else 1)) ((18 + 5)) ((let l205 = 64 in false)) (3) ((69 + 6)) ((36 <= 76)) ((30 + 0)) (6) ((66 >= 46)) ((44 + 8)) ((8 + 6)) ((if false then true else false)) ((59 - 2)) ((96 + 2)) ((true || false)) (52) ((89 - 9)) ((false && false)) ((57 - 9)) ((90 + 1)) ((62 > 3)) ((20 - 8)) in
+let c207 = g206 (50) ((if true then true else true)) ((39 + 2)) ((36 - 7)) ((true || true)) ((62 + 5)) ((42 - 4)) ((17 >= 24)) ((71 + 7)) ((39 - 7)) (true) ((91 - 1)) in
+let g210 = f0 (79) ((let l208 = 63 in l208)) ((54 < 52)) (4) ((35 - 4)) ((11 <> 40)) ((if true then 56 else 38)) ((88 + 2)) ((not true)) (92) (12) ((if true then false else false)) (57) ((13 + 0)) ((false || true)) (0) ((22 - 2)) ((false || false)) (91) ((27 - 8)) (false) (56) ((if false then 11 else 13)) (true) (42) ((80 - 0)) ((94 = 92)) (51) (36) (true) ((5 + 4)) ((14 - 8)) (true) (57) ((51 - 9)) (((true, false) <> (false, true))) ((56 - 9)) ((44 + 4)) (false) (24) ((73 + 8)) (false) ((56 + 7)) ((5 - 2)) ((true && true)) ((81 - 5)) (45) (true) ((13 + 0)) ((13 + 5)) ((87 <> 85)) ((22 - 5)) (67) ((75 >= 92)) ((79 - 2)) ((47 - 6)) ((not false)) (63) ((69 - 1)) ((not false)) ((37 + 5)) (34) ((51 < 9)) ((87 + 6)) ((39 + 4)) (true) ((72 + 8)) (95) (true) ((60 - 7)) ((64 - 9)) (false) ((if false then 28 else 21)) (8) (false) ((68 + 6)) ((if true then 11 else 50)) ((18 > 42)) ((74 - 8)) ((50 - 7)) ((let l209 = true in l209)) ((35 - 3)) in
+let c215 = g210 ((83 - 8)) (false) ((99 + 9)) ((let l211 = 24 in l211)) ((44 >= 41)) (2) ((90 - 0)) ((61 > 85)) ((97 - 6)) (66) (false) ((85 - 9)) ((12 + 9)) ((let l212 = true in l212)) ((let l213 = 89 in l213)) ((let l214 = 1 in l214)) ((34 <> 36)) ((68 + 8)) in
+let g216 = f0 (81) ((41 + 0)) ((if true then false else false)) (28) ((77 - 7)) ((34 = 79)) ((11 + 2)) ((79 - 9)) ((67 > 51)) (85) (57) ((true && false)) ((37 + 0)) ((33 + 4)) ((not false)) ((21 + 9)) ((15 - 6)) ((17 >= 58)) in
+let c222 = g216 (75) ((2 + 6)) (true) ((84 + 9)) (49) ((false && true)) (61) ((33 - 5)) (false) (95) ((16 + 9)) ((87 >= 17)) (64) ((41 - 0)) (false) (67) ((14 + 5)) ((false && false)) (56) ((88 + 0)) ((13 < 59)) ((let l217 = 62 in l217)) ((7 + 1)) (true) ((80 - 6)) (71) ((57 >= 44)) ((if true then 4 else 26)) (16) (false) ((75 + 2)) ((49 - 6)) ((not false)) ((let l218 = 63 in l218)) ((27 + 9)) ((not false)) ((85 - 0)) ((6 + 5)) (true) ((52 - 8)) ((if false then 49 else 87)) ((0 = 66)) ((45 + 1)) ((38 + 0)) ((52 = 19)) (83) ((40 + 0)) ((false && true)) (49) ((76 + 5)) (false) ((43 - 0)) (75) (false) ((17 + 6)) (77) ((let l219 = true in l219)) ((let l220 = false in 28)) (76) ((77 <= 50)) ((72 - 9)) ((33 + 0)) ((53 <= 82)) (24) ((let l221 = 25 in l221)) ((not true)) ((84 + 5)) ((24 + 5)) ((not false)) ((24 - 2)) ((24 + 4)) ((not true)) ((74 + 7)) ((79 - 3)) ((25 > 1)) ((63 - 9)) (28) ((85 > 29)) ((if false then 31 else 86)) ((21 - 7)) ((83 >= 57)) ((if false then 50 else 97)) in
+(((7 - 7) - 7) - 3)
@@ -0,0 +1,1001 @@
+let v0 = ((28 - 8) < (7 - 3)) in
+let v1 = 0 in
+let v2 = ((if v0 then v0 else v0), v1, (28 + 7)) in
+let v3 = ((v1 + 7), (v1 - 1)) in
+let v4 = 13 in
+let v5 = ((v4 <= v4), (let l6 = v1 in v0), (not false)) in
+let v7 = (let l8 = 98 in (1 + 2)) in
+let v9 = 78 in
+let v10 = (let l11 = (v9 + 9) in 43) in
+let v12 = 72 in
+let v13 = (let l14 = (51 + 5) in (v9, v0)) in
+let v15 = ((v9 + 2) + 2) in
+let v16 = ((if v0 then v1 else v10), (if v0 then true else v0)) in
+let v17 = (true, true) in
+let v18 = (v10, (v12 <> v12), (v0 && v0)) in
+let v19 = ((let l20 = v2 in v9) + 6) in
+let v21 = (((63, 1) <> (61, 45)), (not v0), v10) in
+let v22 = ((if v0 then 4 else v12) - 9) in
+let v23 = ((let l24 = v22 in false), (v10 - 5)) in
+let v25 = ((v22 + 2) + 7) in
+let v26 = ((v12 + 8) > (22 - 2)) in
+let v27 = (v4, (v0 && v0), (51 + 2)) in
+let v28 = 59 in
+let v29 = (not (let l30 = v9 in v26)) in
+let v31 = ((v12 - 5) + 1) in
+let v32 = ((35 - 1) >= 35) in
+let v33 = ((v25 - 2) + 6) in
+let v34 = (let l35 = (v22 + 8) in (v28 + 1)) in
+let v36 = (70, (if true then v0 else true)) in
+let v37 = (v25 - 7) in
+let v38 = ((v25 - 8) + 1) in
+let v39 = v17 in
+let v40 = ((v29 && v0) && (not v0)) in
+let v41 = (if v40 then v28 else (v1 + 9)) in
+let v42 = (if (false || v26) then (if true then v15 else 61) else (0 + 5)) in
+let v43 = ((v25 - 1) + 0) in
+let v44 = ((v7 - 2) - 1) in
+let v45 = (v22 + 7) in
+let v46 = (91 - 1) in
+let v47 = (v1 + 2) in
+let v48 = (if (not v0) then v44 else (v45 - 8)) in
+let v49 = ((64 - 1) + 7) in
+let v50 = (if v26 then (60 + 4) else (let l51 = v23 in 12)) in
+let v52 = ((v25 - 6) + 9) in
+let v53 = (if v29 then (v38 + 3) else (v46 - 8)) in
+let v54 = ((v38 + 0) + 1) in
+let v55 = (v45 - 2) in
+let v56 = (v44 - 4) in
+let v57 = (not false) in
+let v58 = ((if v40 then v4 else v37) + 0) in
+let v59 = (if v32 then 42 else 87) in
+let v60 = v47 in
+let v61 = ((v26 || false), (v58 = v37), v0) in
+let v62 = 49 in
+let v63 = v57 in
+let v64 = v58 in
+let v65 = ((if v0 then 73 else v44) + 0) in
+let v66 = (v50 - 6) in
+let v67 = v29 in
+let v68 = (v49 - 5) in
+let v69 = ((if v63 then v25 else v42) - 1) in
+let v70 = ((4 - 7) >= v69) in
+let v71 = 86 in
+let v72 = ((false || false) && (if v67 then v0 else v29)) in
+let v73 = (v1 > 80) in
+let v74 = (if (v62 <> 87) then v52 else v46) in
+let v75 = 10 in
+let v76 = ((if v57 then v69 else v59) + 3) in
+let v77 = (v65 <= (v58 - 3)) in
+let v78 = ((96 - 5), v22, (v34 - 3)) in
+let v79 = (not v40) in
+let v80 = (v79 || (not true)) in
+let v81 = (v53 + 8) in
+let v82 = ((52 - 5) + 8) in
+let v83 = v69 in
+let v84 = ((let l85 = v79 in v7), (88 + 6), (v68 - 6)) in
+let v86 = (40, false, false) in
+let v87 = v26 in
+let v88 = (51 - 3) in
+let v89 = ((if v32 then v43 else v66) + 7) in
+let v90 = (v87 || (v0 <> v87)) in
+let v91 = v60 in
+let v92 = ((6 + 6) - 7) in
+let v93 = (if (97 <= 99) then (not false) else (57 >= 61)) in
+let v94 = ((v7 + 9) + 3) in
+let v95 = ((v59 + 1) - 2) in
+let v96 = (13, 26) in
+let v97 = (60, (43 - 2), v26) in
+let v98 = ((if true then false else v73), (v63 || v29)) in
+let v99 = (let l100 = v79 in (true || v57)) in
+let v101 = (v76, (v44 - 8), (false || v77)) in
+let v102 = (true, 41) in
+let v103 = ((v95 + 8) - 7) in
+let v104 = ((v50 - 8) + 5) in
+let v105 = v62 in
+let v106 = ((v59 - 5) - 6) in
+let v107 = (v99, (v54 = v71)) in
+let v108 = ((v1 + 5) + 3) in
+let v109 = ((let l110 = v59 in false), (v97 = v101)) in
+let v111 = v52 in
+let v112 = ((true || v79) <> (v38 > v69)) in
+let v113 = (98 - 7) in
+let v114 = ((59 - 8) <> (v60 + 7)) in
+let v115 = (v53 - 6) in
+let v116 = ((not v40), (60 <= v9), (92 > 51)) in
+let v117 = ((not v114) && (if v73 then v40 else false)) in
+let v118 = ((let l119 = true in v46) < v4) in
+let v120 = (v71 + 5) in
+let v121 = v66 in
+let v122 = ((34 - 3), 5, (not v117)) in
+let v123 = ((65 - 5) - 7) in
+let v124 = (not v73) in
+let v125 = v13 in
+let v126 = (v76 + 6) in
+let v127 = ((v28 + 7) - 1) in
+let v128 = ((v92 + 8) + 7) in
+let v129 = ((v68 - 7) + 7) in
+let v130 = v12 in
+let v131 = (if true then (let l132 = v31 in v21) else (v57, false, v42)) in
+let v133 = v28 in
+let v134 = (if (true && v32) then (v65, 95, 19) else (if false then v78 else v84)) in
+let v135 = ((32 - 5) + 5) in
+let v136 = (36 > (v127 + 4)) in
+let v137 = ((93 + 8) + 9) in
+let v138 = 33 in
+let v139 = v7 in
+let v140 = ((52 + 4) + 6) in
+let v141 = ((v72 <> true), (v18 <> v86), true) in
+let v142 = ((v22 - 3) - 9) in
+let v143 = ((v9 - 9) + 9) in
+let v144 = ((v106, v113, v0) = (v88, v38, v117)) in
+let v145 = v117 in
+let v146 = (if (v86 <> v86) then (not v29) else (v60 <= v52)) in
+let v147 = v122 in
+let v148 = ((v121 - 4) + 4) in
+let v149 = ((v54 - 0) - 9) in
+let v150 = ((let l151 = v124 in v77), (20 + 2)) in
+let v152 = v121 in
+let v153 = v27 in
+let v154 = (v46 + 2) in
+let v155 = (let l156 = (v149 - 0) in (false <> v32)) in
+let v157 = ((let l158 = v18 in v105) - 7) in
+let v159 = 5 in
+let v160 = ((let l161 = (true, true, 83) in v42) + 3) in
+let v162 = ((if v90 then v135 else 39) < (v49 - 4)) in
+let v163 = ((if false then v10 else v157) + 1) in
+let v164 = ((17 + 8) + 4) in
+let v165 = ((v126 - 7) = (let l166 = v93 in 43)) in
+let v167 = v136 in
+let v168 = ((76 - 6) + 9) in
+let v169 = (if v73 then (v82, v118) else (v58, v136)) in
+let v170 = ((v46 + 2) + 2) in
+let v171 = ((40 + 5) + 2) in
+let v172 = v55 in
+let v173 = (v7 - 0) in
+let v174 = ((v19 < 23), (true && v99), (if v26 then v113 else v170)) in
+let v175 = (v142, (v152 > 36), (v73 = v112)) in
+let v176 = false in
+let v177 = ((81 <> 0) = (v141 <> v141)) in
+let v178 = (if (v66 <> v48) then (let l179 = v165 in v10) else 81) in
+let v180 = (let l181 = v169 in v42) in
+let v182 = ((v143 + 2) <= (97 - 3)) in
+let v183 = ((v71 - 6) - 4) in
+let v184 = v65 in
+let v185 = ((v115 + 1) = (if v145 then v33 else 2)) in
+let v186 = (not (not v80)) in
+let v187 = v60 in
+let v188 = false in
+let v189 = false in
+let v190 = 0 in
+let v191 = 89 in
+let v192 = false in
+let v193 = v126 in
+let v194 = (true && (true && false)) in
+let v195 = ((66 - 9) + 8) in
+let v196 = v17 in
+let v197 = ((v28 - 2) - 0) in
+let v198 = (not (75 >= v148)) in
+let v199 = (not (v105 <= v33)) in
+let v200 = v48 in
+let v201 = (if (v27 <> v27) then (89, v26) else (v83, v188)) in
+let v202 = ((v154 - 0) = (v59 + 0)) in
+let v203 = (v138, (v105 + 1)) in
+let v204 = ((v94 + 5) - 8) in
+let v205 = (let l206 = (v66 + 2) in (v111 - 9)) in
+let v207 = ((v157 - 5) - 2) in
+let v208 = ((v164 + 8) + 3) in
+let v209 = ((if false then 26 else v43) - 1) in
+let v210 = (if (v50 <= v127) then (65 + 9) else v76) in
+let v211 = v123 in
+let v212 = ((if v73 then v91 else v208) + 4) in
+let v213 = ((let l214 = v74 in 47) = v148) in
+let v215 = ((v10 + 7) - 7) in
+let v216 = (let l217 = (v32, 32, v42) in (v170 + 7)) in
+let v218 = ((45 - 4) - 5) in
+let v219 = (36 + 0) in
+let v220 = v87 in
+let v221 = ((54 = 31), (let l222 = 78 in v209)) in
+let v223 = ((if v192 then false else v189), (v182 || v167), (if v199 then v79 else v182)) in
+let v224 = v160 in
+let v225 = v74 in
+let v226 = ((v199 || v186), (not v189), (v54 - 4)) in
+let v227 = ((v55 - 0) - 0) in
+let v228 = ((v71 < v76), (if true then true else v93)) in
+let v229 = ((v15 - 3), (v26 && v177), v65) in
+let v230 = v203 in
+let v231 = ((v25 - 4) - 7) in
+let v232 = (if (let l233 = (60, 50, true) in false) then (if v79 then v40 else v72) else (v67 && false)) in
+let v234 = ((v144 = v63) || (not true)) in
+let v235 = (let l236 = (v167, v231) in v77) in
+let v237 = v218 in
+let v238 = ((v144 || v177), (v198 <> v144)) in
+let v239 = ((not v63), false) in
+let v240 = (v41 + 8) in
+let v241 = ((v139 + 1), (v23 <> (true, 0))) in
+let v242 = ((v71 + 1) - 0) in
+let v243 = ((if v162 then false else v176) = (not false)) in
+let v244 = ((v142 + 5) + 6) in
+let v245 = ((v143 + 3) + 0) in
+let v246 = v105 in
+let v247 = ((51 - 9) + 7) in
+let v248 = v175 in
+let v249 = ((v41 - 6) - 1) in
+let v250 = v127 in
+let v251 = ((v56 + 7) - 8) in
+let v252 = ((v133 + 9) + 3) in
+let v253 = ((v205 + 0) - 1) in
+let v254 = ((44 + 7) + 1) in
+let v255 = v91 in
+let v256 = (not v90) in
+let v257 = ((v128 + 4) - 7) in
+let v258 = v45 in
+let v259 = ((if v155 then 91 else 70), (v178 + 6)) in
+let v260 = (let l261 = (v118 = v118) in (v5 = v5)) in
+let v262 = (v200 + 9) in
+let v263 = ((let l264 = v52 in v127), (99 + 5), (let l265 = v72 in v120)) in
+let v266 = (let l267 = (26 + 0) in (v160 - 6)) in
+let v268 = ((77 - 2) + 7) in
+let v269 = (v257 + 4) in
+let v270 = (if (v269 >= 94) then v138 else (v200 - 9)) in
+let v271 = false in
+let v272 = ((46 < v50), (let l273 = v57 in true)) in
+let v274 = 7 in
+let v275 = ((v204 + 4), (v10 + 1), (v42 - 5)) in
+let v276 = (v58 - 7) in
+let v277 = ((v168 >= 68) || true) in
+let v278 = ((33 - 1) + 3) in
+let v279 = (let l280 = (v12 + 8) in (v75 - 4)) in
+let v281 = 98 in
+let v282 = (if (not v186) then (v142 - 0) else v143) in
+let v283 = ((let l284 = v89 in v106) - 2) in
+let v285 = ((v282 + 1), (9 + 3), (v26 && v90)) in
+let v286 = ((v180 >= v68), (let l287 = v203 in v213)) in
+let v288 = (v279, (25 - 8)) in
+let v289 = ((v128 + 6) - 5) in
+let v290 = (v234, (v126 + 1), (v44 + 3)) in
+let v291 = ((false = v220), (v237 >= v231)) in
+let v292 = ((96 - 1) <> (v180 + 6)) in
+let v293 = v199 in
+let v294 = ((49 + 5) - 5) in
+let v295 = ((if v182 then v149 else v81) + 3) in
+let v296 = (let l297 = v244 in (v82 - 4)) in
+let v298 = (let l299 = (v137 - 6) in v182) in
+let v300 = ((1 - 5) >= (v270 - 2)) in
+let v301 = (let l302 = (56 - 3) in (v9 - 2)) in
+let v303 = ((v296 - 6) + 3) in
+let v304 = ((5 = 54) && (if v70 then v146 else true)) in
+let v305 = (let l306 = (v120 - 4) in (let l307 = v45 in v249)) in
+let v308 = 42 in
+let v309 = ((v143 - 2) + 3) in
+let v310 = v204 in
+let v311 = 33 in
+let v312 = (58, false) in
+let v313 = ((if v194 then v73 else v232) || (let l314 = false in true)) in
+let v315 = (let l316 = 48 in v298) in
+let v317 = v54 in
+let v318 = ((v105 - 6) >= (v129 - 0)) in
+let v319 = (7 + 2) in
+let v320 = (v309 + 1) in
+let v321 = ((let l322 = v247 in v32) = (if v70 then true else v199)) in
+let v323 = 73 in
+let v324 = (not (11 <= v269)) in
+let v325 = ((v7 + 9) + 0) in
+let v326 = (7, false, 5) in
+let v327 = false in
+let v328 = ((let l329 = v245 in v210) - 1) in
+let v330 = ((v10 - 3) > (v301 - 7)) in
+let v331 = ((if v70 then v136 else v293) && v136) in
+let v332 = 42 in
+let v333 = ((v197 + 4) - 0) in
+let v334 = ((49, v149, true) <> v285) in
+let v335 = (if false then (77 - 8) else (let l336 = v9 in v137)) in
+let v337 = ((v294 - 7) - 3) in
+let v338 = ((3 + 7) + 7) in
+let v339 = (let l340 = v95 in (v328 - 1)) in
+let v341 = ((if true then v79 else v213) && (if false then v256 else v324)) in
+let v342 = v170 in
+let v343 = ((51 - 8) + 0) in
+let v344 = ((60 - 8) - 7) in
+let v345 = ((if v67 then v115 else v296) < v34) in
+let v346 = (if (v145 || v32) then v66 else (34 - 7)) in
+let v347 = v55 in
+let v348 = ((v246 - 0) - 7) in
+let v349 = true in
+let v350 = ((v184 - 0) + 3) in
+let v351 = v227 in
+let v352 = (59 - 6) in
+let v353 = (let l354 = (v199, v93) in (83 - 2)) in
+let v355 = (if (v131 = v174) then (51 <= v311) else (false && false)) in
+let v356 = (if (v295 = v71) then false else (if v29 then v72 else v57)) in
+let v357 = (let l358 = (v331, true) in (27, 2, 1)) in
+let v359 = v40 in
+let v360 = ((if v256 then 3 else v126) + 4) in
+let v361 = (let l362 = (false && v192) in v308) in
+let v363 = v89 in
+let v364 = ((v54 - 6) + 7) in
+let v365 = (((91, true, 8) <> v326) && (if true then true else v234)) in
+let v366 = (not true) in
+let v367 = ((if v77 then v215 else v339) - 9) in
+let v368 = (87 + 1) in
+let v369 = (if v341 then (v205 + 1) else 86) in
+let v370 = 55 in
+let v371 = (if (false && v63) then (false || v114) else (true && v366)) in
+let v372 = false in
+let v373 = (if (v339 >= 76) then (v220 <> v145) else (false || false)) in
+let v374 = (not (v192 || false)) in
+let v375 = ((not true), (v91 - 9), (v343 + 1)) in
+let v376 = ((v219 + 0) + 7) in
+let v377 = ((if v146 then v49 else v216) + 7) in
+let v378 = (let l379 = (v12 + 3) in v353) in
+let v380 = ((57 + 0) - 1) in
+let v381 = ((v360 + 8) + 1) in
+let v382 = ((let l383 = v42 in 72) - 9) in
+let v384 = ((v283 - 5) > (v52 + 5)) in
+let v385 = ((75 >= 43) || v144) in
+let v386 = v3 in
+let v387 = ((96 - 5) - 9) in
+let v388 = ((v289 + 3) - 3) in
+let v389 = ((68 + 5) >= (v152 + 8)) in
+let v390 = v171 in
+let v391 = ((v281 - 4), (if v365 then false else v63)) in
+let v392 = ((let l393 = v345 in v135) - 1) in
+let v394 = (v208 < (v91 - 0)) in
+let v395 = ((not v198) = (v10 <> v183)) in
+let v396 = ((60 - 2) + 7) in
+let v397 = ((v184 - 8) + 6) in
+let v398 = v283 in
+let v399 = (let l400 = (v311 = v42) in (v76 - 7)) in
+let v401 = (v332 - 4) in
+let v402 = ((if v198 then v397 else v270) = (v180 - 9)) in
+let v403 = ((v121 + 0) >= v310) in
+let v404 = (let l405 = (v279 - 2) in (v146, v245)) in
+let v406 = (if (v117 && v304) then 4 else (v253 - 7)) in
+let v407 = ((v303 + 5) - 2) in
+let v408 = ((if v315 then 96 else 58) >= 45) in
+let v409 = (v115 + 3) in
+let v410 = ((v392, true, v232) = (let l411 = v81 in v175)) in
+let v412 = true in
+let v413 = (v42 - 2) in
+let v414 = v240 in
+let v415 = ((v369 + 7) - 2) in
+let v416 = v42 in
+let v417 = (not (not v99)) in
+let v418 = ((v142 + 4) >= (v64 + 1)) in
+let v419 = ((let l420 = 67 in true), (v295 - 6)) in
+let v421 = ((let l422 = 3 in v305) - 8) in
+let v423 = v295 in
+let v424 = ((v74 - 7) - 7) in
+let v425 = ((v295 - 8) - 3) in
+let v426 = ((v152 - 3) - 6) in
+let v427 = v3 in
+let v428 = (if (57 < 62) then (v227 + 8) else v41) in
+let v429 = ((v276 + 2) + 6) in
+let v430 = (let l431 = (v399 + 9) in 75) in
+let v432 = ((let l433 = v138 in v47) - 1) in
+let v434 = false in
+let v435 = (10 >= (65 - 9)) in
+let v436 = ((v406 - 8) + 1) in
+let v437 = (v415 - 6) in
+let v438 = (14 - 8) in
+let v439 = (if (v187 = v339) then (25 - 1) else (v251 + 3)) in
+let v440 = v73 in
+let v441 = (if false then (let l442 = false in v126) else (v211 + 2)) in
+let v443 = (let l444 = v187 in (true, 16)) in
+let v445 = false in
+let v446 = v188 in
+let v447 = v66 in
+let v448 = ((v388 >= 97), (v305 - 2), (34 - 2)) in
+let v449 = v413 in
+let v450 = ((let l451 = v45 in v257) - 0) in
+let v452 = ((v66 - 2) + 8) in
+let v453 = v410 in
+let v454 = (98 + 0) in
+let v455 = (if (v270 <> v255) then (if v198 then (true, false, false) else v116) else (v356, v80, v293)) in
+let v456 = (let l457 = (v157 + 1) in (v415 + 0)) in
+let v458 = v381 in
+let v459 = ((29 - 9) + 8) in
+let v460 = (if false then v240 else v207) in
+let v461 = ((v429 - 3) - 9) in
+let v462 = ((v50 + 6) + 8) in
+let v463 = ((not false), 9, (3 + 3)) in
+let v464 = 14 in
+let v465 = (v231 >= (4 + 6)) in
+let v466 = (if v80 then v360 else (v407 - 3)) in
+let v467 = (let l468 = v456 in (77 + 4)) in
+let v469 = ((v148, v185, v330) <> (v81, v0, v453)) in
+let v470 = ((79 - 9) + 1) in
+let v471 = ((14 + 5) + 1) in
+let v472 = ((v69 + 8) + 7) in
+let v473 = ((v369 - 4) + 5) in
+let v474 = (not (not v341)) in
+let v475 = 39 in
+let v476 = (let l477 = v54 in v269) in
+let v478 = (if (if v165 then false else false) then (39 = v164) else (not v93)) in
+let v479 = (if (61 <= v54) then (v437 - 7) else (v289 + 7)) in
+let v480 = ((92 - 0) - 4) in
+let v481 = (if v32 then (if v145 then true else v80) else v403) in
+let v482 = ((v352 + 4) + 8) in
+let v483 = (let l484 = (v22 <> v301) in (true, 70, 9)) in
+let v485 = (not (if v277 then false else v371)) in
+let v486 = (if (v430 <> v38) then (60 + 3) else (75 + 6)) in
+let v487 = v42 in
+let v488 = (not (if v198 then v202 else v136)) in
+let v489 = ((v126 - 6), (95 = 5)) in
+let v490 = (v249 + 5) in
+let v491 = ((63 - 8), 28) in
+let v492 = v142 in
+let v493 = ((v209 + 1) - 2) in
+let v494 = 40 in
+let v495 = ((v37 - 8) <> (v464 - 7)) in
+let v496 = ((v183 + 5) - 1) in
+let v497 = ((v43 + 0) - 2) in
+let v498 = v445 in
+let v499 = ((v480 + 3) + 5) in
+let v500 = ((v367 - 7) >= (v370 + 2)) in
+let v501 = ((v139 + 7) = (81 + 0)) in
+let v502 = (if (not v327) then (v243 || v374) else (v63 && false)) in
+let v503 = ((47 + 9) + 5) in
+let v504 = v410 in
+let v505 = v191 in
+let v506 = v266 in
+let v507 = ((v423 - 8) - 6) in
+let v508 = v155 in
+let v509 = (let l510 = (if v384 then 45 else v338) in (v48, true)) in
+let v511 = ((38 - 4) + 8) in
+let v512 = ((v333 + 9) - 0) in
+let v513 = (let l514 = v312 in (34 >= v115)) in
+let v515 = ((65 >= v458) || (v43 < 45)) in
+let v516 = ((v315 && v474), (v310 + 2), (v439 + 4)) in
+let v517 = ((71 + 4) - 7) in
+let v518 = ((let l519 = v131 in v381) + 9) in
+let v520 = ((70 + 2) - 9) in
+let v521 = v378 in
+let v522 = v97 in
+let v523 = ((6 >= v496) && (16 >= v211)) in
+let v524 = ((if v318 then 35 else v254) + 8) in
+let v525 = (if v403 then (if v93 then false else true) else (let l526 = v461 in v90)) in
+let v527 = ((v69 - 9) + 9) in
+let v528 = ((if v403 then 60 else v50) + 0) in
+let v529 = (if (false <> v395) then 51 else (v25 - 4)) in
+let v530 = (v135 - 3) in
+let v531 = (v527 - 8) in
+let v532 = (v368 - 8) in
+let v533 = v173 in
+let v534 = (58 + 0) in
+let v535 = v162 in
+let v536 = ((let l537 = v50 in v452) + 4) in
+let v538 = ((v308 <> v397) && (v390 <= v52)) in
+let v539 = (65 >= (58 - 0)) in
+let v540 = ((v462 - 0) + 7) in
+let v541 = (let l542 = v366 in (12 <> v41)) in
+let v543 = v496 in
+let v544 = ((v524 + 8), 4) in
+let v545 = ((v262 - 3) - 2) in
+let v546 = (let l547 = (v247 - 2) in (v191 < l547)) in
+let v548 = ((v524 + 9) + 3) in
+let v549 = (if (v46 > v53) then v465 else (v16 = v16)) in
+let v550 = ((v182 && v90), (v231 - 7)) in
+let v551 = ((let l552 = (88, true, 39) in 21) + 0) in
+let v553 = ((v432 + 1) - 6) in
+let v554 = ((v281 + 7) + 9) in
+let v555 = ((if v408 then v213 else false), (v126 < v464)) in
+let v556 = ((let l557 = v210 in v89) - 7) in
+let v558 = (not (v154 > v295)) in
+let v559 = false in
+let v560 = (v195 + 4) in
+let v561 = ((not v79), (let l562 = 73 in v481)) in
+let v563 = v126 in
+let v564 = ((88 - 0), (v88 > 19)) in
+let v565 = ((v81 - 3), v67, v177) in
+let v566 = v549 in
+let v567 = v103 in
+let v568 = ((v104 - 2) - 8) in
+let v569 = (v337, (74 + 6), 92) in
+let v570 = v413 in
+let v571 = (if false then (let l572 = false in false) else (let l573 = v211 in v182)) in
+let v574 = (v44 - 4) in
+let v575 = v363 in
+let v576 = ((not v371) || (let l577 = 73 in false)) in
+let v578 = v548 in
+let v579 = v272 in
+let v580 = (let l581 = (if v70 then v474 else v87) in v326) in
+let v582 = 46 in
+let v583 = (v111 - 5) in
+let v584 = (v425 - 1) in
+let v585 = v391 in
+let v586 = ((v495 && v481), v570) in
+let v587 = (if (v398 > v53) then (v249, v83, v534) else (v65, v543, 35)) in
+let v588 = ((if v478 then v294 else v278) - 8) in
+let v589 = (0, 80) in
+let v590 = ((v430 + 0) - 7) in
+let v591 = (let l592 = (let l593 = v254 in 0) in (v359 && true)) in
+let v594 = (if ((true, true, 45) = v174) then (if v293 then 84 else v486) else (let l595 = v303 in v247)) in
+let v596 = (v534 + 2) in
+let v597 = (let l598 = (v397 - 4) in (v184 - 9)) in
+let v599 = (v112, (let l600 = v190 in v194), (v46 < v91)) in
+let v601 = ((if v0 then v508 else v182) && (97 = v347)) in
+let v602 = ((false <> v453) = (v470 <> v249)) in
+let v603 = ((not false), (65 > 51)) in
+let v604 = ((let l605 = v384 in v416) + 2) in
+let v606 = ((let l607 = v187 in v372) || false) in
+let v608 = v218 in
+let v609 = ((let l610 = v27 in 62) + 8) in
+let v611 = ((17 - 2) - 9) in
+let v612 = (if (if v63 then v331 else v501) then (v429 - 3) else v195) in
+let v613 = (if v394 then (let l614 = v36 in v538) else (62 > v475)) in
+let v615 = ((8 - 4) - 1) in
+let v616 = (let l617 = (93 + 5) in (v351 - 7)) in
+let v618 = true in
+let v619 = v327 in
+let v620 = (54 + 3) in
+let v621 = ((98 + 6) + 6) in
+let v622 = (let l623 = (v93, true) in (v403, v215, v144)) in
+let v624 = v466 in
+let v625 = ((v9 - 2) + 3) in
+let v626 = ((58 - 2) + 7) in
+let v627 = v126 in
+let v628 = ((v115 - 4), (96 - 2)) in
+let v629 = ((v462 + 5) + 6) in
+let v630 = (let l631 = v114 in (17, 57)) in
+let v632 = ((55 + 0) - 4) in
+let v633 = (if false then (54 <> 82) else v535) in
+let v634 = v582 in
+let v635 = v586 in
+let v636 = ((v425 + 2) + 4) in
+let v637 = (let l638 = (v148 + 3) in true) in
+let v639 = (let l640 = (false || v77) in (if v271 then v376 else v15)) in
+let v641 = (let l642 = (let l643 = v424 in v231) in (v270 - 4)) in
+let v644 = ((if v539 then v501 else v327), (40 + 8), (v551 - 4)) in
+let v645 = ((v105 + 6) - 0) in
+let v646 = ((v180 - 4) > (v556 + 6)) in
+let v647 = ((v575 - 2) + 2) in
+let v648 = v342 in
+let v649 = (if (if v327 then v198 else v298) then (v66 - 2) else (v521 - 8)) in
+let v650 = (let l651 = (v482 + 4) in (v625 - 4)) in
+let v652 = ((v474 && v525) <> true) in
+let v653 = false in
+let v654 = (let l655 = 71 in (let l656 = v111 in v330)) in
+let v657 = (72, (v530 + 9), (v237 <= v54)) in
+let v658 = (let l659 = (if v199 then v28 else 7) in (if true then v644 else v448)) in
+let v660 = ((let l661 = v439 in v155) && (if v202 then false else false)) in
+let v662 = (false || v73) in
+let v663 = (v91 - 9) in
+let v664 = ((not false), (v532 + 0)) in
+let v665 = ((if v356 then v76 else v626) - 5) in
+let v666 = ((let l667 = false in 62) - 7) in
+let v668 = (if (v649 <= v94) then (47 <= 6) else (true || v613)) in
+let v669 = ((v91 <> 81), (v390 + 4)) in
+let v670 = v248 in
+let v671 = (v363 - 0) in
+let v672 = v18 in
+let v673 = ((let l674 = 57 in v328) - 2) in
+let v675 = ((v118 && false), (v364 - 0)) in
+let v676 = ((v428 + 9), (v479 = v560)) in
+let v677 = 12 in
+let v678 = v648 in
+let v679 = ((v121 - 5) - 7) in
+let v680 = v115 in
+let v681 = ((v75 + 4) + 0) in
+let v682 = v375 in
+let v683 = v38 in
+let v684 = (let l685 = (v260 <> true) in (v467 - 7)) in
+let v686 = (let l687 = (v496, v397) in (if v292 then 34 else v344)) in
+let v688 = (if (if v366 then v637 else false) then (v252 - 9) else (v71 - 8)) in
+let v689 = ((if true then 33 else v563) - 2) in
+let v690 = ((v215 - 7) - 9) in
+let v691 = 73 in
+let v692 = 21 in
+let v693 = (v430 < v556) in
+let v694 = (v59 > 32) in
+let v695 = ((if false then v548 else v472) + 7) in
+let v696 = ((v200 + 3) - 3) in
+let v697 = v355 in
+let v698 = ((40 + 6) - 1) in
+let v699 = ((if v80 then 14 else v231) - 3) in
+let v700 = ((let l701 = v566 in v237), true, (v591 && false)) in
+let v702 = (v532 + 6) in
+let v703 = (let l704 = (v333 + 6) in (75 - 0)) in
+let v705 = ((v397 - 8) + 8) in
+let v706 = ((if true then v256 else v321) && v26) in
+let v707 = (let l708 = v282 in (v471 + 0)) in
+let v709 = ((v466 - 7) = (5 + 0)) in
+let v710 = (let l711 = (v594 - 6) in v117) in
+let v712 = v384 in
+let v713 = ((v172 - 2) - 6) in
+let v714 = v232 in
+let v715 = ((v60 - 7) + 4) in
+let v716 = v620 in
+let v717 = ((v597 + 3), (not v234)) in
+let v718 = (v634, v488) in
+let v719 = ((10 + 6) + 6) in
+let v720 = 84 in
+let v721 = ((v33 - 2) >= (v531 + 5)) in
+let v722 = ((v33 - 3) + 1) in
+let v723 = (let l724 = (v44, v498) in (v88 + 0)) in
+let v725 = (let l726 = (v494 + 4) in v365) in
+let v727 = ((let l728 = v413 in v309), v678) in
+let v729 = ((v388 + 6) <> (16 - 4)) in
+let v730 = v101 in
+let v731 = ((60 + 6) + 3) in
+let v732 = ((if false then v323 else v171) - 3) in
+let v733 = ((v4 - 9) = (if v235 then 68 else v548)) in
+let v734 = (v596 - 3) in
+let v735 = ((if v535 then v209 else 31) - 8) in
+let v736 = ((v251 + 5) + 0) in
+let v737 = ((v58 - 9) <> (72 - 8)) in
+let v738 = ((v554 - 4) - 2) in
+let v739 = (if (false = v232) then v323 else (if v32 then 22 else v520)) in
+let v740 = ((v492 - 3) - 1) in
+let v741 = ((if true then 68 else v211) - 6) in
+let v742 = v590 in
+let v743 = (if false then (v742 - 3) else (v255 + 5)) in
+let v744 = ((8 + 3) - 3) in
+let v745 = (v626 <= (v159 - 4)) in
+let v746 = ((v691 + 8) >= (6 + 2)) in
+let v747 = v662 in
+let v748 = ((37 + 3) <= (let l749 = v127 in v624)) in
+let v750 = v289 in
+let v751 = ((58 < 31) = (v440 || v213)) in
+let v752 = (77 < (v428 + 2)) in
+let v753 = (let l754 = false in v86) in
+let v755 = (if (v536 <= 86) then (79 + 9) else (13 - 7)) in
+let v756 = (75 + 9) in
+let v757 = ((let l758 = v120 in v462) <> (94 - 5)) in
+let v759 = (let l760 = (61 + 1) in (false || true)) in
+let v761 = v185 in
+let v762 = ((v397 - 0) + 2) in
+let v763 = ((v698 + 4) + 5) in
+let v764 = v563 in
+let v765 = (v715 + 8) in
+let v766 = ((v406 + 6) - 8) in
+let v767 = ((if v434 then false else v601), (if v188 then 25 else 24)) in
+let v768 = ((v597 + 1) - 3) in
+let v769 = (if (if false then true else v445) then (v696 > v634) else (v398 <= v429)) in
+let v770 = v407 in
+let v771 = false in
+let v772 = v489 in
+let v773 = 41 in
+let v774 = ((v76 - 3) - 8) in
+let v775 = v634 in
+let v776 = (v44 - 1) in
+let v777 = ((93 + 0) > (47 - 8)) in
+let v778 = v715 in
+let v779 = ((50 + 4) + 9) in
+let v780 = ((v289 <> v609), v54) in
+let v781 = (if v202 then (let l782 = v21 in v753) else (if v446 then (97, true, false) else v672)) in
+let v783 = (false, true, true) in
+let v784 = ((v126 + 5) - 3) in
+let v785 = (if (let l786 = v113 in v729) then (v448 = (true, 3, 69)) else (let l787 = 50 in true)) in
+let v788 = 47 in
+let v789 = v462 in
+let v790 = (let l791 = (v690 + 8) in 94) in
+let v792 = ((v83 = v42) && (v345 || true)) in
+let v793 = (let l794 = 22 in (v551 - 8)) in
+let v795 = (let l796 = v323 in (60, v91, v342)) in
+let v797 = (v207 + 8) in
+let v798 = v133 in
+let v799 = v763 in
+let v800 = ((v766 - 3) >= (v317 + 3)) in
+let v801 = (let l802 = (45 + 0) in (15 + 5)) in
+let v803 = ((v91 >= v367), (v176 = false)) in
+let v804 = ((v50 + 6) - 4) in
+let v805 = 99 in
+let v806 = v611 in
+let v807 = (v40, v441) in
+let v808 = ((40 + 5) + 0) in
+let v809 = (if (if true then true else v709) then v225 else 63) in
+let v810 = (let l811 = (true, false, 84) in v325) in
+let v812 = ((v244 + 0) <= v521) in
+let v813 = ((v520 - 1) - 7) in
+let v814 = (if (false || v192) then (if v145 then 99 else v47) else (v560 + 5)) in
+let v815 = ((let l816 = v622 in 54) + 9) in
+let v817 = ((if v812 then v649 else 31), (v490 < 57)) in
+let v818 = ((if v777 then 18 else v190) + 0) in
+let v819 = v771 in
+let v820 = true in
+let v821 = ((v449 + 9) - 1) in
+let v822 = v309 in
+let v823 = ((let l824 = v141 in v352) + 9) in
+let v825 = v465 in
+let v826 = v21 in
+let v827 = (if (v321 && v525) then (v163 >= v520) else (35 >= 81)) in
+let v828 = (v187 >= (68 + 4)) in
+let v829 = ((v346 - 9) - 4) in
+let v830 = (if (not true) then (v511 + 5) else (if v435 then v281 else 47)) in
+let v831 = (not (v60 >= 48)) in
+let v832 = v66 in
+let v833 = ((if v504 then v417 else true) || (v569 = v357)) in
+let v834 = (if (v138 <= v665) then v622 else (v549, v10, v500)) in
+let v835 = ((let l836 = v3 in false), (let l837 = 4 in v706), v662) in
+let v838 = ((v806 + 0) - 0) in
+let v839 = (v558, (v292 = v785)) in
+let v840 = ((v487 > 54), (let l841 = v195 in 97)) in
+let v842 = (if (let l843 = 93 in v199) then 2 else v74) in
+let v844 = 62 in
+let v845 = ((32 - 2) - 1) in
+let v846 = ((if v602 then v768 else v200) < v467) in
+let v847 = ((v194 && v117) || (v38 > v108)) in
+let v848 = (v371 <> (v350 <= v609)) in
+let v849 = (v207, (not v188), (v130 - 9)) in
+let v850 = ((if true then v596 else v270) - 6) in
+let v851 = v125 in
+let v852 = (v720 + 4) in
+let v853 = ((let l854 = (true, 92) in v136) && (v283 > v392)) in
+let v855 = true in
+let v856 = ((v258 - 8), v653) in
+let v857 = ((if v523 then v266 else v31) + 9) in
+let v858 = v74 in
+let v859 = (v808 + 2) in
+let v860 = v171 in
+let v861 = ((not v412), (v303 + 8)) in
+let v862 = (let l863 = (v413 + 9) in (v210 + 2)) in
+let v864 = (99 + 3) in
+let v865 = ((v60 + 7) - 3) in
+let v866 = v101 in
+let v867 = ((19 + 8) - 9) in
+let v868 = (v447 - 4) in
+let v869 = ((v715 = v567) || false) in
+let v870 = ((v193, v471) <> (v505, v789)) in
+let v871 = ((not v653) <> (let l872 = v387 in v485)) in
+let v873 = ((v627 - 7) + 0) in
+let v874 = ((let l875 = v235 in 19) - 2) in
+let v876 = v331 in
+let v877 = ((not v373) = (51 <> v438)) in
+let v878 = v59 in
+let v879 = (v407 >= (v503 + 5)) in
+let v880 = ((v270 + 7) >= (v219 - 0)) in
+let v881 = (if (false || v435) then (if v29 then (false, false) else v196) else (v117, true)) in
+let v882 = v344 in
+let v883 = v135 in
+let v884 = (if (true || v0) then v395 else v576) in
+let v885 = ((v650 + 1) + 2) in
+let v886 = v19 in
+let v887 = (if v304 then (let l888 = v89 in v551) else v423) in
+let v889 = ((v671 = v621), (84 + 0), (let l890 = v807 in false)) in
+let v891 = v230 in
+let v892 = v29 in
+let v893 = ((v543 - 9) - 6) in
+let v894 = ((28 + 5) + 1) in
+let v895 = ((61 + 1) > (v58 - 8)) in
+let v896 = ((v429 - 4) - 6) in
+let v897 = v644 in
+let v898 = ((v789 < v361) && (v321 || v162)) in
+let v899 = v123 in
+let v900 = (85, false) in
+let v901 = ((v763 + 7) + 2) in
+let v902 = (v180 + 8) in
+let v903 = (let l904 = (v697, 53) in (80 + 7)) in
+let v905 = 98 in
+let v906 = (v276 - 7) in
+let v907 = (if (if false then false else v434) then (v618 && v202) else (v452 <> v430)) in
+let v908 = ((v530 + 7) + 2) in
+let v909 = (v524 + 4) in
+let v910 = v464 in
+let v911 = ((let l912 = (0, 65, false) in 27) >= (v731 - 3)) in
+let v913 = (v809 - 1) in
+let v914 = (let l915 = (let l916 = (68, 2) in v325) in (6 + 6)) in
+let v917 = (if false then (v390 + 2) else v896) in
+let v918 = false in
+let v919 = v596 in
+let v920 = ((v95 - 6) + 2) in
+let v921 = 64 in
+let v922 = (v459 - 4) in
+let v923 = (v578 + 5) in
+let v924 = ((if v523 then v553 else v103) + 5) in
+let v925 = 90 in
+let v926 = ((v838 <= v919) = (v637 && v394)) in
+let v927 = true in
+let v928 = (v388, v220, (v220 || false)) in
+let v929 = ((v56 + 7) < (13 - 8)) in
+let v930 = ((if false then v140 else v909) + 1) in
+let v931 = v105 in
+let v932 = ((v49 - 9) >= (let l933 = v647 in v303)) in
+let v934 = ((v49 + 1), (v319 = v195)) in
+let v935 = (if false then (v892, true) else v239) in
+let v936 = v69 in
+let v937 = ((if v825 then 28 else v641) + 6) in
+let v938 = ((if true then v353 else 21) - 1) in
+let v939 = v117 in
+let v940 = v160 in
+let v941 = v480 in
+let v942 = (if true then ((false, true, true) = v223) else (v406 <> v157)) in
+let v943 = ((41 + 4) + 6) in
+let v944 = v852 in
+let v945 = v559 in
+let v946 = ((61 + 5), (v4 < v686), v799) in
+let v947 = ((let l948 = v582 in true), ((88, false) <> v125)) in
+let v949 = ((64 - 8) - 2) in
+let v950 = ((v338 - 3) + 7) in
+let v951 = ((v22 - 2) + 7) in
+let v952 = 7 in
+let v953 = v809 in
+let v954 = ((not v759), (v892 && v827), (v186 || true)) in
+let v955 = (not v321) in
+let v956 = (v459, (v43 <> 31)) in
+let v957 = ((v713 - 5) + 9) in
+let v958 = v707 in
+let v959 = ((70 + 4) - 8) in
+let v960 = ((v105 + 5), (false || true)) in
+let v961 = v78 in
+let v962 = (if (v826 <> (false, false, 50)) then (v910 < 50) else true) in
+let v963 = v834 in
+let v964 = (v707 + 4) in
+let v965 = v669 in
+let v966 = ((v937 - 2) - 3) in
+let v967 = ((1 + 3) - 2) in
+let v968 = v27 in
+let v969 = (v225 + 7) in
+let v970 = (not (v941 >= v351)) in
+let v971 = (let l972 = (let l973 = 68 in 80) in (v359, v798)) in
+let v974 = (not (v210 > 1)) in
+let v975 = (v683 - 7) in
+let v976 = ((v823 <= v740) && (let l977 = 90 in v384)) in
+let v978 = (v371, v660, (if v694 then v838 else v857)) in
+let v979 = v375 in
+let v980 = ((v378 + 9) + 6) in
+let v981 = 50 in
+let v982 = ((14 = v436), (v253 <= 62), v591) in
+let v983 = ((50 - 3) - 5) in
+let v984 = v856 in
+let v985 = ((if v481 then v488 else v955) = v898) in
+let v986 = (14 + 4) in
+let v987 = v964 in
+let v988 = 39 in
+let v989 = v790 in
+let v990 = ((if true then v501 else v384) && v911) in
+let v991 = v131 in
+let v992 = (53 - 9) in
+let v993 = ((let l994 = v961 in 79) - 9) in
+let v995 = (44, false) in
+let v996 = ((v462 + 4) + 3) in
+let v997 = ((if v136 then 67 else v967) + 7) in
+let v998 = ((v830 + 0) - 5) in
+let v999 = 34 in
+let v1000 = (let l1001 = v619 in (v180 + 5)) in
+let v1002 = v515 in
+let v1003 = ((if v372 then v295 else v332) - 4) in
+let v1004 = (if (true && v870) then (v240 > v50) else (v202 || false)) in
+let v1005 = (v878 - 4) in
+let v1006 = ((if v932 then v447 else v452) >= (v142 - 9)) in
+let v1007 = ((35 - 8) + 6) in
+let v1008 = (72 + 2) in
+let v1009 = ((v69 + 0) - 7) in
+let v1010 = ((8 - 4) - 2) in
+let v1011 = ((v894 - 1) + 2) in
+let v1012 = (v231 + 2) in
+let v1013 = ((74 - 9) + 4) in
+let v1014 = ((let l1015 = v709 in v69) + 5) in
+let v1016 = false in
+let v1017 = ((69 + 4) - 3) in
+let v1018 = ((v305 - 6) + 7) in
+let v1019 = ((v439 - 8) - 0) in
+let v1020 = ((v594 - 8) + 6) in
+let v1021 = (if false then v443 else (true, v353)) in
+let v1022 = v877 in
+let v1023 = ((11 - 7), (v195 - 2), (let l1024 = v903 in v997)) in
+let v1025 = 49 in
+let v1026 = ((let l1027 = v636 in 2) + 2) in
+let v1028 = (if v737 then (v663 - 6) else (2 - 5)) in
+let v1029 = ((v903 - 7) + 4) in
+let v1030 = ((14 <> v999) && (let l1031 = v965 in true)) in
+let v1032 = (57 - 5) in
+let v1033 = v167 in
+let v1034 = ((let l1035 = v251 in 56) + 4) in
+let v1036 = ((v425 - 5) - 2) in
+let v1037 = ((v765 - 4), (v864 + 2), false) in
+let v1038 = ((70 - 8) + 2) in
+let v1039 = v721 in
+let v1040 = (let l1041 = (v636 + 2) in (v650 - 4)) in
+let v1042 = (let l1043 = (v486 <= 60) in (v487 + 4)) in
+let v1044 = (not (v1030 && v892)) in
+let v1045 = (not (v345 || false)) in
+let v1046 = v146 in
+let v1047 = ((v190 - 6) + 0) in
+let v1048 = (if v546 then v432 else 57) in
+let v1049 = ((if v417 then v940 else v428) >= (v278 + 2)) in
+let v1050 = ((let l1051 = (70, false, false) in v464) - 9) in
+let v1052 = (v666 - 3) in
+let v1053 = (if (true || true) then (v750 + 7) else (21 - 0)) in
+let v1054 = ((if v927 then v591 else false), (15 + 5), (v38 + 9)) in
+let v1055 = ((v799 - 1) - 5) in
+let v1056 = (not (6 > v227)) in
+let v1057 = 93 in
+let v1058 = ((v128 < v224), v769, (v350 <= v894)) in
+let v1059 = (let l1060 = (true, v1006, v359) in v7) in
+let v1061 = (let l1062 = (21 < v208) in v61) in
+let v1063 = v82 in
+let v1064 = v856 in
+let v1065 = ((v342 - 5) > (v361 + 6)) in
+let v1066 = ((if true then v289 else v333) + 2) in
+let v1067 = ((v138 - 4) - 9) in
+let v1068 = ((not v199) && (if v757 then true else false)) in
+let v1069 = ((v560 + 7) < (v414 + 3)) in
+let v1070 = v1002 in
+let v1071 = ((if false then v353 else 57), (not true), (v736 - 7)) in
+let v1072 = (if (v1007 = v627) then (v880 && false) else v410) in
+let v1073 = ((v570 - 3) + 8) in
+let v1074 = ((let l1075 = v966 in v715), 76, v929) in
+let v1076 = (77 - 5) in
+let v1077 = (v1063 < (v426 - 1)) in
+let v1078 = (true, (44 + 9)) in
+let v1079 = ((41 - 0) + 3) in
+let v1080 = (if (v540 < v1050) then (let l1081 = v715 in v241) else v817) in
+let v1082 = ((v950 + 2), (v503 = v190)) in
+let v1083 = ((let l1084 = v251 in 52) >= (v364 + 2)) in
+let v1085 = ((if v112 then v133 else v46) = (81 + 7)) in
+let v1086 = v996 in
+let v1087 = ((37 - 2) - 6) in
+let v1088 = (let l1089 = v4 in (v679 + 6)) in
+let v1090 = ((v434 && v729), (v257 - 0), (v868 - 4)) in
+let v1091 = ((v1063 + 5) >= v471) in
+let v1092 = ((if false then v940 else v108) <= v790) in
+let v1093 = v524 in
+let v1094 = ((v47 - 9) - 1) in
+let v1095 = ((let l1096 = v894 in v602), (59 < 96), (v1028 < v921)) in
+let v1097 = ((not v359), (82 - 7), (v799 + 3)) in
+let v1098 = ((v224 + 3) - 3) in
+let v1099 = (true && (false && false)) in
+let v1100 = (v871 && v1049) in
+let v1101 = ((v808 + 6) <> (88 - 1)) in
+let v1102 = 3 in
+let v1103 = (let l1104 = (91 + 6) in (22 - 2)) in
+let v1105 = ((85 + 9) > (v680 + 1)) in
+let v1106 = (let l1107 = (38 + 8) in (v138 - 0)) in
+let v1108 = (v103 + 4) in
+let v1109 = (v37 >= (v626 - 0)) in
+let v1110 = (if (v137 <> v143) then v757 else (v47 > v809)) in
+let v1111 = (v1066, (v227 - 7)) in
+let v1112 = ((if v853 then v819 else v371) && (v604 < v339)) in
+let v1113 = false in
+let v1114 = v1101 in
+let v1115 = ((v804 - 3) + 8) in
+let v1116 = ((v536 >= 84) && (v374 || false)) in
+let v1117 = ((v878 + 5), v1083) in
+let v1118 = 59 in
+let v1119 = ((v945 && v80) = (let l1120 = 81 in v1070)) in
+let v1121 = ((v505 + 4), (let l1122 = 47 in v402)) in
+let v1123 = (((72, 86) = v628), (v154 - 3), (80 + 2)) in
+let v1124 = (if false then v106 else (v407 - 3)) in
+let v1125 = (if (v92 <> 34) then (v989 - 3) else 28) in
+let v1126 = v146 in
+let v1127 = (if true then (v459 + 8) else (31 - 0)) in
+let v1128 = (v531 - 9) in
+let v1129 = v83 in
+let v1130 = ((not v892) || (let l1131 = 7 in v498)) in
+let v1132 = ((let l1133 = v1127 in v1014) + 1) in
+let v1134 = ((18 - 4) + 3) in
+let v1135 = ((v858 - 6) + 7) in
+let v1136 = (if (let l1137 = v1047 in v633) then v709 else (v366 || v898)) in
+let v1138 = ((47 + 3) = (v428 - 2)) in
+let v1139 = ((v423 - 0) = (v68 - 4)) in
+let v1140 = ((if v0 then v766 else 36), (if v725 then v60 else v815)) in
+let v1141 = ((v462 + 3) - 4) in
+let v1142 = v237 in
+let v1143 = (v1002, (if v668 then v1127 else 11)) in
+let v1144 = (v830 - 6) in
+let v1145 = ((49 + 8) + 7) in
+let v1146 = v133 in
+let v1147 = (not (v137 <> v470)) in
+let v1148 = (v53 + 1) in
+let v1149 = ((v409 + 7) - 1) in
+let v1150 = v67 in
+let v1151 = ((if v185 then 0 else 4) + 2) in
+let v1152 = ((v650 + 6) <> (v449 + 1)) in
+let v1153 = ((let l1154 = v712 in v1026) > (80 + 4)) in
+let v1155 = v99 in
+let v1156 = ((v636 + 0) - 0) in
+let v1157 = ((v560 - 9) + 6) in
+let v1158 = v512 in
+let v1159 = (v530 + 6) in
+let v1160 = (not (v55 >= 17)) in
+let v1161 = (if (v1148 <> v1132) then (v462 - 1) else (38 + 1)) in
+let v1162 = v467 in
+let v1163 = (false, (v252 + 2)) in
+let v1164 = ((not v167), (let l1165 = v58 in 36)) in
+let v1166 = ((v778 + 2) - 8) in
+let v1167 = ((v1038 - 5) <= (if false then 56 else 26)) in
+let v1168 = v771 in
+let v1169 = (91 + 7) in
+let v1170 = ((v616 - 1) - 7) in
+((v1013 - 6) + 9)
@@ -0,0 +1,143 @@
+let id = \x -> x in
+let const = \x -> \y -> x in
+let pair = \x -> \y -> (x, y) in
+let twice = \f -> \x -> f (f x) in
+let compose = \f -> \g -> \x -> f (g x) in
+let flip = \f -> \x -> \y -> f y x in
+let h0 = compose id id in
+let p2 = flip const (((false, 63, false) = (true, 69, true))) (83) in
+let p4 = compose (\z3 -> not z3) (\z3 -> z3) ((p2 >= p2)) in
+let p7 = h0 ((let l5 = p4 in p2)) in
+let p9 = id (52) in
+let p11 = pair ((95, 88, false)) ((p9 + 0)) in
+let p13 = twice id ((p4 || p4)) in
+let p16 = twice id ((let l14 = (83, 30, 15) in p2)) in
+let p18 = twice id ((p4, p16, 72)) in
+let p21 = flip const ((let l19 = p16 in p13)) ((38 >= 91)) in
+let p23 = h0 (p2) in
+let h24 = compose h0 id in
+let p26 = twice (\z25 -> z25 + 1) ((16 - 2)) in
+let p29 = h0 (p4) in
+let p31 = flip pair ((p4, p29, 71)) ((if false then p13 else false)) in
+let p33 = flip const (p26) ((p16 + 8)) in
+let p35 = flip pair ((not p21)) (false) in
+let p37 = flip pair ((p21 && false)) ((97, 35, 56)) in
+let p40 = flip const (28) ((let l38 = p33 in p29)) in
+let p42 = pair ((22 <> 83)) (0) in
+let p44 = flip const ((p29, p13)) ((p7 - 4)) in
+let p46 = flip const ((p44 - 8)) (p4) in
+let h47 = compose h24 id in
+let p49 = pair ((36 + 9)) ((p16 + 9)) in
+let p51 = h24 ((61 + 0)) in
+let p53 = twice (\z52 -> z52 + 1) ((if p4 then p23 else p33)) in
+let p55 = twice id ((p9 - 1)) in
+let p57 = h0 ((p16 - 3)) in
+let p59 = twice id ((p55 >= p44)) in
+let p62 = pair ((let l60 = 52 in 76)) ((if p46 then 1 else p33)) in
+let p64 = twice (\z63 -> z63 + 1) ((99 + 9)) in
+let p66 = flip pair ((p44 - 6)) ((p55 - 1)) in
+let p68 = twice (\z67 -> z67 + 1) (39) in
+let h69 = compose h24 id in
+let p71 = flip pair ((not p13)) ((if p40 then p18 else p18)) in
+let p73 = flip const ((p9 <> 98)) ((p44 + 3)) in
+let p75 = twice (\z74 -> z74 + 1) (17) in
+let p77 = compose (\z76 -> not z76) (\z76 -> z76) ((let l78 = (32, 30, false) in p29)) in
+let p80 = flip pair ((88 > p68)) ((p44 > p68)) in
+let p82 = flip const (p2) ((false = p13)) in
+let p84 = pair ((p82, p40)) ((31, true, 42)) in
+let p86 = twice id (p51) in
+let p88 = id ((not p29)) in
+let p90 = h0 ((if p59 then (40, 76, 57) else (78, 49, 36))) in
+let h91 = compose h24 id in
+let p93 = twice (\z92 -> z92 + 1) (89) in
+let p95 = id (p35) in
+let p97 = flip const ((p93 - 1)) ((p44 + 0)) in
+let p99 = id ((p75, 71, p59)) in
+let p101 = const (20) (p64) in
+let p103 = flip const (p13) ((p68, false)) in
+let p105 = h24 (p82) in
+let p107 = h91 (p93) in
+let p109 = h24 ((97 + 7)) in
+let p111 = pair ((94, p13, false)) (p23) in
+let v112 = (if false then (not true) else (not p88)) in
+let v113 = (p57 - 6) in
+let v114 = ((p26 - 4) + 9) in
+let v115 = ((let l116 = p59 in v114), (88 + 6), (p86 - 6)) in
+let v117 = (40, false, false) in
+let v118 = p88 in
+let v119 = (51 - 3) in
+let v120 = ((if p4 then p53 else p97) + 7) in
+let v121 = (p4 || (p82 <> p4)) in
+let v122 = p26 in
+let v123 = ((6 + 6) - 7) in
+let v124 = (if (97 <= 99) then (not false) else (57 >= 61)) in
+let v125 = ((p33 + 9) + 3) in
+let v126 = ((p57 + 1) - 2) in
+let v127 = (13, 26) in
+let v128 = (60, (43 - 2), v112) in
+let v129 = ((if true then false else p77), (p59 || p105)) in
+let v130 = (let l131 = p59 in (true || p13)) in
+let v132 = (p44, (p23 - 8), (false || v121)) in
+let v133 = (true, 41) in
+let v134 = ((p107 + 8) - 7) in
+let v135 = ((p16 - 8) + 5) in
+let v136 = v123 in
+let v137 = ((p26 - 5) - 6) in
+let v138 = (p13, (p75 = v135)) in
+let v139 = ((v114 + 5) + 3) in
+let v140 = ((let l141 = v114 in false), (v128 = p99)) in
+let v142 = v137 in
+let v143 = ((true || v118) <> (p9 > p73)) in
+let v144 = (98 - 7) in
+let v145 = ((59 - 8) <> (p57 + 7)) in
+let v146 = (p64 - 6) in
+let v147 = ((not p82), (60 <= p55), (92 > 51)) in
+let v148 = ((not p13) && (if p59 then p4 else false)) in
+let v149 = ((let l150 = true in p51) < p2) in
+let v151 = (p73 + 5) in
+let v152 = v120 in
+let v153 = ((34 - 3), 5, (not p4)) in
+let v154 = ((65 - 5) - 7) in
+let v155 = (not v143) in
+let v156 = p103 in
+let v157 = (p86 + 6) in
+let v158 = ((v123 + 7) - 1) in
+let v159 = ((p97 + 8) + 7) in
+let v160 = ((p93 - 7) + 7) in
+let v161 = v160 in
+let v162 = (if true then (let l163 = p57 in (false, false, 32)) else (let l164 = (true, true) in (false, false, 79))) in
+let v165 = (p7 - 9) in
+let v166 = ((v120 - 5) - 9) in
+let v167 = 62 in
+let w168 = (if true then (58, (53, 51), 66, (42, false), false, 53, 80, false, 39, false, 92, 59, false, (false, true), (false, 79, true), 49, 2, 31, (52, 84), true, true, 99, (false, true), 34, 66, true, 28, false, 41, true, 5, 36, 88, 50, 22, true, false, 12, 80, (true, true, true), 95, (true, false), 5, (30, false, false), 43, (99, true, true), 65, true, 70, 56) else (39, (93, 61), 12, (90, true), true, 2, 29, true, 37, false, 39, 63, false, (false, true), (true, 75, false), 38, 55, 88, (63, 60), false, false, 74, (true, true), 55, 90, true, 28, false, 23, true, 51, 0, 66, 69, 97, false, false, 49, 80, (false, false, true), 20, (true, false), 17, (83, false, false), 97, (20, true, false), 79, true, 20, 18)) in
+let w169 = (58, (23, 44), p23, p103, v121, 19, 40, p21, p7, true, v144, p51, v143, (false, false), (false, 72, false), p73, v159, 81, p66, p4, p105, 67, p95, 5, p55, v130, v135, p46, p75, true, v136, v154, p53, v125, p101, v112, v143, 80, v113, v147, v119, (false, false), 71, v117, 86, v117, v165, v124, v165, 56) in
+let w170 = (p107, v127, p2, v156, p88, 22, v165, true, p2, v149, v125, v126, v145, v138, (false, 30, false), 76, 66, v161, (38, 97), false, p88, v161, v138, v159, v161, p13, v122, v112, p68, true, 7, v166, 34, p93, 19, p77, true, p53, v152, (true, true, true), p7, p35, p75, (30, false, true), v146, v117, v160, v143, v161, 23) in
+let w171 = (w168, w169) in
+let b172 = ((w168 = w169) || (w169 <> w170)) in
+let f173 = \f173_a0 -> \f173_a1 -> \f173_a2 -> \f173_a3 -> \f173_a4 -> \f173_a5 -> \f173_a6 -> \f173_a7 -> \f173_a8 -> \f173_a9 -> \f173_a10 -> \f173_a11 -> \f173_a12 -> \f173_a13 -> \f173_a14 -> \f173_a15 -> \f173_a16 -> \f173_a17 -> \f173_a18 -> \f173_a19 -> \f173_a20 -> \f173_a21 -> \f173_a22 -> \f173_a23 -> \f173_a24 -> \f173_a25 -> \f173_a26 -> \f173_a27 -> \f173_a28 -> \f173_a29 -> \f173_a30 -> \f173_a31 -> \f173_a32 -> \f173_a33 -> \f173_a34 -> \f173_a35 -> \f173_a36 -> \f173_a37 -> \f173_a38 -> \f173_a39 -> \f173_a40 -> \f173_a41 -> \f173_a42 -> \f173_a43 -> \f173_a44 -> \f173_a45 -> \f173_a46 -> \f173_a47 -> \f173_a48 -> \f173_a49 -> (f173_a0 + f173_a1 + (if f173_a2 then 1 else 0) + f173_a3 + f173_a4 + (if f173_a5 then 1 else 0) + f173_a6 + f173_a7 + (if f173_a8 then 1 else 0) + f173_a9 + f173_a10 + (if f173_a11 then 1 else 0) + f173_a12 + f173_a13 + (if f173_a14 then 1 else 0) + f173_a15 + f173_a16 + (if f173_a17 then 1 else 0) + f173_a18 + f173_a19 + (if f173_a20 then 1 else 0) + f173_a21 + f173_a22 + (if f173_a23 then 1 else 0) + f173_a24 + f173_a25 + (if f173_a26 then 1 else 0) + f173_a27 + f173_a28 + (if f173_a29 then 1 else 0) + f173_a30 + f173_a31 + (if f173_a32 then 1 else 0) + f173_a33 + f173_a34 + (if f173_a35 then 1 else 0) + f173_a36 + f173_a37 + (if f173_a38 then 1 else 0) + f173_a39 + f173_a40 + (if f173_a41 then 1 else 0) + f173_a42 + f173_a43 + (if f173_a44 then 1 else 0) + f173_a45 + f173_a46 + (if f173_a47 then 1 else 0) + f173_a48 + f173_a49) in
+let g175 = f173 ((v146 - 2)) ((if v155 then v135 else v151)) ((let l174 = p9 in false)) (v154) ((v114 - 5)) ((v155 || p46)) ((p73 - 7)) ((v126 - 4)) (false) ((v142 + 5)) ((58 - 4)) ((not p29)) ((v142 + 1)) ((v158 - 3)) (v155) ((v157 - 1)) ((p57 - 1)) (p105) (p16) (v120) ((not v130)) ((93 + 1)) ((3 + 4)) ((not v124)) ((v119 + 4)) (v137) ((p75 >= v137)) ((if p13 then v134 else v126)) ((2 + 8)) ((58 <= v158)) ((p57 - 8)) in
+let c179 = g175 ((let l176 = p18 in v159)) ((if v143 then p13 else p77)) ((v125 + 6)) ((76 - 0)) ((false || false)) ((v158 + 1)) ((v113 + 9)) (v112) ((91 + 0)) ((let l177 = (false, true) in 75)) ((if p21 then v149 else v155)) ((p23 + 1)) (p109) ((v167 >= p68)) ((5 + 9)) (v114) (p82) ((41 - 3)) ((let l178 = p21 in p55)) in
+let g181 = f173 (v142) ((v139 + 7)) ((v151 <> p9)) ((18 - 2)) ((p86 + 1)) ((not false)) ((28 + 3)) ((v166 + 5)) ((p44 = v146)) ((v159 - 1)) ((v123 - 5)) ((v165 >= p26)) (46) (p7) ((3 <> 80)) ((90 + 3)) ((if true then p33 else v167)) ((false || p77)) (p93) ((let l180 = v137 in v158)) ((if v130 then v118 else v118)) (p93) ((v122 + 1)) (v112) ((v122 - 4)) ((30 + 4)) (p29) ((17 - 9)) ((42 + 2)) ((not p88)) ((16 - 6)) ((v151 - 3)) ((p109 = 76)) in
+let c182 = g181 ((if true then p75 else p23)) (91) ((p7 <> v160)) ((p97 + 7)) (v126) ((v119 <= p23)) ((39 + 8)) ((68 + 4)) ((false && true)) (v167) ((p7 - 4)) ((if v112 then v149 else true)) ((p16 + 5)) ((v167 - 5)) ((not p88)) ((p2 - 4)) ((v146 - 8)) in
+let g185 = f173 ((90 - 8)) (69) ((b172 || true)) (p101) ((49 + 6)) ((if p21 then v148 else false)) ((v126 - 9)) ((p107 + 7)) (v124) ((v113 + 1)) ((36 - 5)) ((v133 = p42)) ((p97 + 3)) ((v134 - 7)) (b172) ((v167 + 2)) ((p9 - 2)) ((true && v143)) (v125) ((80 + 2)) ((let l183 = v133 in v145)) ((p44 + 3)) (p68) ((p101 >= v135)) ((v165 - 4)) ((v157 - 9)) (false) ((let l184 = p29 in v142)) (p51) ((p29 && v124)) ((94 - 3)) ((v114 - 5)) ((if true then p40 else false)) (p51) in
+let c187 = g185 ((v114 - 6)) ((11 < v152)) ((v114 + 0)) ((if p21 then 92 else v144)) ((96 > p109)) ((v158 - 3)) ((v136 + 1)) ((p82 && p59)) ((p64 - 7)) ((40 - 1)) ((p97 >= v151)) ((v157 - 6)) ((v136 + 1)) ((let l186 = p93 in v130)) ((64 - 1)) ((p97 - 8)) in
+let g192 = f173 ((v159 - 5)) ((v167 - 3)) ((v155 = b172)) ((58 - 1)) ((v136 + 1)) ((if p29 then p13 else true)) (p2) ((87 - 8)) ((if v145 then v145 else v130)) ((p55 - 7)) ((if p77 then 91 else 70)) ((not p29)) (18) ((let l188 = v149 in v166)) ((p57 < v139)) (p93) ((let l189 = p97 in p64)) ((p86 <= v152)) ((35 + 1)) ((v159 + 6)) (v149) ((36 - 3)) (p44) ((false = v124)) (26) ((v125 + 9)) ((let l190 = v158 in true)) ((32 + 7)) ((v142 + 9)) ((v135 = p109)) ((94 + 4)) ((34 - 8)) ((let l191 = 61 in true)) ((26 - 2)) ((v136 - 6)) (v124) ((p26 + 7)) in
+let c193 = g192 (27) (((52, false) = v156)) ((p7 - 3)) ((v113 - 4)) ((p77 && false)) (78) ((p16 + 3)) ((46 = 39)) ((33 - 1)) ((v135 + 5)) ((v145 && false)) ((61 + 4)) (98) in
+let g194 = f173 ((if false then v123 else p7)) ((70 + 9)) ((45 >= v135)) ((v159 - 2)) ((if v130 then 76 else v161)) ((48 >= v152)) in
+let c197 = g194 ((if p13 then 82 else p16)) (v151) ((v130 = v155)) ((45 - 6)) (92) ((p40 && v130)) ((v151 - 1)) ((p16 - 5)) ((not v130)) ((p2 + 8)) ((v165 + 2)) (p4) ((let l195 = v126 in p9)) ((if p29 then v157 else 13)) (true) ((p44 + 1)) ((v134 + 6)) ((p107 >= p101)) (56) ((v119 - 3)) (false) ((p2 + 8)) (p16) (p46) ((49 + 5)) ((v146 - 6)) (v112) (v160) ((let l196 = p7 in v166)) (p4) ((v139 - 4)) ((p26 + 8)) (p82) (v166) ((v125 + 8)) ((if true then true else true)) ((p68 + 3)) (p16) ((v166 = p109)) ((v122 - 2)) ((v151 + 7)) ((p55 < p26)) ((if p13 then v126 else v157)) (p26) in
+let g199 = f173 ((82 + 0)) ((p101 - 4)) ((let l198 = v120 in v130)) ((if true then p109 else 84)) ((86 - 4)) ((p44 = v123)) ((1 - 7)) ((36 + 4)) ((if p29 then p21 else v130)) ((v114 - 3)) ((if v155 then v139 else v113)) ((if v145 then p21 else p40)) (38) ((p44 - 6)) ((not p40)) ((v134 - 9)) (7) (p77) ((p86 - 4)) ((p73 + 5)) in
+let c201 = g199 (v143) (v146) ((p44 + 8)) (p59) ((if false then p51 else 67)) (11) ((let l200 = b172 in v121)) ((24 - 9)) ((81 + 3)) (true) ((if p40 then 77 else p86)) ((p51 + 8)) ((81 < v136)) ((v161 - 3)) ((v142 + 1)) ((v160 <= p64)) ((52 - 9)) (p97) ((if true then p77 else p4)) ((p53 - 7)) (p7) ((false && p21)) ((v120 - 2)) ((v151 + 5)) ((if v148 then true else false)) ((p55 + 5)) ((p93 - 4)) ((33 <= v142)) ((v125 - 7)) ((p33 - 8)) in
+let g203 = f173 (17) (v113) ((not true)) ((v167 - 8)) ((if true then v119 else p64)) (v155) ((p68 - 9)) ((if v148 then v165 else 78)) ((v148 && p4)) (v146) ((60 - 8)) ((p40 && p77)) (v157) ((let l202 = v139 in v120)) ((v151 <> v126)) (p51) ((v126 - 4)) ((if v145 then v130 else p21)) ((v113 + 3)) (97) ((if true then v112 else b172)) ((75 + 6)) ((p64 - 0)) in
+let c204 = g203 ((v143 || false)) ((p9 - 2)) (27) (true) ((p2 - 6)) (v158) (true) ((if p4 then 68 else v122)) ((40 - 1)) ((74 <> p64)) ((p44 + 8)) ((v122 + 4)) (p13) ((p44 - 8)) (v125) ((97 = p57)) ((73 + 4)) ((v134 - 1)) ((not v143)) (v113) (p9) ((v145 = true)) ((v152 + 0)) (v119) ((true && true)) (43) (v123) in
+let g206 = f173 ((v161 - 4)) ((v152 + 9)) ((v114 <= v119)) (91) (v166) ((p21 && true)) ((if p4 then v122 else 7)) ((p9 - 6)) (b172) (p64) ((v122 - 1)) (false) (p23) ((if p59 then v144 else v135)) (p13) (86) ((let l205 = p16 in 4)) ((false && b172)) ((95 - 9)) ((p16 + 1)) ((p64 > 34)) ((if v118 then v146 else v126)) ((v166 + 9)) ((71 <> v146)) ((p23 - 2)) ((if p13 then 93 else 83)) ((28 >= v139)) ((p68 + 7)) ((p68 + 7)) (b172) ((84 + 2)) ((v119 + 1)) ((v149 || p59)) (v126) ((v136 - 9)) ((v144 <= v159)) ((v123 + 4)) ((p7 - 1)) ((65 > v154)) ((v167 + 8)) (16) (p13) ((89 + 8)) ((p93 + 1)) in
+let c207 = g206 ((not true)) (12) ((if v145 then p57 else 75)) ((p105 && p4)) ((p26 + 3)) ((p53 + 5)) in
+let g209 = f173 ((p86 + 4)) ((v120 + 6)) ((not v112)) (p53) ((68 + 5)) ((v114 < v157)) (v167) ((p107 + 3)) ((not true)) ((44 + 4)) ((65 - 1)) ((p55 > p101)) ((51 + 1)) ((v113 - 3)) ((v135 = 45)) (v157) (0) ((v114 <> p68)) ((94 + 8)) ((v125 + 2)) ((v145 && p88)) ((17 + 9)) ((if true then v135 else v166)) ((p101 <> v159)) ((p23 - 2)) (v119) ((v145 = true)) ((v119 + 6)) ((35 - 6)) ((v158 <= p44)) ((p86 + 0)) ((v144 - 1)) (p4) ((v123 - 6)) ((6 + 3)) ((if false then p59 else v130)) ((if true then 68 else p44)) ((let l208 = p55 in v122)) ((v165 <> v165)) in
+let c210 = g209 ((p7 - 1)) ((v122 + 8)) ((v125 > v166)) (p33) ((1 - 4)) ((p95 = v140)) (v158) (v125) (p40) (69) (v161) in
+let g213 = f173 ((let l211 = v146 in p44)) ((p57 - 8)) ((v165 >= p2)) (p53) ((22 - 6)) ((38 <= v165)) ((68 + 3)) (82) ((p2 <> v160)) ((21 - 0)) ((v165 + 5)) ((v143 = v148)) ((v123 + 8)) ((v159 + 9)) ((not p88)) (v114) ((v146 + 3)) ((v134 = v136)) ((if p46 then v142 else 82)) ((p64 - 8)) ((if v112 then false else v148)) ((v120 + 1)) ((p53 - 1)) ((v160 >= p33)) (v161) ((let l212 = v139 in p97)) ((v161 >= p97)) ((p57 + 2)) ((51 + 2)) ((not p82)) in
+let c215 = g213 ((let l214 = (85, 65) in v159)) ((p64 + 6)) (p59) ((44 - 2)) ((v120 - 9)) ((if true then false else p77)) (v125) ((39 + 6)) ((v158 <> v136)) ((p7 + 1)) (77) ((if v121 then false else p4)) ((p2 - 9)) ((v114 - 2)) (true) (12) (v122) ((if v148 then p88 else v155)) (p68) (p16) in
+let g216 = f173 ((55 - 1)) ((p75 - 3)) ((not p21)) ((92 + 3)) ((p2 + 5)) in
+let c219 = g216 (p82) ((10 - 2)) (v152) ((not v148)) ((p33 + 3)) ((26 + 7)) ((if p82 then v148 else true)) (23) (v120) ((if v143 then p4 else v112)) ((v154 + 8)) ((66 + 7)) ((v158 <= v144)) ((p51 + 1)) ((v136 + 6)) ((47 > 0)) (v139) ((v144 - 9)) ((p29 <> p13)) ((v144 - 5)) ((p7 - 1)) ((let l217 = 3 in true)) ((68 - 5)) ((v151 - 8)) ((let l218 = v167 in false)) ((11 - 9)) ((3 + 3)) (v124) (v165) ((v134 - 1)) ((not v124)) (v125) (p51) ((v157 < v144)) (93) ((v134 + 5)) ((v118 || p59)) ((v152 - 1)) (p107) ((if v124 then p40 else p105)) ((v146 + 6)) (v135) ((23 <= 65)) ((v114 + 9)) ((14 + 5)) in
+let g223 = f173 ((if true then v154 else p16)) ((v126 + 9)) ((true || p21)) (v161) ((86 + 3)) ((39 <= 14)) ((let l220 = 3 in v113)) ((p44 + 3)) ((not false)) ((p68 - 9)) ((v159 - 0)) (false) (v137) ((62 + 0)) ((57 <> v159)) ((p16 - 8)) ((92 - 0)) ((v124 && p13)) (0) (89) (((63, false, 73) = (33, false, 9))) ((p64 - 3)) ((let l221 = false in p75)) (true) ((98 + 5)) ((v119 + 6)) ((if v118 then false else v121)) ((v122 - 1)) ((v123 + 8)) ((v121 || false)) ((v165 - 1)) (p93) ((not true)) ((let l222 = 4 in 81)) (v113) ((p59 || false)) ((v159 - 5)) ((p68 - 9)) (p46) (p23) ((p93 - 2)) in
+let c225 = g223 ((not b172)) ((let l224 = v156 in v120)) ((v122 - 3)) ((not v148)) (40) (48) ((p109 <> p64)) ((v161 - 7)) ((82 - 6)) in
+let c230 = f173 (p7) ((let l226 = 57 in v137)) ((95 < p44)) ((p86 - 2)) ((37 + 4)) (v130) ((68 + 3)) ((v154 + 1)) ((let l227 = v145 in p46)) ((v137 - 8)) ((81 + 0)) ((v161 <= v139)) ((v136 - 5)) (v165) ((false <> true)) ((47 + 9)) ((v139 + 5)) ((let l228 = 53 in v145)) ((54 - 7)) (v113) (p21) (p75) (72) ((not true)) ((p75 + 5)) ((p2 - 9)) ((not p13)) ((23 - 8)) ((v137 - 0)) ((v119 = 86)) ((v154 - 8)) ((p2 - 8)) (true) ((if v155 then 71 else v136)) ((43 + 6)) ((v119 < 45)) ((if p13 then 70 else 85)) ((37 - 9)) ((b172 && p40)) ((47 + 3)) ((v135 - 1)) ((27 >= 51)) ((let l229 = v162 in v126)) ((v120 - 4)) ((not true)) ((p57 + 2)) ((v120 + 4)) (p59) ((p26 + 0)) (21) in
+(((let l231 = p16 in 30) - 6) + 8)
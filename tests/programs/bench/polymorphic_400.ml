@@ -0,0 +1,447 @@
+let id = \x -> x in
+let const = \x -> \y -> x in
+let pair = \x -> \y -> (x, y) in
+let twice = \f -> \x -> f (f x) in
+let compose = \f -> \g -> \x -> f (g x) in
+let flip = \f -> \x -> \y -> f y x in
+let h0 = compose id id in
+let p2 = flip const (((false, 63, false) = (true, 69, true))) (83) in
+let p4 = compose (\z3 -> not z3) (\z3 -> z3) ((p2 >= p2)) in
+let p7 = h0 ((let l5 = p4 in p2)) in
+let p9 = id (52) in
+let p11 = pair ((95, 88, false)) ((p9 + 0)) in
+let p13 = twice id ((p4 || p4)) in
+let p16 = twice id ((let l14 = (83, 30, 15) in p2)) in
+let p18 = twice id ((p4, p16, 72)) in
+let p21 = flip const ((let l19 = p16 in p13)) ((38 >= 91)) in
+let p23 = h0 (p2) in
+let h24 = compose h0 id in
+let p26 = twice (\z25 -> z25 + 1) ((16 - 2)) in
+let p29 = h0 (p4) in
+let p31 = flip pair ((p4, p29, 71)) ((if false then p13 else false)) in
+let p33 = flip const (p26) ((p16 + 8)) in
+let p35 = flip pair ((not p21)) (false) in
+let p37 = flip pair ((p21 && false)) ((97, 35, 56)) in
+let p40 = flip const (28) ((let l38 = p33 in p29)) in
+let p42 = pair ((22 <> 83)) (0) in
+let p44 = flip const ((p29, p13)) ((p7 - 4)) in
+let p46 = flip const ((p44 - 8)) (p4) in
+let h47 = compose h24 id in
+let p49 = pair ((36 + 9)) ((p16 + 9)) in
+let p51 = h24 ((61 + 0)) in
+let p53 = twice (\z52 -> z52 + 1) ((if p4 then p23 else p33)) in
+let p55 = twice id ((p9 - 1)) in
+let p57 = h0 ((p16 - 3)) in
+let p59 = twice id ((p55 >= p44)) in
+let p62 = pair ((let l60 = 52 in 76)) ((if p46 then 1 else p33)) in
+let p64 = twice (\z63 -> z63 + 1) ((99 + 9)) in
+let p66 = flip pair ((p44 - 6)) ((p55 - 1)) in
+let p68 = twice (\z67 -> z67 + 1) (39) in
+let h69 = compose h24 id in
+let p71 = flip pair ((not p13)) ((if p40 then p18 else p18)) in
+let p73 = flip const ((p9 <> 98)) ((p44 + 3)) in
+let p75 = twice (\z74 -> z74 + 1) (17) in
+let p77 = compose (\z76 -> not z76) (\z76 -> z76) ((let l78 = (32, 30, false) in p29)) in
+let p80 = flip pair ((88 > p68)) ((p44 > p68)) in
+let p82 = flip const (p2) ((false = p13)) in
+let p84 = pair ((p82, p40)) ((31, true, 42)) in
+let p86 = twice id (p51) in
+let p88 = id ((not p29)) in
+let p90 = h0 ((if p59 then (40, 76, 57) else (78, 49, 36))) in
+let h91 = compose h24 id in
+let p93 = twice (\z92 -> z92 + 1) (89) in
+let p95 = id (p35) in
+let p97 = flip const ((p93 - 1)) ((p44 + 0)) in
+let p99 = id ((p75, 71, p59)) in
+let p101 = const (20) (p64) in
+let p103 = flip const (p13) ((p68, false)) in
+let p105 = h24 (p82) in
+let p107 = h91 (p93) in
+let p109 = h24 ((97 + 7)) in
+let p111 = pair ((94, p13, false)) (p23) in
+let h112 = compose h0 id in
+let p114 = flip const ((p77, false, p88)) ((p68 + 3)) in
+let p116 = pair ((p23 + 9)) ((63, p53)) in
+let p118 = twice id (p80) in
+let p120 = id ((59 - 0)) in
+let p122 = twice id ((p33 - 1)) in
+let p124 = twice id (p33) in
+let p126 = id (p109) in
+let p128 = h47 ((p51 + 4)) in
+let p130 = flip const ((false, false)) ((false, p33, p16)) in
+let p132 = flip pair ((66 - 0)) ((2 - 6)) in
+let h133 = compose h24 id in
+let p136 = pair ((let l134 = p130 in 75)) ((true, p7, 52)) in
+let p138 = compose (\z137 -> not z137) (\z137 -> z137) (p40) in
+let p140 = twice id ((p73 + 1)) in
+let p142 = twice (\z141 -> z141 + 1) ((p16 + 1)) in
+let p144 = twice (\z143 -> z143 + 1) ((p97 - 6)) in
+let p147 = pair ((p122, p107, 45)) ((let l145 = (true, true) in p44)) in
+let p149 = twice (\z148 -> z148 + 1) (88) in
+let p151 = const ((p23 >= p2)) ((45 - 1)) in
+let p153 = flip pair (p86) (p13) in
+let p155 = pair ((p55 + 1)) ((false, p88)) in
+let h156 = compose h47 id in
+let p158 = h24 ((p126 - 8)) in
+let p160 = twice id ((5, true, 38)) in
+let p162 = flip pair ((88 >= p51)) ((p82, p77, p151)) in
+let p164 = h133 ((p13, p23)) in
+let p166 = const ((p21 && p29)) ((p97 - 6)) in
+let p168 = twice id (p77) in
+let p170 = pair ((false && false)) (true) in
+let p172 = id ((false, 25, p16)) in
+let p174 = h91 ((not false)) in
+let p176 = id (p107) in
+let h177 = compose h24 id in
+let p179 = twice id ((p176 + 6)) in
+let p181 = flip pair ((p57 + 3)) ((if p29 then p122 else p120)) in
+let p183 = pair ((p13 || p13)) (15) in
+let p185 = compose (\z184 -> not z184) (\z184 -> z184) (p151) in
+let p187 = pair (p26) (p144) in
+let p189 = pair ((86 - 6)) ((19 + 2)) in
+let p191 = compose (\z190 -> not z190) (\z190 -> z190) ((p9 < 36)) in
+let p193 = pair (p49) ((true || true)) in
+let p196 = compose (\z195 -> not z195) (\z195 -> z195) (((false, false, false) = (false, false, false))) in
+let p198 = id ((false && false)) in
+let h199 = compose h112 id in
+let p201 = const ((p120, p198, p101)) ((p57 - 4)) in
+let p203 = flip const ((p149 + 0)) (p118) in
+let p206 = h156 ((let l204 = (34, 93) in p105)) in
+let p208 = twice (\z207 -> z207 + 1) ((72 + 7)) in
+let p210 = const ((63 - 9)) ((p86 - 0)) in
+let p212 = id ((false || p77)) in
+let p214 = twice (\z213 -> z213 + 1) (p26) in
+let p216 = flip pair (95) ((if false then p103 else p103)) in
+let p218 = id ((p75 - 4)) in
+let p221 = id ((let l219 = (16, false, true) in false)) in
+let h222 = compose h133 id in
+let p224 = h24 ((if p105 then p149 else 39)) in
+let p226 = id ((if false then p210 else p124)) in
+let p228 = h222 ((p21, p208)) in
+let p230 = h156 (p212) in
+let p232 = twice (\z231 -> z231 + 1) ((p210 - 6)) in
+let p234 = id ((19 + 2)) in
+let p236 = twice (\z235 -> z235 + 1) (57) in
+let p238 = flip pair ((p196 && p105)) ((p140 + 4)) in
+let p240 = compose (\z239 -> not z239) (\z239 -> z239) ((let l241 = 13 in p151)) in
+let p243 = flip const ((p16 - 5)) ((p82, p185, p124)) in
+let h244 = compose h156 id in
+let p246 = twice (\z245 -> z245 + 1) (p214) in
+let p248 = flip const ((p77, false, p198)) ((p208 < p44)) in
+let p250 = flip pair (p107) ((if false then p88 else p59)) in
+let p252 = compose (\z251 -> not z251) (\z251 -> z251) ((57 >= 41)) in
+let p254 = flip const ((60, p179, true)) ((if true then p187 else p132)) in
+let p256 = pair ((p73 + 5)) ((if p151 then p44 else 2)) in
+let p259 = compose (\z258 -> not z258) (\z258 -> z258) (p13) in
+let p261 = twice (\z260 -> z260 + 1) ((20 + 4)) in
+let p263 = compose (\z262 -> not z262) (\z262 -> z262) ((not true)) in
+let p265 = const (p206) ((75, p46)) in
+let h266 = compose h91 id in
+let p269 = twice id ((let l267 = p261 in p138)) in
+let p271 = pair ((p210 - 7)) ((p64 + 9)) in
+let p273 = twice id (p99) in
+let p275 = compose (\z274 -> not z274) (\z274 -> z274) (false) in
+let p277 = flip const ((48 - 8)) ((29, p191, p208)) in
+let p279 = compose (\z278 -> not z278) (\z278 -> z278) (false) in
+let p281 = pair (p93) ((20 - 6)) in
+let p283 = flip pair ((3 <> 80)) ((90 + 3)) in
+let p285 = pair ((71 - 2)) ((if p77 then p118 else p35)) in
+let p288 = h133 ((9 - 1)) in
+let h289 = compose h112 id in
+let p291 = pair ((if p138 then p226 else p114)) ((p122 - 0)) in
+let p293 = id ((p232 - 7)) in
+let p295 = pair ((p176, true)) ((p59, true, false)) in
+let p297 = const ((p246 >= p33)) ((p44 + 3)) in
+let p299 = h24 ((p126 + 7)) in
+let p301 = flip pair ((p261 - 8)) ((p252, false, p13)) in
+let p303 = twice (\z302 -> z302 + 1) ((63 - 7)) in
+let p306 = flip pair ((let l304 = p124 in 86)) (88) in
+let p308 = const ((88 - 4)) ((85 < 90)) in
+let p310 = compose (\z309 -> not z309) (\z309 -> z309) ((p82 = p269)) in
+let h311 = compose h69 id in
+let p313 = pair ((p138 || true)) ((p51 + 7)) in
+let p315 = h0 (p158) in
+let p317 = flip pair ((if p269 then 89 else p75)) (false) in
+let p319 = compose (\z318 -> not z318) (\z318 -> z318) ((not p310)) in
+let p321 = flip const ((not true)) (p160) in
+let p324 = flip pair ((p107 + 5)) ((let l322 = 84 in p130)) in
+let p326 = id ((p246 - 4)) in
+let p328 = flip const ((p149 + 3)) ((p68 + 3)) in
+let p330 = const ((50 - 8)) ((p88, p166, p224)) in
+let p332 = pair (81) ((p138, 48)) in
+let h333 = compose h199 id in
+let p335 = flip const (p140) ((49 < 9)) in
+let p337 = flip const ((false, p196, p288)) ((3 >= p86)) in
+let p339 = twice id ((p326 + 3)) in
+let p341 = pair ((51 - 9)) (p208) in
+let p343 = flip pair ((p232 - 6)) ((p326 + 0)) in
+let p345 = const ((p53 - 5)) ((67 - 8)) in
+let p347 = pair ((p261 - 2)) ((p218 >= 73)) in
+let p349 = twice (\z348 -> z348 + 1) ((p234 - 4)) in
+let p351 = const ((p16 >= 6)) ((p236 + 9)) in
+let p353 = pair ((if p335 then p347 else p347)) ((p109 - 7)) in
+let h354 = compose h133 id in
+let p356 = id ((70 - 0)) in
+let p359 = flip pair (p230) ((let l357 = p7 in (true, false, 28))) in
+let p361 = compose (\z360 -> not z360) (\z360 -> z360) ((if false then p297 else p319)) in
+let p363 = compose (\z362 -> not z362) (\z362 -> z362) ((false = p82)) in
+let p365 = h244 ((p303 - 6)) in
+let p367 = pair ((false && p351)) ((p299 = p234)) in
+let p369 = flip const ((p234 - 4)) ((69 + 3)) in
+let p372 = flip pair ((32 - 6)) ((let l370 = p367 in (true, true))) in
+let p374 = flip pair ((p335, 52, 16)) (p75) in
+let p376 = pair ((p206 && false)) ((not true)) in
+let h377 = compose h311 id in
+let p379 = twice id ((true, 35, false)) in
+let p381 = flip pair ((p326 - 4)) (p256) in
+let p383 = twice id ((p288 - 4)) in
+let p385 = flip pair ((70 + 9)) ((45 - 1)) in
+let p387 = twice id ((p226 - 9)) in
+let p389 = twice id ((9 + 3)) in
+let p391 = twice (\z390 -> z390 + 1) ((if p174 then p293 else 51)) in
+let p393 = twice id ((p128 + 8)) in
+let p395 = flip const (p2) ((p73 + 2)) in
+let p398 = flip const ((let l396 = p210 in p73)) ((if p198 then p151 else true)) in
+let h399 = compose h69 id in
+let p401 = flip const (p319) ((p44 - 8)) in
+let p403 = h199 ((p64 - 6)) in
+let p406 = const (p379) ((let l404 = p361 in false)) in
+let p409 = h199 ((p9 = p179)) in
+let p412 = twice (\z411 -> z411 + 1) (p224) in
+let p414 = pair ((p299 - 1)) ((35 > p140)) in
+let p417 = const ((let l415 = p55 in false)) ((p365 + 6)) in
+let p419 = twice id ((if p363 then (false, true, true) else (false, true, true))) in
+let p421 = flip pair ((82 + 0)) ((p101 > 32)) in
+let p423 = h112 ((29 + 9)) in
+let h424 = compose h399 id in
+let p426 = id ((p26 + 7)) in
+let p428 = compose (\z427 -> not z427) (\z427 -> z427) ((let l429 = false in true)) in
+let p431 = flip const (p168) ((p196 = p351)) in
+let p433 = h0 (p351) in
+let p435 = flip const ((if true then p395 else p16)) (p144) in
+let p437 = h399 ((p259 && p206)) in
+let p439 = flip pair ((false = false)) ((11 - 2)) in
+let p441 = twice id ((43 - 4)) in
+let p443 = id ((if p191 then p299 else 77)) in
+let p445 = twice (\z444 -> z444 + 1) ((53 + 8)) in
+let h446 = compose h222 id in
+let p448 = twice (\z447 -> z447 + 1) (p210) in
+let p450 = pair ((p44 + 8)) ((p356 - 7)) in
+let p452 = pair (p151) ((p57, 92, p93)) in
+let p454 = twice id (true) in
+let p457 = twice id ((let l455 = p73 in p189)) in
+let p459 = h47 ((p303 - 7)) in
+let p461 = h289 (p128) in
+let p463 = twice id ((if true then p299 else p459)) in
+let p465 = twice (\z464 -> z464 + 1) ((48 + 0)) in
+let p467 = flip const (43) ((80 <> p308)) in
+let h468 = compose h91 id in
+let p470 = const ((10 - 8)) (p248) in
+let p472 = flip const ((p75 - 6)) ((if p297 then p470 else 34)) in
+let p474 = id (p365) in
+let p476 = flip const ((p435 - 9)) (true) in
+let p478 = h266 ((p40, p107)) in
+let p480 = id ((p64 - 7)) in
+let p482 = id ((p349, p393, p59)) in
+let p484 = h91 ((p107 - 1)) in
+let p486 = flip const ((p118 <> (true, false))) ((if p168 then p421 else p250)) in
+let p488 = const ((p144, false, p297)) ((p445 + 2)) in
+let h489 = compose h446 id in
+let p491 = flip pair ((p114 = p474)) ((if p240 then p218 else p226)) in
+let p493 = const ((true && true)) (43) in
+let p495 = h69 ((63 - 7)) in
+let p497 = flip const ((p2 <= 91)) (p101) in
+let p499 = const ((if true then 2 else p246)) (89) in
+let p501 = pair (p243) ((p465, p261)) in
+let p503 = flip pair (p90) ((p349 + 5)) in
+let p505 = const ((p168 || p252)) (70) in
+let p507 = h333 ((p435 - 5)) in
+let p509 = compose (\z508 -> not z508) (\z508 -> z508) ((p319 && p265)) in
+let h510 = compose h399 id in
+let p512 = const ((p474 - 2)) ((if p275 then (93, 94, false) else (29, 73, true))) in
+let p515 = flip pair ((let l513 = p345 in p226)) ((true, 51)) in
+let p517 = twice id ((p149, p509, p196)) in
+let p519 = twice (\z518 -> z518 + 1) (p365) in
+let p521 = twice id ((p86 - 9)) in
+let p523 = const ((not p279)) ((p124 + 8)) in
+let p525 = flip pair ((89, p196)) ((p73 + 1)) in
+let p527 = compose (\z526 -> not z526) (\z526 -> z526) ((let l528 = 31 in p319)) in
+let p530 = twice id ((p126 - 9)) in
+let p532 = const ((p236 < p365)) ((p68, p252, p474)) in
+let h533 = compose h177 id in
+let p535 = twice (\z534 -> z534 + 1) ((11 + 7)) in
+let p537 = compose (\z536 -> not z536) (\z536 -> z536) ((p261 = 45)) in
+let p540 = compose (\z539 -> not z539) (\z539 -> z539) (false) in
+let p542 = flip const (p401) ((p433 && p437)) in
+let p544 = twice (\z543 -> z543 + 1) (p293) in
+let p546 = h91 ((p120 - 5)) in
+let p548 = twice id (p488) in
+let p550 = const (p387) (p243) in
+let p552 = flip const ((false <> true)) ((if p230 then (true, false, false) else p419)) in
+let p554 = const (4) ((p44 - 7)) in
+let h555 = compose h424 id in
+let p558 = id ((p426 + 9)) in
+let p560 = h133 ((true, true)) in
+let p562 = twice id ((24, p512, p144)) in
+let p564 = pair (5) ((p523 || p523)) in
+let p566 = twice (\z565 -> z565 + 1) ((p53 + 1)) in
+let p568 = const ((not true)) ((36 - 8)) in
+let p570 = h446 ((68 + 3)) in
+let p572 = twice (\z571 -> z571 + 1) ((let l573 = p308 in p495)) in
+let p575 = compose (\z574 -> not z574) (\z574 -> z574) (p13) in
+let p577 = h424 (p426) in
+let h578 = compose h399 id in
+let p580 = flip pair (p310) ((p339 + 4)) in
+let p582 = id (p339) in
+let p584 = twice (\z583 -> z583 + 1) ((p495 + 3)) in
+let p586 = twice id ((p86 >= p387)) in
+let p588 = compose (\z587 -> not z587) (\z587 -> z587) ((p495 > 95)) in
+let p590 = twice (\z589 -> z589 + 1) ((67 + 3)) in
+let p592 = id (false) in
+let p594 = twice (\z593 -> z593 + 1) ((if p540 then 99 else p448)) in
+let p596 = twice id (p499) in
+let p598 = flip const (p279) ((if p265 then p406 else p379)) in
+let h599 = compose h222 id in
+let p601 = flip pair ((p212, p51, p349)) ((p265, p393, 33)) in
+let p603 = twice (\z602 -> z602 + 1) (p383) in
+let p605 = h354 ((52, true)) in
+let p608 = compose (\z607 -> not z607) (\z607 -> z607) ((p263 && p252)) in
+let p610 = compose (\z609 -> not z609) (\z609 -> z609) ((p126 <= 60)) in
+let p612 = flip const (p590) ((47 + 0)) in
+let p614 = flip pair ((36 - 7)) ((p33 - 7)) in
+let p616 = twice (\z615 -> z615 + 1) (76) in
+let p618 = h578 ((p226 + 6)) in
+let p621 = flip const ((3, p16, p198)) ((let l619 = p59 in p558)) in
+let h622 = compose h156 id in
+let p624 = flip pair ((if p46 then p236 else p232)) (19) in
+let p626 = id ((p179 <= p596)) in
+let p628 = flip const (true) ((false, p495)) in
+let p630 = flip const (p590) ((p461 + 2)) in
+let p632 = twice (\z631 -> z631 + 1) ((p480 - 7)) in
+let p634 = h156 (43) in
+let p636 = compose (\z635 -> not z635) (\z635 -> z635) ((not true)) in
+let p638 = flip pair (39) (14) in
+let p640 = flip pair ((if p206 then p279 else p105)) (p365) in
+let p642 = pair ((p261, p435, 0)) (66) in
+let h643 = compose h289 id in
+let p645 = pair ((not p185)) ((p64 - 7)) in
+let p647 = const ((p326 - 8)) (((false, true) <> p367)) in
+let p649 = compose (\z648 -> not z648) (\z648 -> z648) ((not p509)) in
+let p652 = flip const (p130) ((let l650 = p319 in p521)) in
+let p654 = id ((if p77 then (34, 3) else p341)) in
+let p656 = flip const (p596) ((p369 + 3)) in
+let p658 = compose (\z657 -> not z657) (\z657 -> z657) ((if p527 then p467 else p319)) in
+let p660 = twice (\z659 -> z659 + 1) ((5 + 9)) in
+let p662 = const ((37, p426, false)) ((28 + 3)) in
+let p664 = compose (\z663 -> not z663) (\z663 -> z663) ((not p248)) in
+let h665 = compose h199 id in
+let p667 = twice (\z666 -> z666 + 1) ((74 - 8)) in
+let p670 = id (p310) in
+let p672 = flip pair ((p315 - 2)) ((true, p664, p326)) in
+let p674 = const ((p649 && p279)) ((30 + 4)) in
+let p676 = flip const ((p594 + 7)) (p120) in
+let p678 = twice (\z677 -> z677 + 1) ((p176 + 8)) in
+let p680 = flip pair ((34, p168, p656)) (p457) in
+let p682 = h289 ((p49 <> p450)) in
+let p684 = flip pair ((if p185 then 45 else p365)) ((p101 - 0)) in
+let p686 = id ((38 < p507)) in
+let h687 = compose h91 id in
+let p689 = twice id ((p499 < 28)) in
+let p691 = const ((if p509 then 71 else p461)) ((true && false)) in
+let p693 = flip pair ((p64 + 0)) ((93 - 5)) in
+let p695 = id ((67 - 3)) in
+let p697 = compose (\z696 -> not z696) (\z696 -> z696) ((not p575)) in
+let p699 = flip const ((p328 - 6)) ((p610 <> p505)) in
+let p701 = flip const (p16) ((if true then 16 else p218)) in
+let p703 = id ((6 - 1)) in
+let p705 = id ((if p649 then 35 else p512)) in
+let p707 = flip const (p68) ((41 - 6)) in
+let h708 = compose h599 id in
+let p710 = id ((p26 <> p667)) in
+let p712 = flip const ((p499 + 0)) ((p293 - 0)) in
+let p714 = flip pair ((p198, p697)) ((20 = p530)) in
+let p717 = twice (\z716 -> z716 + 1) (p577) in
+let p719 = id ((p566 + 8)) in
+let p721 = h112 (p491) in
+let p724 = flip pair (p363) ((let l722 = p44 in p243)) in
+let p726 = flip const ((58 - 0)) ((30 + 9)) in
+let p729 = compose (\z728 -> not z728) (\z728 -> z728) ((12 >= p403)) in
+let p732 = const ((let l730 = p389 in false)) ((p507, p77, true)) in
+let h733 = compose h199 id in
+let p735 = id ((p719 <= p499)) in
+let p737 = pair (p361) ((p530 + 9)) in
+let p739 = twice id (p118) in
+let p741 = flip const ((false, p621, p330)) ((p568 && p259)) in
+let p744 = flip const ((55, p697)) ((let l742 = p552 in p16)) in
+let p746 = compose (\z745 -> not z745) (\z745 -> z745) ((if p335 then true else false)) in
+let p748 = h177 ((p505 && p664)) in
+let p750 = flip const ((p179 > p676)) ((p75 - 7)) in
+let p752 = twice id (p238) in
+let p754 = const (p277) ((true || false)) in
+let h755 = compose h377 id in
+let p757 = const (p228) ((p505, false, p554)) in
+let p759 = twice (\z758 -> z758 + 1) (53) in
+let p762 = h599 ((let l760 = p395 in p398)) in
+let p765 = pair ((let l763 = p208 in 93)) ((not true)) in
+let p767 = h354 ((p719 - 2)) in
+let p769 = id ((p53 - 9)) in
+let p771 = h446 ((p445 + 7)) in
+let p774 = compose (\z773 -> not z773) (\z773 -> z773) ((let l775 = p762 in p319)) in
+let p777 = compose (\z776 -> not z776) (\z776 -> z776) ((true = false)) in
+let p779 = const ((p459 - 2)) ((39 + 1)) in
+let h780 = compose h708 id in
+let p782 = h112 ((false, p423)) in
+let p784 = twice id ((31, 63, 45)) in
+let p786 = flip pair ((p507 - 8)) ((not true)) in
+let p788 = h0 ((if p505 then p395 else p701)) in
+let p790 = h354 ((40, true, p198)) in
+let p792 = twice id (p310) in
+let p795 = flip pair ((p463 + 5)) ((let l793 = (false, true) in p196)) in
+let p797 = twice (\z796 -> z796 + 1) ((p142 + 5)) in
+let p799 = h0 ((p246 + 3)) in
+let p802 = flip const (p717) ((let l800 = p149 in p232)) in
+let h803 = compose h578 id in
+let p805 = compose (\z804 -> not z804) (\z804 -> z804) ((97 = p519)) in
+let p807 = id ((70 <= p210)) in
+let p810 = twice id ((let l808 = p126 in (70, 57, false))) in
+let p812 = flip pair (p130) ((true, 96)) in
+let p814 = flip pair ((p128, p122, p616)) (p293) in
+let p816 = twice (\z815 -> z815 + 1) (p330) in
+let p818 = pair ((p603 + 7)) ((p767, p542)) in
+let p820 = id (p802) in
+let p822 = twice (\z821 -> z821 + 1) (p816) in
+let p824 = twice (\z823 -> z823 + 1) ((p769 + 7)) in
+let h825 = compose h803 id in
+let p827 = pair ((not p248)) ((54 + 3)) in
+let p829 = const ((28 + 7)) ((38, p16)) in
+let p831 = compose (\z830 -> not z830) (\z830 -> z830) ((p426 <= p499)) in
+let p833 = twice id ((p126 + 3)) in
+let p835 = twice (\z834 -> z834 + 1) ((74 - 1)) in
+let p837 = flip const ((p73, p265)) (45) in
+let p839 = twice id (p187) in
+let p841 = pair ((p822, p572, false)) ((if true then p412 else 43)) in
+let p844 = twice (\z843 -> z843 + 1) ((p339 - 4)) in
+let p846 = twice (\z845 -> z845 + 1) (50) in
+let h847 = compose h47 id in
+let p849 = id ((p699 && p746)) in
+let p851 = id ((p73 + 1)) in
+let p853 = compose (\z852 -> not z852) (\z852 -> z852) (false) in
+let p855 = const ((p57 - 7)) ((p299 + 3)) in
+let p857 = compose (\z856 -> not z856) (\z856 -> z856) (p689) in
+let p859 = flip pair ((23 + 0)) (p586) in
+let p861 = twice (\z860 -> z860 + 1) ((14 - 7)) in
+let p864 = twice id ((if p588 then p109 else p365)) in
+let p867 = compose (\z866 -> not z866) (\z866 -> z866) ((19 < 79)) in
+let p869 = flip pair ((p682, p590, p252)) ((p846 + 4)) in
+let h870 = compose h311 id in
+let p872 = flip const ((p744 - 8)) (p369) in
+let p874 = id (p293) in
+let p876 = const (p523) (p158) in
+let p878 = flip const ((if p729 then p548 else p548)) ((false, false)) in
+let p881 = h870 ((87 - 3)) in
+let p883 = twice id (p236) in
+let p885 = pair (76) ((false, p46)) in
+let p887 = id ((2 - 1)) in
+let p889 = id ((21 - 8)) in
+let p891 = flip const ((p566 - 6)) ((p472 + 5)) in
+(((if p732 then 75 else 83) + 8) + 2)
@@ -0,0 +1,6 @@
+let w0 = (let l1 = 67 in (true, 62, true, 33, (true, 90, false), false, 19, 26, 80, 1, (86, true, 11), true, (false, 89, 96), (28, true, true), 81, 43, 61, true, 21, true, 34, (false, true, false), false, 24, (40, 5), (56, false), true, 90, true, 9, 94, 91, 36, 62, (true, true, 38), 90, (true, false, false), 31, 15, 56, 99, 19, 8, 83, 86, 38, (94, 65, false), 81, false, 68, (66, 82), 57, true, 77, true, (true, 91), (true, false, 68), false, 2, 98, 20, true, 41, 41, 38, 12, false, 80, 7, (36, 1), 28, 51, 76, 29, (58, false), (74, 87, true), (true, 76, 18), true, true, (true, 9, 78), (true, 67), (false, true), true, (8, true), 73, (true, true), 7, false, 36, 3, 34, false, 41, 17, 33, 80, true, 99, (false, true, false), false, 83, false, true, (37, false, false), 45, 62, false, 94, 98, 96, 82, 55, 13, 60, (80, true, 98), true, 77, false, false, true, 70, false, 22, 61, false, (true, 30, 81), 7, 8, 80, (false, true), 93, false, 7, 69, false, 62, (true, true), 83, (19, 18, true), 33, 83, 96, 51, (false, 52), 73, false, 39, 38, false, 24, 22, 79, (false, false, 91), (false, true, false), 84, 85, true, (2, 18, 50), (true, true, 99), (41, false, 88), 48, 96, (true, 49), (11, true), 85, 66, 97, 59, 55, 40, false, 19, (77, true), false, (85, 42), (24, true), true, true, false, 41, (2, false), false, 52, 23, false, 66, 76, 77, true, 58, 48, true, 34, 31, false, (true, 67), 22, 74, false, 20, 61, 89, (58, false), 55, 18, (true, 85, false), (true, 29, false), 14, (34, true, 63), 45, 25, 79, false, (false, 6), 41, true, 94, false, 2, (78, 5, false), 27, 99, 97, true, false, 99, 62, 96, 94, 95, (47, true), 93, (false, true, 78), 61, (68, false), 87, 71, 84, (true, 14, 45), (false, 41, 53), (50, true), (true, 71), (false, false), 20, 31, 41, false, (true, false, 16), false, 65, 17, false, 13, 26, (false, true), 57, true, 80, false, (false, true, 93), (false, 25), (99, false, 43), 70, (false, 23, 23), 61, 82, 52, false, true, (61, 75, true), 5, false, 2, 99, 60, (1, 92, true), 69, 11, 46, false, false, 40, (true, false), true, (true, 5, 31), 81, 32, false, false, 28, (56, 42), 69, 87, false, (true, 75, 88), 76, (77, true), true, true, 70, 82, true, 54, (false, 88), 81, 73, 91, 92, false, (false, 69), 93, 60, 34, 33, (2, 95), 43, (41, true), 76, 74, 76, false, 30, (40, true), (false, false, false), 49, 71, (false, 82, false), true, 33, 88, 78, (true, 95, 71), 1, (27, 59, true), 56, false, false, (75, false), false, 88, true, 58, (16, 96), (true, 58, true), false, 39, 16, 9, false, false, false, false, 58, 5, true, 29, 39, true, false, 76, (true, true, false), (31, true, 5), 24, 13, 95, false, true, 56, 85, 27, 54, 16, false, false, 88, 79, false, 73, true, 85, 1, (true, 77), (true, 11, false), (true, true, true), 54, (true, false, 88), (28, 92, 46), 42, 40, (false, false, 2), false, 26, 60, 75, 60, 18, true, 78, false, 47)) in
+let w2 = (true, 78, false, 10, (false, 53, false), false, 53, 61, 89, 73, (87, true, 83), true, (true, 94, 36), (61, true, false), 80, 90, 15, false, 70, true, 8, (true, false, false), false, 20, (65, 66), (4, false), true, 52, true, 73, 0, 43, 12, 85, (true, false, 96), 0, (false, false, true), 17, 5, 60, 17, 88, 73, 24, 66, 90, (34, 88, false), 79, false, 57, (33, 29), 27, false, 74, false, (true, 68), (true, true, 36), false, 72, 16, 54, false, 10, 46, 65, 77, false, 65, 97, (61, 55), 46, 93, 16, 38, (57, false), (76, 34, false), (true, 63, 57), true, true, (true, 98, 95), (false, 31), (true, true), true, (14, false), 85, (false, false), 27, false, 0, 70, 6, false, 79, 63, 4, 75, true, 36, (false, false, false), false, 71, true, false, (57, false, true), 73, 97, false, 32, 65, 35, 58, 20, 36, 62, (61, true, 1), true, 65, true, false, true, 89, true, 33, 0, true, (true, 33, 60), 70, 8, 46, (false, false), 76, false, 98, 0, false, 73, (false, false), 51, (80, 78, false), 78, 49, 95, 5, (false, 51), 42, false, 80, 39, false, 58, 39, 79, (true, true, 31), (false, true, true), 56, 34, true, (91, 41, 0), (true, false, 50), (27, false, 12), 38, 45, (true, 93), (30, false), 43, 32, 65, 70, 99, 93, true, 41, (2, true), true, (39, 63), (72, true), false, true, false, 60, (61, false), true, 90, 28, true, 51, 66, 97, false, 80, 65, true, 83, 83, false, (true, 19), 79, 20, false, 83, 95, 44, (70, true), 7, 81, (false, 40, false), (true, 92, false), 3, (50, true, 64), 72, 53, 58, false, (false, 14), 97, true, 32, true, 99, (29, 16, false), 9, 28, 16, true, false, 92, 38, 22, 9, 16, (29, true), 24, (true, false, 80), 60, (82, false), 81, 67, 71, (true, 95, 86), (true, 42, 65), (41, true), (false, 56), (false, true), 48, 24, 64, true, (false, true, 56), false, 66, 16, true, 43, 10, (true, true), 79, false, 76, false, (false, false, 38), (false, 53), (1, true, 41), 54, (true, 39, 83), 47, 60, 74, true, true, (7, 11, true), 34, true, 19, 71, 40, (25, 20, true), 6, 14, 71, true, true, 30, (true, true), false, (true, 92, 27), 42, 97, true, false, 27, (12, 82), 41, 34, true, (false, 13, 3), 60, (75, true), false, true, 71, 95, false, 8, (true, 3), 46, 3, 77, 57, true, (false, 1), 81, 73, 10, 45, (85, 84), 92, (35, false), 7, 60, 69, true, 50, (49, false), (true, true, true), 45, 3, (false, 49, true), false, 51, 17, 24, (true, 17, 18), 34, (57, 15, false), 82, true, false, (88, true), false, 96, true, 78, (81, 4), (true, 26, true), true, 15, 27, 60, true, false, true, false, 98, 0, false, 97, 53, true, false, 0, (false, true, true), (61, false, 3), 0, 20, 89, true, false, 22, 66, 66, 21, 33, false, false, 44, 85, false, 64, false, 89, 41, (false, 20), (true, 19, true), (false, false, false), 91, (true, false, 12), (30, 22, 58), 71, 97, (false, true, 49), true, 40, 26, 13, 5, 17, false, 38, true, 2) in
+let w3 = (false, 42, true, 50, (true, 34, false), false, 97, 98, 20, 84, (63, true, 19), false, (false, 56, 30), (37, false, false), 10, 86, 47, true, 18, true, 96, (false, true, false), false, 78, (48, 87), (35, false), true, 17, true, 60, 49, 46, 25, 71, (true, false, 61), 62, (false, false, false), 22, 97, 58, 20, 46, 24, 31, 59, 3, (78, 80, true), 94, true, 52, (96, 32), 52, true, 71, false, (true, 19), (false, false, 60), true, 15, 92, 9, false, 14, 72, 64, 51, false, 15, 2, (95, 47), 18, 97, 65, 99, (22, false), (37, 87, true), (false, 17, 83), true, false, (true, 2, 51), (true, 15), (false, false), false, (67, true), 97, (true, false), 58, false, 79, 73, 77, true, 24, 15, 91, 56, true, 85, (false, false, false), false, 97, true, false, (61, false, true), 16, 27, true, 58, 70, 68, 84, 65, 88, 70, (1, true, 81), true, 58, true, true, true, 81, true, 76, 96, false, (true, 16, 68), 75, 86, 77, (false, true), 53, false, 50, 92, false, 80, (false, false), 16, (69, 47, false), 5, 80, 20, 3, (true, 91), 32, false, 21, 53, false, 80, 36, 83, (false, true, 26), (true, false, true), 98, 32, true, (61, 56, 60), (true, false, 95), (47, false, 64), 17, 89, (false, 10), (89, true), 18, 60, 22, 76, 7, 7, false, 79, (82, false), true, (52, 12), (66, false), true, false, true, 73, (86, false), true, 13, 46, true, 27, 65, 51, true, 43, 11, false, 68, 71, false, (true, 56), 64, 60, true, 92, 9, 82, (16, true), 73, 89, (true, 15, false), (false, 81, true), 20, (38, false, 94), 93, 83, 29, true, (true, 91), 60, false, 13, false, 78, (0, 67, false), 30, 11, 6, false, true, 49, 90, 12, 85, 34, (36, true), 96, (true, false, 44), 28, (71, true), 20, 52, 41, (false, 36, 92), (true, 42, 90), (15, false), (true, 74), (false, true), 51, 39, 57, true, (false, false, 23), false, 86, 39, true, 70, 71, (false, true), 29, false, 65, false, (true, false, 55), (false, 69), (60, false, 62), 40, (true, 23, 74), 75, 22, 52, true, false, (70, 58, false), 95, true, 48, 59, 27, (6, 69, false), 19, 79, 88, false, false, 4, (false, false), false, (false, 34, 61), 76, 55, true, false, 83, (71, 90), 27, 86, false, (true, 44, 51), 41, (44, true), false, false, 68, 34, false, 38, (false, 48), 10, 29, 89, 73, true, (false, 72), 15, 45, 16, 69, (83, 99), 55, (10, true), 93, 6, 91, true, 21, (26, true), (true, false, true), 59, 76, (true, 76, true), false, 32, 77, 89, (true, 33, 99), 54, (67, 8, true), 2, false, false, (44, false), false, 61, false, 13, (61, 94), (false, 94, false), false, 75, 32, 99, true, true, false, true, 87, 88, true, 83, 57, false, false, 4, (true, true, true), (81, false, 55), 17, 65, 85, true, true, 87, 83, 25, 55, 35, false, true, 46, 85, false, 89, false, 47, 55, (true, 65), (false, 17, false), (false, false, false), 88, (true, false, 4), (98, 33, 95), 79, 69, (false, false, 48), false, 18, 60, 79, 71, 53, true, 42, false, 9) in
+let w4 = (w0, w2) in
+let b5 = ((w0 = w2) || (w2 <> w3)) in
+(if ((b5 || b5) || (not b5)) then ((let l6 = (true, 54, 45) in 47) + 6) else 45)
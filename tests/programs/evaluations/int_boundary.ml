@@ -0,0 +1 @@
+let x = 4611686018427387903 in (x + 1, 3037000500 * 3037000500, (0 - x - 1) / (0 - 1))    (* Value: (-4611686018427387904, 145474192, -4611686018427387904) *)
\ No newline at end of file
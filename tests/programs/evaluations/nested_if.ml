@@ -0,0 +1 @@
+if false then (if true then 1 else 2) else 3          (* Value: 3 *)
\ No newline at end of file
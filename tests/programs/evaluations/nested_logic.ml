@@ -0,0 +1 @@
+if 1 < 2 && (3 = 3 || false) then (1,2) else (3,4)    (* Value: (1, 2) *)
\ No newline at end of file
@@ -0,0 +1 @@
+\y -> (y, y + 1)          (* Value: <fun>, Type: Int -> (Int, Int) *)
\ No newline at end of file
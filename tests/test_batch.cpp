@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "driver/Batch.hpp"
+
+using namespace miniml;
+
+namespace fs = std::filesystem;
+
+static fs::path scratch() {
+    auto dir = fs::temp_directory_path() / "miniml_batch_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+}
+
+static std::string write(const fs::path& dir, const std::string& name, const std::string& code) {
+    auto p = dir / name;
+    std::ofstream(p) << code;
+    return p.string();
+}
+
+TEST(Batch, ResultsComeInFileOrder) {
+    auto dir = scratch();
+    std::vector<std::string> paths;
+    for (int i = 0; i < 60; ++i) {
+        std::string code;
+        switch (i % 4) {
+            case 0: code = "let twice = \\f -> \\x -> f (f x) in twice (\\n -> n + " + std::to_string(i) + ") 0"; break;
+            case 1: code = "(" + std::to_string(i) + ", true)"; break;
+            case 2: code = "if 1 then true else false"; break;
+            case 3: code = "let x = 1 in let x = x + " + std::to_string(i) + " in x"; break;
+        }
+        paths.push_back(write(dir, std::to_string(i) + ".ml", code));
+    }
+    paths.push_back((dir / "missing.ml").string());
+
+    Pipeline pipeline;
+    auto one = runBatch(pipeline, paths, 1);
+    auto four = runBatch(pipeline, paths, 4);
+    ASSERT_EQ(four.size(), paths.size());
+    EXPECT_EQ(batchOutput(four), batchOutput(one));
+
+    EXPECT_EQ(four[0].result.value, "0");
+    EXPECT_EQ(four[4].result.value, "8");
+    EXPECT_EQ(four[5].result.value, "(5, true)");
+    EXPECT_EQ(four[6].result.status, RunResult::Status::TypeError);
+    EXPECT_EQ(four[7].result.value, "8");
+    ASSERT_EQ(four[7].result.warnings.size(), 1u);
+    EXPECT_NE(four[7].result.warnings[0].find("shadowing 'x'"), std::string::npos);
+    EXPECT_EQ(four.back().result.status, RunResult::Status::ReadError);
+    EXPECT_GT(four[0].wallMs, 0);
+    EXPECT_FALSE(four[0].phases.phases().empty());
+
+    auto summary = batchSummary(four, 4, 1.0);
+    EXPECT_NE(summary.find("files: 61, ok: 45, failed: 16 (read_error: 1, type_error: 15)"), std::string::npos)
+        << summary;
+    fs::remove_all(dir);
+}
+
+TEST(Batch, ManifestPathsAreRelativeToIt) {
+    auto dir = scratch();
+    fs::create_directories(dir / "sub");
+    write(dir / "sub", "a.ml", "1");
+    auto manifest = write(dir, "list.txt", "# nightly\n\n  sub/a.ml  \n/abs/b.ml\n");
+
+    auto paths = readManifest(manifest);
+    ASSERT_EQ(paths.size(), 2u);
+    EXPECT_EQ(paths[0], (dir / "sub" / "a.ml").string());
+    EXPECT_EQ(paths[1], "/abs/b.ml");
+    EXPECT_THROW(readManifest((dir / "none.txt").string()), std::runtime_error);
+    fs::remove_all(dir);
+}
+
+TEST(Batch, TypesPrintTheSameForAnyJobs) {
+    auto dir = scratch();
+    std::vector<std::string> paths;
+    for (int i = 0; i < 40; ++i) {
+        std::string code = i % 2 ? "\\x -> \\y -> (y, x, " + std::to_string(i) + ")"
+                                  : "let id = \\x -> x in let k = \\a -> \\b -> a in (k id, k " + std::to_string(i) + ")";
+        paths.push_back(write(dir, std::to_string(i) + ".ml", code));
+    }
+
+    Pipeline pipeline;
+    auto one = batchOutput(runBatch(pipeline, paths, 1));
+    for (unsigned jobs : {1u, 4u, 8u}) EXPECT_EQ(batchOutput(runBatch(pipeline, paths, jobs)), one) << jobs;
+
+    auto four = runBatch(pipeline, paths, 4);
+    EXPECT_EQ(four[1].result.type, "a0 -> a1 -> (a1, a0, Int)");
+    EXPECT_EQ(four[0].result.type, "(a0 -> a1 -> a1, a2 -> Int)");
+    fs::remove_all(dir);
+}
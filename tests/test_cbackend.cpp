@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include "backends/c/CBackend.hpp"
+#include "evaluator/Eval.hpp"
+#include "ir/Lower.hpp"
+#include "ir/Passes.hpp"
+#include "types/Infer.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+static std::string toC(const ExprPtr& e, bool optimize = false) {
+    TypeAnnotations notes;
+    auto r = infer(e, TypeEnv{}, notes);
+    auto prog = lower(e, &notes);
+    if (optimize) PassManager::standard().run(prog);
+    return emitC(prog, apply_type(r.subst, r.type));
+}
+
+// Compile the generated C with the runtime and return what the binary prints.
+static std::string runC(const ExprPtr& e, bool optimize) {
+    auto dir = std::filesystem::temp_directory_path() / ("miniml_c_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+    std::filesystem::create_directories(dir);
+    auto src = (dir / "prog.c").string(), exe = (dir / "prog").string();
+    std::ofstream(src) << toC(e, optimize);
+    linkWithRuntime({src}, exe);
+
+    std::string out;
+    if (FILE* p = popen(exe.c_str(), "r")) {
+        char buf[256];
+        while (fgets(buf, sizeof buf, p)) out += buf;
+        pclose(p);
+    }
+    std::filesystem::remove_all(dir);
+    if (!out.empty() && out.back() == '\n') out.pop_back();
+    return out;
+}
+
+TEST(CBackend, MonomorphicEqualityIsInlined) {
+    // (1, true) = (1, false)
+    auto e = binop(BinOp::Eq, lit_tuple({lit_int(1, L), lit_bool(true, L)}, L),
+                   lit_tuple({lit_int(1, L), lit_bool(false, L)}, L), L);
+    auto c = toC(e);
+    EXPECT_EQ(c.find("mml_equal("), std::string::npos);
+    EXPECT_NE(c.find("->elems[1]"), std::string::npos);
+}
+
+TEST(CBackend, PolymorphicEqualityUsesRuntime) {
+    // let eq = \a -> \b -> a = b in eq 1 2
+    auto e = let_("eq", lam("a", lam("b", binop(BinOp::Eq, var("a", L), var("b", L), L), L), L),
+                  app(app(var("eq", L), lit_int(1, L), L), lit_int(2, L), L), L);
+    EXPECT_NE(toC(e).find("mml_equal("), std::string::npos);
+}
+
+TEST(CBackend, NativeBinaryMatchesEvaluator) {
+    // let f = \x -> if x > 3 then (x * 2, x / 0) else (x - 1, 7) in (f 5, f 1 = (0, 7), f)
+    auto body = if_(binop(BinOp::Gt, var("x", L), lit_int(3, L), L),
+                    lit_tuple({binop(BinOp::Mul, var("x", L), lit_int(2, L), L),
+                               binop(BinOp::Div, var("x", L), lit_int(0, L), L)}, L),
+                    lit_tuple({binop(BinOp::Sub, var("x", L), lit_int(1, L), L), lit_int(7, L)}, L), L);
+    auto call = [&](long n) { return app(var("f", L), lit_int(n, L), L); };
+    auto e = let_("f", lam("x", body, L),
+                  lit_tuple({call(5),
+                             binop(BinOp::Eq, call(1), lit_tuple({lit_int(0, L), lit_int(7, L)}, L), L),
+                             var("f", L)}, L), L);
+    auto expected = showVal(eval(e, prelude()));
+    EXPECT_EQ(expected, "((10, 0), true, <fun>)");
+    EXPECT_EQ(runC(e, false), expected);
+    EXPECT_EQ(runC(e, true), expected);
+}
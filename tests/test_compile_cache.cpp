@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "driver/CompileCache.hpp"
+#include "evaluator/Eval.hpp"
+#include "types/Pretty.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 3, 7};
+
+// let pair = \x -> (x, x) in let p = pair 1 in if p = (1, 1) then pair (not true) else pair false
+static CheckedProgram program() {
+    auto pair = lam("x", lit_tuple({var("x", L), var("x", L)}, L), L);
+    auto cond = binop(BinOp::Eq, var("p", L), lit_tuple({lit_int(1, L), lit_int(1, L)}, L), L);
+    auto e = let_("pair", pair,
+                  let_("p", app(var("pair", L), lit_int(1, L), L),
+                       if_(cond, app(var("pair", L), unop(UnOp::Not, lit_bool(true, L), L), L),
+                           app(var("pair", L), lit_bool(false, L), L), L), L), L);
+    CheckedProgram p;
+    p.ast = e;
+    auto r = infer(e, TypeEnv{}, p.notes);
+    p.type = apply_type(r.subst, r.type);
+    return p;
+}
+
+TEST(CompileCache, RoundTripsAstTypeAndAnnotations) {
+    auto p = program();
+    auto key = compileCacheKey("source", "a.ml");
+    auto bytes = serializeProgram(p, key);
+
+    auto q = deserializeProgram(bytes.data(), bytes.size(), key, "a.ml");
+    ASSERT_TRUE(q);
+    EXPECT_EQ(showType(q->type), "(Bool, Bool)");
+    EXPECT_EQ(showVal(eval(q->ast, prelude())), showVal(eval(p.ast, prelude())));
+    ASSERT_EQ(q->notes.eqOperands.size(), 1u);
+    EXPECT_EQ(showType(q->notes.eqOperands.begin()->second), "(Int, Int)");
+    EXPECT_EQ(std::visit([](auto& n) { return n.loc.file + ":" + std::to_string(n.loc.line) + ":" +
+                                              std::to_string(n.loc.col); }, *q->ast), "a.ml:3:7");
+    EXPECT_EQ(serializeProgram(*q, key), bytes);
+}
+
+TEST(CompileCache, RejectsOtherKeysAndDamagedData) {
+    auto p = program();
+    auto key = compileCacheKey("source", "a.ml");
+    auto bytes = serializeProgram(p, key);
+
+    EXPECT_NE(compileCacheKey("source", "b.ml"), key);
+    EXPECT_NE(compileCacheKey("source ", "a.ml"), key);
+    EXPECT_FALSE(deserializeProgram(bytes.data(), bytes.size(), key + 1, "a.ml"));
+    for (std::size_t cut : {std::size_t{0}, std::size_t{8}, bytes.size() / 2, bytes.size() - 1})
+        EXPECT_FALSE(deserializeProgram(bytes.data(), cut, key, "a.ml")) << cut;
+
+    auto damaged = bytes;
+    for (std::size_t i = 48; i < damaged.size(); i += 7) damaged[i] = static_cast<char>(0xff);
+    EXPECT_FALSE(deserializeProgram(damaged.data(), damaged.size(), key, "a.ml"));
+}
+
+TEST(CompileCache, StoresAndLoadsFiles) {
+    auto dir = std::filesystem::temp_directory_path() / "miniml_compile_cache_test";
+    std::filesystem::remove_all(dir);
+    CompileCache cache(dir.string());
+
+    EXPECT_FALSE(cache.load("source", "a.ml"));
+    cache.store("source", "a.ml", program());
+    EXPECT_TRUE(std::filesystem::exists(cache.pathFor(compileCacheKey("source", "a.ml"))));
+    auto q = cache.load("source", "a.ml");
+    ASSERT_TRUE(q);
+    EXPECT_EQ(showType(q->type), "(Bool, Bool)");
+    EXPECT_FALSE(cache.load("changed source", "a.ml"));
+    std::filesystem::remove_all(dir);
+}
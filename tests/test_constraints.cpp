@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include "ProgramGen.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "types/Constraints.hpp"
+#include "types/Pretty.hpp"
+
+using namespace miniml;
+
+// Type variables renamed a0, a1, ... in order of appearance: the two engines
+// draw different variables.
+static std::string canon(const std::string& s) {
+    static const std::regex tvar("a[0-9]+");
+    std::unordered_map<std::string, std::string> names;
+    std::string out;
+    auto last = s.cbegin();
+    for (std::sregex_iterator it(s.begin(), s.end(), tvar), end; it != end; ++it) {
+        out.append(last, s.cbegin() + it->position());
+        auto [n, added] = names.try_emplace(it->str(), "a" + std::to_string(names.size()));
+        out += n->second;
+        last = s.cbegin() + it->position() + it->length();
+    }
+    out.append(last, s.cend());
+    return out;
+}
+
+// The type, and the operand types of '=' and '<>' in source order, or the error.
+template <class Run>
+static std::string outcome(const Expr& e, Run run) {
+    try {
+        TypeAnnotations notes;
+        auto r = run(e, notes);
+        std::map<std::pair<int, int>, std::string> operands;
+        for (auto& [node, t] : notes.eqOperands) operands[{node->loc.line, node->loc.col}] = showType(t);
+        std::string out = showType(apply_type(r.subst, r.type));
+        for (auto& [at, t] : operands) out += " | " + t;
+        return canon(out);
+    } catch (const TypeError& err) {
+        return std::string("error: ") + err.what();
+    }
+}
+
+static std::string byW(const Expr& e) {
+    return outcome(e, [](const Expr& x, TypeAnnotations& notes) { return infer(x, {}, notes); });
+}
+
+static std::string byConstraints(const Expr& e, WorkStealingPool* pool = nullptr, std::size_t forkNodes = 1) {
+    return outcome(e, [&](const Expr& x, TypeAnnotations& notes) {
+        return inferConstraints(x, {}, &notes, pool, forkNodes);
+    });
+}
+
+TEST(Constraints, SameOutcomeAsAlgorithmW) {
+    const char* programs[] = {
+        "let id = \\x -> x in (id 1, id true)",
+        "let twice = \\f -> \\x -> f (f x) in twice (\\n -> n + 1) 0",
+        "\\f -> \\g -> \\x -> f (g x)",
+        "\\x -> \\y -> if x = y then (x, y) else (y, x)",
+        "let pair = \\a -> \\b -> (a, b) in let p = pair 1 in (p true, p (2, 3))",
+        "\\f -> let g = \\x -> f x in (g 1, g 2)",
+        "let k = \\x -> \\y -> x in let f = \\z -> k z in (f 1 true, f false 2)",
+        "(1 = 2, (true, false) <> (false, true), \\x -> x = x)",
+        // errors: the first one infer() finds, with its location
+        "\\x -> x x",
+        "(1, 2) = (1, 2, 3)",
+        "if 1 then 2 else 3",
+        "if true then 1 else false",
+        "let f = \\x -> x + 1 in f true",
+        "let g = \\x -> (x 1, x true) in g",
+        "(1 + true, y)",
+        "(y, 1 + true)",
+        "let id = \\x -> x in\nlet bad = id 1 + id false in\nnope",
+        "not (1 < 2) && 3",
+    };
+    WorkStealingPool pool(3);
+    for (const char* src : programs) {
+        auto ast = parse_to_ast(src, "<test>");
+        auto expected = byW(*ast);
+        EXPECT_EQ(byConstraints(*ast), expected) << src;
+        EXPECT_EQ(byConstraints(*ast, &pool), expected) << src;
+    }
+}
+
+TEST(Constraints, SameOutcomeOnGeneratedPrograms) {
+    using namespace miniml::bench;
+    WorkStealingPool pool(3);
+    for (auto shape : {ProgramShape::DeepLets, ProgramShape::WideTuples, ProgramShape::Polymorphic,
+                       ProgramShape::Curried, ProgramShape::Mixed}) {
+        for (std::uint64_t seed = 1; seed <= 3; ++seed) {
+            // infer() is slow on long curried functions
+            auto src = generateProgram({shape, shape == ProgramShape::Curried ? 16 : 120, seed});
+            auto ast = parse_to_ast(src, "<gen>");
+            auto expected = byW(*ast);
+            EXPECT_EQ(expected.rfind("error", 0), std::string::npos) << expected;
+            EXPECT_EQ(byConstraints(*ast), expected) << shapeName(shape) << " " << seed;
+            EXPECT_EQ(byConstraints(*ast, &pool, 16), expected) << shapeName(shape) << " " << seed;
+        }
+    }
+
+    // one ill-typed use deep inside: the same first error whatever generated first
+    auto src = generateProgram({ProgramShape::Mixed, 200, 5});
+    src.insert(src.find(" in") + 3, " let oops = (1, 2) = (1, 2, 3) in");
+    auto ast = parse_to_ast(src, "<gen>");
+    auto expected = byW(*ast);
+    EXPECT_NE(expected.find("tuple arity mismatch"), std::string::npos) << expected;
+    EXPECT_EQ(byConstraints(*ast, &pool, 8), expected);
+}
+
+TEST(Constraints, SubstitutionCoversTheEnvironment) {
+    int a = freshTypeVarId(), b = freshTypeVarId();
+    TypeEnv gamma;
+    gamma["x"] = TypeScheme{{}, Type::tVar(a)};
+    gamma["id"] = TypeScheme{{b}, Type::tFun(Type::tVar(b), Type::tVar(b))};
+    auto ast = parse_to_ast("(id x + 1, id true)", "<test>");
+    auto r = inferConstraints(*ast, gamma);
+    EXPECT_EQ(showType(r.type), "(Int, Bool)");
+    ASSERT_EQ(r.subst.m.count(a), 1u);
+    EXPECT_EQ(showType(r.subst.m.at(a)), "Int");
+}
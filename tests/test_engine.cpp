@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "driver/Engine.hpp"
+#include "types/Unify.hpp"
+
+using namespace miniml;
+
+TEST(Engine, RunsTheScriptOnEachInput) {
+    Engine engine("let sq = \\n -> n * n in \\n -> sq n + 1");
+    EXPECT_EQ(engine.type(), "Int -> Int");
+
+    auto r = engine.runAll({"3", "let x = 2 in x * 2", "true", "y", "(1"}, 2);
+    ASSERT_EQ(r.size(), 5u);
+    EXPECT_EQ(r[0].value, "10");
+    EXPECT_EQ(r[0].type, "Int");
+    EXPECT_EQ(r[1].value, "17");
+    EXPECT_EQ(r[2].status, RunResult::Status::TypeError);
+    EXPECT_EQ(r[3].status, RunResult::Status::ScopeError);
+    EXPECT_EQ(r[4].status, RunResult::Status::ParseError);
+}
+
+TEST(Engine, PolymorphicScriptsTypeEachInputOnItsOwn) {
+    Engine engine("\\x -> (x, x)");
+    Engine::Worker w(engine);
+    auto a = w.run("1");
+    EXPECT_EQ(a.type, "(Int, Int)");
+    EXPECT_EQ(a.value, "(1, 1)");
+    auto b = w.run("true");
+    EXPECT_EQ(b.type, "(Bool, Bool)");
+    EXPECT_EQ(b.value, "(true, true)");
+}
+
+TEST(Engine, ManyThreadsGiveTheSequentialResults) {
+    Engine engine("let twice = \\f -> \\x -> f (f x) in \\n -> twice twice (\\k -> k + n) n");
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 200; ++i) inputs.push_back(std::to_string(i));
+
+    auto expected = engine.runAll(inputs, 1);
+    auto r = engine.runAll(inputs, 4);
+    ASSERT_EQ(r.size(), inputs.size());
+    for (std::size_t i = 0; i < r.size(); ++i) {
+        EXPECT_EQ(r[i].value, expected[i].value) << i;
+        EXPECT_EQ(r[i].value, std::to_string(5 * i)) << i;
+    }
+}
+
+TEST(Engine, PolymorphicResultTypesDoNotDependOnThreads) {
+    // type variables are drawn from one counter shared by all threads
+    Engine engine("\\x -> (x, x)");
+    EXPECT_EQ(engine.type(), "a0 -> (a0, a0)");
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 100; ++i) inputs.push_back(i % 2 ? "\\y -> y" : "\\a -> \\b -> (b, " + std::to_string(i) + ")");
+
+    auto one = engine.runAll(inputs, 1);
+    auto four = engine.runAll(inputs, 4);
+    ASSERT_EQ(four.size(), inputs.size());
+    for (std::size_t i = 0; i < four.size(); ++i) EXPECT_EQ(four[i].type, one[i].type) << i;
+    EXPECT_EQ(four[1].type, "(a0 -> a0, a0 -> a0)");
+    EXPECT_EQ(four[0].type, "(a0 -> a1 -> (a1, Int), a0 -> a1 -> (a1, Int))");
+}
+
+TEST(Engine, RejectsScriptsThatAreNotFunctionsAndAppliesLimits) {
+    EXPECT_THROW(Engine("(1, 2)"), TypeError);
+
+    RunOptions opts;
+    opts.fuel = 50;
+    Engine engine("let loop = \\f -> \\x -> f (f (f x)) in \\n -> loop loop loop (\\k -> k + 1) n", "<script>", opts);
+    auto r = engine.runAll({"0"});
+    EXPECT_EQ(r[0].status, RunResult::Status::LimitError);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "semantic/Escape.hpp"
+#include "evaluator/Eval.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+static std::string run(const ExprPtr& e) { return showVal(eval(e, prelude())); }
+
+TEST(Escape, ComparedTuplesDoNotEscape) {
+    // let t = (1, 2) in (t = (1, 2), 3)
+    auto e = let_("t", lit_tuple({lit_int(1, L), lit_int(2, L)}, L),
+                  lit_tuple({binop(BinOp::Eq, var("t", L), lit_tuple({lit_int(1, L), lit_int(2, L)}, L), L),
+                             lit_int(3, L)}, L), L);
+    auto stats = analyzeEscapes(e);
+    EXPECT_EQ(stats.tuples, 2);
+    EXPECT_TRUE(std::get<ELitTuple>(*std::get<ELet>(*e).body).escapes);   // the result tuple
+    EXPECT_EQ(run(e), "(true, 3)");
+}
+
+TEST(Escape, ReturnedClosureKeepsItsFrame) {
+    // let z = 5 in let f = \x -> \y -> x + z in f 1 2
+    auto inner = lam("y", binop(BinOp::Add, var("x", L), var("z", L), L), L);
+    auto e = let_("z", lit_int(5, L),
+                  let_("f", lam("x", inner, L),
+                       app(app(var("f", L), lit_int(1, L), L), lit_int(2, L), L), L), L);
+    auto stats = analyzeEscapes(e);
+    auto& letZ = std::get<ELet>(*e);
+    auto& letF = std::get<ELet>(*letZ.body);
+    auto& f = std::get<ELam>(*letF.rhs);
+    EXPECT_FALSE(f.escapes);         // only ever called
+    EXPECT_TRUE(f.frameEscapes);     // \y captures x
+    EXPECT_TRUE(letZ.frameEscapes);  // ... and, through the chain, z
+    EXPECT_FALSE(letF.frameEscapes);
+    EXPECT_EQ(stats.closures, 1);
+    EXPECT_EQ(run(e), "6");
+}
+
+TEST(Escape, CapturedBindingsStayOnTheHeap) {
+    // let t = (1, 2) in let g = \u -> t = (1, 2) in (g, g 0)
+    auto e = let_("t", lit_tuple({lit_int(1, L), lit_int(2, L)}, L),
+                  let_("g", lam("u", binop(BinOp::Eq, var("t", L), lit_tuple({lit_int(1, L), lit_int(2, L)}, L), L), L),
+                       lit_tuple({var("g", L), app(var("g", L), lit_int(0, L), L)}, L), L), L);
+    analyzeEscapes(e);
+    auto& letT = std::get<ELet>(*e);
+    EXPECT_TRUE(std::get<ELitTuple>(*letT.rhs).escapes);
+    EXPECT_TRUE(std::get<ELam>(*std::get<ELet>(*letT.body).rhs).escapes);
+    EXPECT_EQ(run(e), "(<fun>, true)");
+}
+
+TEST(Escape, ImmediateApplicationNeedsNoClosure) {
+    // (\x -> \y -> x) 1 2 ; the outer lambda is applied on the spot
+    auto e = app(app(lam("x", lam("y", var("x", L), L), L), lit_int(1, L), L), lit_int(2, L), L);
+    auto before = run(e);
+    auto stats = analyzeEscapes(e);
+    EXPECT_EQ(stats.closures, 1);
+    EXPECT_EQ(run(e), before);
+    EXPECT_EQ(run(e), "1");
+}
+
+TEST(Escape, CapturedFramesKeepTheirBindings) {
+    // the returned lambda captures the frame holding f (or t), so the bound
+    // value must outlive the let whether or not its use is reached
+    auto ret = [] { return lam("a", lit_int(3, L), L); };
+    auto f = [] { return lam("b", var("b", L), L); };
+    auto t = [] { return lit_tuple({lit_int(1, L), lit_int(2, L)}, L); };
+    std::vector<ExprPtr> progs{
+        // let f = \b -> b in let g = (if false then f 1 else 2) in \a -> 3
+        let_("f", f(), let_("g", if_(lit_bool(false, L), app(var("f", L), lit_int(1, L), L), lit_int(2, L), L),
+                            ret(), L), L),
+        // let f = \b -> b in let g = f 1 in \a -> 3
+        let_("f", f(), let_("g", app(var("f", L), lit_int(1, L), L), ret(), L), L),
+        // let t = (1, 2) in let g = (if false then t = t else true) in \a -> 3
+        let_("t", t(), let_("g", if_(lit_bool(false, L), binop(BinOp::Eq, var("t", L), var("t", L), L),
+                                     lit_bool(true, L), L), ret(), L), L),
+    };
+    for (auto& e : progs) {
+        analyzeEscapes(e);
+        auto& let = std::get<ELet>(*e);
+        EXPECT_TRUE(let.frameEscapes);
+        if (auto lam = std::get_if<ELam>(let.rhs.get())) EXPECT_TRUE(lam->escapes);
+        else EXPECT_TRUE(std::get<ELitTuple>(*let.rhs).escapes);
+        EXPECT_EQ(run(e), "<fun>");
+    }
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include "driver/Incremental.hpp"
+
+using namespace miniml;
+
+// Type variables renamed a0, a1, ... in order of appearance: two inferences
+// of one program differ in the variables they draw.
+static std::string canon(const std::string& s) {
+    static const std::regex tvar("a[0-9]+");
+    std::unordered_map<std::string, std::string> names;
+    std::string out;
+    auto last = s.cbegin();
+    for (std::sregex_iterator it(s.begin(), s.end(), tvar), end; it != end; ++it) {
+        out.append(last, s.cbegin() + it->position());
+        auto [n, added] = names.try_emplace(it->str(), "a" + std::to_string(names.size()));
+        out += n->second;
+        last = s.cbegin() + it->position() + it->length();
+    }
+    out.append(last, s.cend());
+    return out;
+}
+
+static std::string summary(const RunResult& r) {
+    return std::string(statusName(r.status)) + " " + canon(r.type) + " " + canon(r.error);
+}
+
+// What checking the whole source says.
+static std::string full(const std::string& source) {
+    static const Pipeline pipeline;
+    auto r = pipeline.run(source, "<test>");
+    if (r.status == RunResult::Status::Ok) r.value.clear();
+    return summary(r);
+}
+
+// let f0 = \x -> x + 0 in ... let f<n-1> = ... in (f0 1, f<n-1> 1)
+static std::string program(int n) {
+    std::string src;
+    for (int i = 0; i < n; ++i) {
+        src += "let f" + std::to_string(i) + " = \\x -> ";
+        src += i ? "f" + std::to_string(i - 1) + " (x + " + std::to_string(i) + ")" : "x + 0";
+        src += " in\n";
+    }
+    return src + "(f0 1, f" + std::to_string(n - 1) + " 1)";
+}
+
+TEST(Incremental, OneTokenEditRechecksOnlyItsPath) {
+    IncrementalAnalyzer a("<test>");
+    auto src = program(200);
+    auto r = a.open(src);
+    EXPECT_EQ(r.status, RunResult::Status::Ok) << r.error;
+    EXPECT_EQ(r.type, "(Int, Int)");
+    EXPECT_TRUE(a.stats().fullParse);
+    auto nodes = a.stats().reparsedNodes;
+
+    auto at = src.find("(x + 150)") + 5;
+    r = a.edit({at, 3, "true"});   // f150 takes a Bool now, and f151 gives it an Int
+    EXPECT_EQ(summary(r), full(a.source()));
+    EXPECT_EQ(r.status, RunResult::Status::TypeError);
+    EXPECT_FALSE(a.stats().fullParse);
+    EXPECT_LE(a.stats().reparsedBytes, 10u);
+    EXPECT_LT(a.stats().inferredNodes, nodes / 2);
+
+    r = a.edit({at, 4, "150"});   // back to a tree seen before
+    EXPECT_EQ(summary(r), full(a.source()));
+    EXPECT_EQ(r.type, "(Int, Int)");
+    EXPECT_EQ(a.source(), src);
+    EXPECT_LT(a.stats().inferredNodes, 5u);
+
+    r = a.edit({at + 2, 1, "1"});
+    EXPECT_EQ(summary(r), full(a.source()));
+    EXPECT_LT(a.stats().scopeNodes, 160u);      // the lets down to f150, and the edit
+    EXPECT_LT(a.stats().inferredNodes, 320u);
+    EXPECT_GT(a.stats().memoHits, 100u);
+
+    at = src.find("(x + 5)") + 5;
+    r = a.edit({at, 1, "6"});
+    EXPECT_EQ(summary(r), full(a.source()));
+    EXPECT_LT(a.stats().scopeNodes, 20u);
+    EXPECT_LT(a.stats().inferredNodes, 40u);
+}
+
+TEST(Incremental, MatchesAFullAnalysisAfterEveryEdit) {
+    IncrementalAnalyzer a("<test>");
+    std::string src = "let id = \\x -> x in\n"
+                      "let pair = (id 1, (id true, 3)) in\n"
+                      "(* pick one *)\n"
+                      "if id (1 < 2) then pair else (4, (false, 5))";
+    EXPECT_EQ(summary(a.open(src)), full(src));
+
+    // one per line: replaced text, its replacement
+    const std::vector<std::pair<std::string, std::string>> edits = {
+        {"(1 < 2)", "(1 < y)"},              // unbound
+        {"(1 < y)", "(1 < 2)"},
+        {"then pair", "then\n\n  pair"},     // later lines move
+        {"5))", "x))"},                      // unbound, reported where it now is
+        {"x))", "5))"},
+        {"(id true, 3)", "(id true, 3"},     // does not parse
+        {"(id true, 3", "(id true, 3)"},
+        {"\\x -> x", "\\y -> y"},
+        {"(4, (false, 5))", "(4, (false, true))"},   // branches differ
+        {"let id", "let idd"},               // every use unbound
+        {"let idd", "let id"},
+        {"(id 1, ", "(id 1, id (2, 2), "},   // a third element
+    };
+    for (auto& [from, to] : edits) {
+        auto at = src.find(from);
+        ASSERT_NE(at, std::string::npos) << from;
+        src.replace(at, from.size(), to);
+        auto r = a.update(src);
+        EXPECT_EQ(a.source(), src);
+        EXPECT_EQ(summary(r), full(src)) << "after " << from << " -> " << to;
+    }
+    EXPECT_NE(a.ast(), nullptr);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "types/Infer.hpp"
+#include "types/InferStats.hpp"
+#include "types/Pretty.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+// T0 = a, Tk = (Tk-1, Tk-1): 2^k leaves as a tree, k + 1 nodes as a DAG
+static TypePtr doubling(int k, TypePtr leaf) {
+    auto t = leaf;
+    for (int i = 0; i < k; ++i) t = Type::tTuple({t, t});
+    return t;
+}
+
+TEST(InferStats, TypeSizesTreeAndDag) {
+    auto t = doubling(10, Type::tVar(0));
+    EXPECT_EQ(typeTreeSize(t), 2047u);
+    EXPECT_EQ(typeDagSize(t), 11u);
+    EXPECT_EQ(typeTreeSize(doubling(70, Type::tInt())), UINT64_MAX);   // saturates
+}
+
+TEST(InferStats, SharedTypesPrintInLinearSpace) {
+    auto small = Type::tTuple({Type::tInt(), Type::tFun(Type::tVar(1), Type::tBool())});
+    EXPECT_EQ(showType(small), "(Int, a1 -> Bool)");
+
+    auto big = doubling(60, Type::tInt());
+    auto s = showType(big);
+    EXPECT_LT(s.size(), 2000u);
+    EXPECT_EQ(s.rfind("(t0, t0) where t0 = (t1, t1), t1 = (t2, t2)", 0), 0u);
+    EXPECT_NE(s.find("t58 = (Int, Int)"), std::string::npos);
+}
+
+TEST(InferStats, SubstitutionKeepsSharing) {
+    auto t = doubling(40, Type::tVar(7));
+    Subst s;
+    s.m[7] = Type::tFun(Type::tInt(), Type::tInt());
+    auto r = s.apply(t);
+    // small subterms may be rebuilt per use before the memo kicks in, but the
+    // result stays linear in the input instead of a 2^40-node tree
+    EXPECT_EQ(typeTreeSize(r), typeTreeSize(doubling(40, Type::tFun(Type::tInt(), Type::tInt()))));
+    EXPECT_LT(typeDagSize(r), 200u);
+}
+
+TEST(InferStats, CountsComposeAndUnify) {
+    // let f = \x -> (x, x) in f (f 1)
+    auto e = let_("f", lam("x", lit_tuple({var("x", L), var("x", L)}, L), L),
+                  app(var("f", L), app(var("f", L), lit_int(1, L), L), L), L);
+    InferStats stats;
+    {
+        InferStats::Scope scope(stats);
+        auto r = infer(e, TypeEnv{});
+        EXPECT_EQ(showType(apply_type(r.subst, r.type)), "((Int, Int), (Int, Int))");
+    }
+    EXPECT_EQ(stats.unifyCalls, 2u);
+    EXPECT_GT(stats.composeCalls, 0u);
+    EXPECT_EQ(stats.maxTypeSize, 7u);    // the result, as a tree
+    EXPECT_EQ(stats.maxTypeNodes, 3u);   // ... and as a DAG
+
+    auto before = stats.composeCalls;
+    infer(e, TypeEnv{});                 // no scope: nothing counted
+    EXPECT_EQ(stats.composeCalls, before);
+}
+
+TEST(InferStats, OccursCheckStillFails) {
+    // \x -> x x
+    auto e = lam("x", app(var("x", L), var("x", L), L), L);
+    EXPECT_THROW(infer(e, TypeEnv{}), TypeError);
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "ir/Lower.hpp"
+#include "ir/IRInterp.hpp"
+#include "evaluator/Eval.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+static std::string viaIR(const ExprPtr& e) { return showIRVal(runIR(lower(e))); }
+static std::string viaEval(const ExprPtr& e) { return showVal(eval(e, prelude())); }
+
+TEST(IR, ClosureCapturesFreeVariable) {
+    // let y = 5 in let f = \x -> x + y in f 3
+    auto e = let_("y", lit_int(5, L),
+                  let_("f", lam("x", binop(BinOp::Add, var("x", L), var("y", L), L), L),
+                       app(var("f", L), lit_int(3, L), L), L), L);
+    auto prog = lower(e);
+    ASSERT_EQ(prog.funcs.size(), 2u);
+    EXPECT_EQ(prog.funcs[1].captures, std::vector<std::string>{"y"});
+    EXPECT_EQ(viaIR(e), "8");
+}
+
+TEST(IR, IfBecomesBlocks) {
+    auto e = if_(binop(BinOp::Lt, lit_int(1, L), lit_int(2, L), L), lit_int(10, L), lit_int(20, L), L);
+    auto prog = lower(e);
+    EXPECT_EQ(prog.funcs[0].blocks.size(), 4u);
+    EXPECT_EQ(prog.funcs[0].blocks[0].term.k, IRTermKind::Br);
+    EXPECT_EQ(viaIR(e), "10");
+}
+
+TEST(IR, ShortCircuitSkipsRhs) {
+    // false && ((\x -> x) 1 = 1) never calls the lambda
+    auto rhs = binop(BinOp::Eq, app(lam("x", var("x", L), L), lit_int(1, L), L), lit_int(1, L), L);
+    EXPECT_EQ(viaIR(binop(BinOp::And, lit_bool(false, L), rhs, L)), "false");
+    EXPECT_EQ(viaIR(binop(BinOp::Or, lit_bool(false, L), rhs, L)), "true");
+}
+
+TEST(IR, MatchesEvaluator) {
+    // let pair = \a -> \b -> (a, b) in (pair 1 true, pair 2 false = pair 2 false, not (3 >= 4))
+    auto pair = lam("a", lam("b", lit_tuple({var("a", L), var("b", L)}, L), L), L);
+    auto call = [&](long n, bool b) {
+        return app(app(var("pair", L), lit_int(n, L), L), lit_bool(b, L), L);
+    };
+    auto e = let_("pair", pair,
+                  lit_tuple({call(1, true),
+                             binop(BinOp::Eq, call(2, false), call(2, false), L),
+                             unop(UnOp::Not, binop(BinOp::Ge, lit_int(3, L), lit_int(4, L), L), L)}, L), L);
+    EXPECT_EQ(viaIR(e), viaEval(e));
+    EXPECT_EQ(viaIR(e), "((1, true), true, true)");
+}
+
+TEST(IR, IntsWrapAt63Bits) {
+    // let x = 4611686018427387903 in (x + 1, 3037000500 * 3037000500, (0 - x - 1) / (0 - 1))
+    auto x = [&] { return var("x", L); };
+    auto zero = [&] { return lit_int(0, L); };
+    auto e = let_("x", lit_int(kIntMax, L),
+                  lit_tuple({binop(BinOp::Add, x(), lit_int(1, L), L),
+                             binop(BinOp::Mul, lit_int(3037000500, L), lit_int(3037000500, L), L),
+                             binop(BinOp::Div, binop(BinOp::Sub, binop(BinOp::Sub, zero(), x(), L), lit_int(1, L), L),
+                                   binop(BinOp::Sub, zero(), lit_int(1, L), L), L)}, L), L);
+    EXPECT_EQ(viaEval(e), "(-4611686018427387904, 145474192, -4611686018427387904)");
+    EXPECT_EQ(viaIR(e), viaEval(e));
+    EXPECT_EQ(wrapInt(kIntMax + 1), kIntMin);
+}
+
+#include "ir/Passes.hpp"
+#include "ir/SSA.hpp"
+
+static size_t instrCount(const IRProgram& p) {
+    size_t n = 0;
+    for (auto& f : p.funcs) for (auto& b : f.blocks) n += b.body.size();
+    return n;
+}
+
+static IRProgram optimized(const ExprPtr& e, std::vector<PassReport>* reports = nullptr) {
+    auto prog = lower(e);
+    auto pm = PassManager::standard();
+    pm.verifyEachPass = true;
+    auto r = pm.run(prog);
+    if (reports) *reports = r;
+    return prog;
+}
+
+TEST(IRPasses, ToSSAIntroducesPhi) {
+    auto e = if_(lit_bool(true, L), lit_int(1, L), lit_int(2, L), L);
+    auto prog = lower(e);
+    EXPECT_THROW(verifySSA(prog.funcs[0]), IRVerifyError);   // result temp is assigned twice
+    toSSA(prog);
+    EXPECT_NO_THROW(verifySSA(prog.funcs[0]));
+    EXPECT_EQ(prog.funcs[0].blocks.back().body.front().op, IROp::Phi);
+    EXPECT_EQ(showIRVal(runIR(prog)), "1");
+}
+
+TEST(IRPasses, NestedConditionalsGetNoPhiWithoutADefinition) {
+    // if false then (if true then 1 else 2) else 3
+    auto nestedIf = if_(lit_bool(false, L), if_(lit_bool(true, L), lit_int(1, L), lit_int(2, L), L), lit_int(3, L), L);
+    // if 1 < 2 && (3 = 3 || false) then (1, 2) else (3, 4)
+    auto nestedLogic = if_(binop(BinOp::And, binop(BinOp::Lt, lit_int(1, L), lit_int(2, L), L),
+                                 binop(BinOp::Or, binop(BinOp::Eq, lit_int(3, L), lit_int(3, L), L),
+                                       lit_bool(false, L), L), L),
+                           lit_tuple({lit_int(1, L), lit_int(2, L)}, L),
+                           lit_tuple({lit_int(3, L), lit_int(4, L)}, L), L);
+    for (auto& e : {nestedIf, nestedLogic}) {
+        auto prog = lower(e);
+        ASSERT_NO_THROW(toSSA(prog));
+        EXPECT_NO_THROW(verifySSA(prog.funcs[0]));
+        EXPECT_EQ(showIRVal(runIR(prog)), viaEval(e));
+        EXPECT_EQ(showIRVal(runIR(optimized(e))), viaEval(e));
+    }
+    EXPECT_EQ(viaEval(nestedIf), "3");
+    EXPECT_EQ(viaEval(nestedLogic), "(1, 2)");
+}
+
+TEST(IRPasses, ConstantBranchFoldsAway) {
+    // if 1 + 2 < 4 then 10 * 2 else 0   ==> ret const 20 in a single block
+    auto e = if_(binop(BinOp::Lt, binop(BinOp::Add, lit_int(1, L), lit_int(2, L), L), lit_int(4, L), L),
+                 binop(BinOp::Mul, lit_int(10, L), lit_int(2, L), L), lit_int(0, L), L);
+    std::vector<PassReport> reports;
+    auto prog = optimized(e, &reports);
+    ASSERT_EQ(prog.funcs[0].blocks.size(), 1u);
+    ASSERT_EQ(prog.funcs[0].blocks[0].body.size(), 1u);
+    EXPECT_EQ(prog.funcs[0].blocks[0].body[0].imm, 20);
+    EXPECT_EQ(reports[0].name, "sccp");
+    EXPECT_GT(reports[0].total.blocksRemoved, 0);
+    EXPECT_EQ(showIRVal(runIR(prog)), "20");
+}
+
+TEST(IRPasses, CommonSubexpressionsAreShared) {
+    // \x -> (x * x + 1, x * x + 1, 1 + x * x) applied to 7
+    auto sq = [&] { return binop(BinOp::Mul, var("x", L), var("x", L), L); };
+    auto body = lit_tuple({binop(BinOp::Add, sq(), lit_int(1, L), L),
+                           binop(BinOp::Add, sq(), lit_int(1, L), L),
+                           binop(BinOp::Add, lit_int(1, L), sq(), L)}, L);
+    auto e = app(lam("x", body, L), lit_int(7, L), L);
+    auto before = lower(e);
+    std::vector<PassReport> reports;
+    auto after = optimized(e, &reports);
+    // param, const 1, mul, add, tuple
+    EXPECT_EQ(after.funcs[1].blocks[0].body.size(), 5u);
+    EXPECT_LT(instrCount(after), instrCount(before));
+    EXPECT_EQ(showIRVal(runIR(after)), showIRVal(runIR(before)));
+    EXPECT_EQ(showIRVal(runIR(after)), "(50, 50, 50)");
+}
+
+TEST(IRPasses, UnusedBindingsAreDropped) {
+    // let unused = (\y -> y) 3 in let k = (1, 2) in 5
+    auto e = let_("unused", app(lam("y", var("y", L), L), lit_int(3, L), L),
+                  let_("k", lit_tuple({lit_int(1, L), lit_int(2, L)}, L), lit_int(5, L), L), L);
+    auto prog = optimized(e);
+    ASSERT_EQ(prog.funcs[0].blocks[0].body.size(), 1u);
+    EXPECT_EQ(showIRVal(runIR(prog)), "5");
+}
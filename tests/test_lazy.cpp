@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "ProgramGen.hpp"
+#include "evaluator/Eval.hpp"
+#include "evaluator/Limits.hpp"
+#include "evaluator/Stats.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "semantic/Escape.hpp"
+
+using namespace miniml;
+
+// let h0 = \x -> x + 1 in ... let h<i> = \x -> h<i-1> x + h<i-1> x in ...
+// followed by 'body': calling h<n-1> costs 2^n calls
+static std::string doubling(int n, const std::string& body) {
+    std::string src = "let h0 = \\x -> x + 1 in\n";
+    for (int i = 1; i < n; ++i) {
+        auto prev = "h" + std::to_string(i - 1);
+        src += "let h" + std::to_string(i) + " = \\x -> " + prev + " x + " + prev + " x in\n";
+    }
+    return src + body;
+}
+
+static std::string run(const std::string& src, bool lazy, EvalStats* stats = nullptr, EvalLimits* limits = nullptr) {
+    auto ast = parse_to_ast(src, "<test>");
+    analyzeEscapes(ast);
+    EvalContext ctx;
+    ctx.lazy = lazy;
+    ctx.stats = stats;
+    ctx.limits = limits;
+    Val v = eval(ast, prelude(), ctx);
+    if (lazy) forceAll(v);
+    return showVal(v);
+}
+
+TEST(Lazy, UnneededBindingsAreNotEvaluated) {
+    auto src = doubling(18, "let costly = h17 1 in\n"
+                            "let cheap = h2 1 in\n"
+                            "let pair = (costly, cheap + 1) in\n"
+                            "if cheap < 10 then cheap else costly");
+    EXPECT_EQ(run(src, false), "8");
+
+    EvalStats stats;
+    EvalLimits limits;
+    limits.fuel = 10000;   // far below what h17 takes
+    EXPECT_EQ(run(src, true, &stats, &limits), "8");
+    EXPECT_EQ(stats.thunksForced, 1u);
+    EXPECT_EQ((*stats.heap)[HeapKind::Thunk].count, 3u);   // costly, cheap and cheap + 1
+
+    EvalLimits strict;
+    strict.fuel = 10000;
+    EXPECT_THROW(run(src, false, nullptr, &strict), FuelExhausted);
+}
+
+TEST(Lazy, BindingsAreForcedAtMostOnce) {
+    auto src = doubling(12, "let a = h11 1 in\n"
+                            "let b = a in\n"
+                            "(a + b, b, a = b, (a, 1) = (0, a))");
+    EvalStats eager;
+    auto expected = run(src, false, &eager);
+    EXPECT_EQ(expected, "(8192, 4096, true, false)");
+
+    EvalStats stats;
+    EXPECT_EQ(run(src, true, &stats), expected);
+    EXPECT_EQ(stats.thunksForced, 4u);   // a, a + b, a = b and (a, 1) = (0, a)
+    EXPECT_LE(stats.lookups, eager.lookups + 8);
+
+    // tuple elements compared away are never needed
+    EvalStats compared;
+    EXPECT_EQ(run(doubling(20, "(1, h19 0) = (2, h19 0)"), true, &compared), "false");
+    EXPECT_EQ(compared.thunksForced, 0u);
+}
+
+TEST(Lazy, SameValuesOnGeneratedPrograms) {
+    using namespace miniml::bench;
+    for (auto shape : {ProgramShape::DeepLets, ProgramShape::WideTuples, ProgramShape::Polymorphic,
+                       ProgramShape::Curried, ProgramShape::Mixed}) {
+        for (std::uint64_t seed = 1; seed <= 3; ++seed) {
+            auto src = generateProgram({shape, 120, seed});
+            EXPECT_EQ(run(src, true), run(src, false)) << shapeName(shape) << " " << seed;
+        }
+    }
+}
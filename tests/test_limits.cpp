@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "evaluator/Eval.hpp"
+#include "evaluator/Limits.hpp"
+#include "evaluator/Stats.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+static const SrcLoc Inc{"<test>", 2, 13};
+
+// let twice = \f -> \x -> f (f x) in let inc = \n -> n + 1 in twice (twice ... inc) 0:
+// 2^k calls of inc, nested k deep
+static ExprPtr program(int k) {
+    ExprPtr fn = var("inc", L);
+    for (int i = 0; i < k; ++i) fn = app(var("twice", L), fn, L);
+    auto twice = lam("f", lam("x", app(var("f", L), app(var("f", L), var("x", L), L), L), L), L);
+    auto inc = lam("n", binop(BinOp::Add, var("n", L), lit_int(1, Inc), Inc), L);
+    return let_("twice", twice, let_("inc", inc, app(fn, lit_int(0, L), L), L), L);
+}
+
+static Val run(const ExprPtr& e, EvalLimits& limits) {
+    EvalContext ctx;
+    ctx.limits = &limits;
+    return eval(e, prelude(), ctx);
+}
+
+TEST(Limits, GenerousLimitsDoNotChangeTheResult) {
+    EvalLimits limits;
+    limits.fuel = 1'000'000;
+    limits.setTimeout(std::chrono::seconds(60));
+    limits.maxHeapBytes = 1 << 24;
+    limits.maxDepth = 1000;
+    EXPECT_EQ(showVal(run(program(6), limits)), "64");
+    EXPECT_GT(limits.steps, 64u);
+    EXPECT_EQ(limits.depth, 0u);
+    EXPECT_EQ(limits.heap->liveBytes, 0);
+}
+
+TEST(Limits, FuelRunsOutAtTheExactStep) {
+    EvalLimits probe;
+    run(program(4), probe);
+
+    EvalLimits exact;
+    exact.fuel = probe.steps;
+    EXPECT_EQ(showVal(run(program(4), exact)), "16");
+
+    EvalLimits less;
+    less.fuel = probe.steps - 1;
+    EXPECT_THROW(run(program(4), less), FuelExhausted);
+    EXPECT_EQ(less.depth, 0u);
+}
+
+TEST(Limits, EachLimitHasItsOwnError) {
+    EvalLimits depth;
+    depth.maxDepth = 10;
+    EXPECT_THROW(run(program(6), depth), DepthLimitExceeded);
+
+    EvalLimits heap;
+    heap.maxHeapBytes = 256;
+    EXPECT_THROW(run(program(6), heap), HeapLimitExceeded);
+
+    EvalLimits deadline;
+    deadline.deadline = std::chrono::steady_clock::now();
+    EXPECT_THROW(run(program(6), deadline), DeadlineExceeded);
+}
+
+TEST(Limits, ErrorCarriesTheSourceLocation) {
+    EvalLimits limits;
+    limits.fuel = 1000;
+    try {
+        run(program(12), limits);
+        FAIL() << "expected FuelExhausted";
+    } catch (const EvalLimitError& e) {
+        EXPECT_EQ(e.loc.file, "<test>");
+        std::string prefix = e.loc.file + ":" + std::to_string(e.loc.line) + ":" + std::to_string(e.loc.col) + ": ";
+        EXPECT_EQ(std::string(e.what()).rfind(prefix, 0), 0u) << e.what();
+    }
+}
+
+TEST(Limits, CancelledFromAnotherThread) {
+    auto e = program(40);   // 2^40 calls: only cancellation stops it
+    CancellationToken token;
+    EvalStats stats;
+    EvalContext ctx;
+    ctx.cancel = &token;
+    ctx.stats = &stats;
+
+    bool cancelled = false;
+    std::thread worker([&] {
+        try {
+            eval(e, prelude(), ctx);
+        } catch (const EvalCancelled& ex) {
+            cancelled = ex.loc.file == "<test>";
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    token.cancel();
+    worker.join();
+
+    EXPECT_TRUE(cancelled);
+    EXPECT_EQ(stats.heap->liveBytes, 0);   // every closure, tuple and frame was released
+    EXPECT_EQ(stats.depth, 0u);
+}
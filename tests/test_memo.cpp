@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "evaluator/Eval.hpp"
+#include "evaluator/Memo.hpp"
+#include "evaluator/Profiler.hpp"
+#include "semantic/Escape.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+static ExprPtr memoLam(std::string x, ExprPtr body, bool memo) {
+    auto e = lam(std::move(x), std::move(body), L);
+    std::get<ELam>(*e).memo = memo;
+    return e;
+}
+
+// let h0 = \x -> x + 1 in let h1 = \x -> h0 x + h0 x in ... in h<n-1> 1:
+// 2^n - 1 calls, n distinct ones
+static ExprPtr doubling(int n, bool memo) {
+    ExprPtr body = app(var("h" + std::to_string(n - 1), L), lit_int(1, L), L);
+    for (int i = n - 1; i >= 0; --i) {
+        auto x = var("x", L);
+        ExprPtr rhs;
+        if (i == 0) {
+            rhs = binop(BinOp::Add, x, lit_int(1, L), L);
+        } else {
+            auto prev = "h" + std::to_string(i - 1);
+            rhs = binop(BinOp::Add, app(var(prev, L), x, L), app(var(prev, L), var("x", L), L), L);
+        }
+        body = let_("h" + std::to_string(i), memoLam("x", rhs, memo), body, L);
+    }
+    analyzeEscapes(body);
+    return body;
+}
+
+static Val run(const ExprPtr& e, CallMemo* memo, Profiler* profiler = nullptr) {
+    EvalContext ctx;
+    ctx.memo = memo;
+    ctx.profiler = profiler;
+    return eval(e, prelude(), ctx);
+}
+
+TEST(Memo, AnnotatedCallsAreAnsweredFromTheCache) {
+    auto e = doubling(24, true);
+    CallMemo memo;
+    EXPECT_EQ(showVal(run(e, &memo)), std::to_string(1 << 24));
+    auto c = memo.counters();
+    EXPECT_EQ(c.misses, 24u);   // one call per function gets through
+    EXPECT_EQ(c.hits, 23u);
+    EXPECT_EQ(c.entries, 24u);
+
+    // unannotated lambdas are called every time
+    CallMemo unused;
+    EXPECT_EQ(showVal(run(doubling(12, false), &unused)), std::to_string(1 << 12));
+    EXPECT_EQ(unused.counters().hits + unused.counters().misses, 0u);
+}
+
+TEST(Memo, KeysAreClosureAndArgument) {
+    // let add = \k -> [@memo] \x -> (x, k) in let a = add 1 in let b = add 2 in
+    // (a 5, b 5, a 5, a (5 + 1), b 5)
+    auto pair = lit_tuple({var("x", L), var("k", L)}, L);
+    auto add = lam("k", memoLam("x", pair, true), L);
+    auto five = [] { return lit_int(5, L); };
+    auto tuple = lit_tuple({app(var("a", L), five(), L), app(var("b", L), five(), L), app(var("a", L), five(), L),
+                            app(var("a", L), binop(BinOp::Add, five(), lit_int(1, L), L), L),
+                            app(var("b", L), five(), L)}, L);
+    auto e = let_("add", add, let_("a", app(var("add", L), lit_int(1, L), L),
+                  let_("b", app(var("add", L), lit_int(2, L), L), tuple, L), L), L);
+    analyzeEscapes(e);
+    CallMemo memo;
+    EXPECT_EQ(showVal(run(e, &memo)), "((5, 1), (5, 2), (5, 1), (6, 1), (5, 2))");
+    EXPECT_EQ(memo.counters().misses, 3u);
+    EXPECT_EQ(memo.counters().hits, 2u);
+
+    // tuples are compared by structure
+    auto t = [] { return lit_tuple({lit_int(1, L), lit_tuple({lit_bool(true, L), lit_int(2, L)}, L)}, L); };
+    auto fst = memoLam("p", lit_int(7, L), true);
+    e = let_("f", fst, lit_tuple({app(var("f", L), t(), L), app(var("f", L), t(), L)}, L), L);
+    analyzeEscapes(e);
+    CallMemo tuples;
+    EXPECT_EQ(showVal(run(e, &tuples)), "(7, 7)");
+    EXPECT_EQ(tuples.counters().hits, 1u);
+}
+
+TEST(Memo, CacheIsBounded) {
+    auto e = doubling(16, true);
+    CallMemo memo(4);
+    EXPECT_EQ(showVal(run(e, &memo)), std::to_string(1 << 16));
+    auto c = memo.counters();
+    EXPECT_EQ(c.entries, 4u);
+    EXPECT_EQ(c.evictions, c.misses - 4);
+    EXPECT_GT(c.hits, 0u);
+}
+
+TEST(Memo, HotLambdas) {
+    auto e = doubling(20, false);
+    CallMemo automatic(kDefaultMemoEntries, 3);
+    EXPECT_EQ(showVal(run(e, &automatic)), std::to_string(1 << 20));
+    EXPECT_GT(automatic.counters().hits, 0u);
+    EXPECT_LT(automatic.counters().misses, 100u);
+
+    // from the profile of an earlier run: h0 is called most
+    auto small = doubling(10, false);
+    Profiler profiler;
+    run(small, nullptr, &profiler);
+    CallMemo fromProfile;
+    EXPECT_EQ(fromProfile.memoizeHot(profiler, 1), 1u);
+    EXPECT_EQ(showVal(run(small, &fromProfile)), std::to_string(1 << 10));
+    EXPECT_EQ(fromProfile.counters().misses, 1u);
+    EXPECT_EQ(fromProfile.counters().hits, (1u << 9) - 1);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "evaluator/Eval.hpp"
+#include "semantic/Parallel.hpp"
+#include "utils/WorkStealingPool.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+// let twice = \f -> \x -> f (f x) in let inc = \n -> n + 1 in
+// let work = \k -> twice twice twice inc k in (work 1, ..., work n)
+static ExprPtr program(int n) {
+    auto twice = lam("f", lam("x", app(var("f", L), app(var("f", L), var("x", L), L), L), L), L);
+    auto inc = lam("n", binop(BinOp::Add, var("n", L), lit_int(1, L), L), L);
+    ExprPtr call = var("twice", L);
+    for (auto f : {"twice", "twice", "inc", "k"}) call = app(call, var(f, L), L);
+    std::vector<ExprPtr> elems;
+    for (int i = 1; i <= n; ++i) elems.push_back(app(var("work", L), lit_int(i, L), L));
+    return let_("twice", twice, let_("inc", inc, let_("work", lam("k", call, L),
+                lit_tuple(elems, L), L), L), L);
+}
+
+static Val run(const ExprPtr& e, WorkStealingPool* pool) {
+    EvalContext ctx;
+    ctx.pool = pool;
+    return eval(e, prelude(), ctx);
+}
+
+TEST(Parallel, MarksCostlyIndependentWork) {
+    auto e = program(8);
+    EXPECT_EQ(analyzeParallelism(e).forks, 7);   // the last element stays on the forking thread
+
+    auto& tuple = std::get<ELitTuple>(*std::get<ELet>(*std::get<ELet>(*std::get<ELet>(*e).body).body).body);
+    ASSERT_EQ(tuple.fork.size(), 8u);
+    EXPECT_TRUE(tuple.fork[0]);
+    EXPECT_FALSE(tuple.fork[7]);
+
+    auto cheap = lit_tuple({lit_int(1, L), lit_int(2, L)}, L);
+    EXPECT_EQ(analyzeParallelism(cheap).forks, 0);
+    EXPECT_TRUE(std::get<ELitTuple>(*cheap).fork.empty());
+}
+
+TEST(Parallel, ForkedResultsMatchSequential) {
+    auto e = program(8);
+    auto expected = showVal(run(e, nullptr));
+    EXPECT_EQ(expected, "(17, 18, 19, 20, 21, 22, 23, 24)");
+
+    analyzeParallelism(e, 1);   // fork everything that can be
+    WorkStealingPool pool(3);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(showVal(run(e, &pool)), expected);
+}
+
+TEST(Parallel, EarliestErrorWins) {
+    // (0, 1 0, 2 0, 3 0): elements 1..3 apply an Int; each fails at its own column
+    std::vector<ExprPtr> elems{lit_int(0, L)};
+    for (int i = 1; i <= 3; ++i) elems.push_back(app(lit_int(i, L), lit_int(0, L), SrcLoc{"<test>", 2, i}));
+    auto e = lit_tuple(elems, L);
+    analyzeParallelism(e, 1);
+
+    WorkStealingPool pool(3);
+    for (int i = 0; i < 5; ++i) {
+        try {
+            run(e, &pool);
+            FAIL() << "no error";
+        } catch (const std::runtime_error& err) {
+            EXPECT_EQ(std::string(err.what()), "<test>:2:1: runtime: trying to call a non-function");
+        }
+    }
+}
+
+TEST(Parallel, PoolJoinsAndPropagatesErrors) {
+    WorkStealingPool pool(2);
+    EXPECT_EQ(pool.threads(), 2u);
+
+    int a = 0, b = 0;
+    WorkStealingPool::Task ta([&] { a = 1; });
+    WorkStealingPool::Task tb([&] { b = 2; });
+    pool.fork(ta);
+    pool.fork(tb);
+    pool.join(tb);
+    pool.join(ta);
+    EXPECT_EQ(a + b, 3);
+
+    WorkStealingPool::Task bad([] { throw std::runtime_error("boom"); });
+    pool.fork(bad);
+    EXPECT_THROW(pool.join(bad), std::runtime_error);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "utils/PhaseTimer.hpp"
+
+using namespace miniml;
+
+static AllocCounts fakeAllocs() {
+    static std::uint64_t calls = 0;
+    ++calls;
+    return {calls, 16 * calls};
+}
+
+TEST(PhaseTimer, NestedPhasesKeepStartOrder) {
+    PhaseTimer timer;
+    {
+        PhaseTimer::Scope parse(&timer, "parse");
+        { PhaseTimer::Scope lex(&timer, "lex"); }
+        { PhaseTimer::Scope ast(&timer, "build_ast"); }
+    }
+    { PhaseTimer::Scope infer(&timer, "infer"); }
+
+    auto& p = timer.phases();
+    ASSERT_EQ(p.size(), 4u);
+    EXPECT_EQ(p[0].name, "parse");
+    EXPECT_EQ(p[0].depth, 0);
+    EXPECT_EQ(p[1].name, "lex");
+    EXPECT_EQ(p[1].depth, 1);
+    EXPECT_EQ(p[2].depth, 1);
+    EXPECT_EQ(p[3].name, "infer");
+    EXPECT_EQ(p[3].depth, 0);
+    EXPECT_GE(p[0].wallMs, p[1].wallMs + p[2].wallMs);
+    EXPECT_FALSE(timer.countsAllocations());
+}
+
+TEST(PhaseTimer, AllocationsAreDifferences) {
+    PhaseTimer timer(fakeAllocs);
+    { PhaseTimer::Scope s(&timer, "eval"); }
+    ASSERT_EQ(timer.phases().size(), 1u);
+    EXPECT_EQ(timer.phases()[0].allocs, 1u);
+    EXPECT_EQ(timer.phases()[0].allocBytes, 16u);
+}
+
+TEST(PhaseTimer, NullTimerIsANoOp) {
+    PhaseTimer::Scope s(nullptr, "parse");   // what the driver does without --time-phases
+    SUCCEED();
+}
+
+TEST(PhaseTimer, Json) {
+    PhaseTimer timer;
+    { PhaseTimer::Scope s(&timer, "infer"); }
+    auto json = timer.json();
+    EXPECT_EQ(json.rfind("{\"phases\":[{\"name\":\"infer\",\"depth\":0,\"wall_ms\":", 0), 0u);
+    EXPECT_NE(json.find("\"rss_delta_kb\":"), std::string::npos);
+    EXPECT_NE(json.find("\"counts_allocations\":false}"), std::string::npos);
+}
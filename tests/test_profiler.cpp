@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "evaluator/Eval.hpp"
+#include "evaluator/Profiler.hpp"
+
+using namespace miniml;
+
+static SrcLoc at(int line, int col) { return SrcLoc{"<test>", line, col}; }
+
+// let f = \x -> x + 1 in f (f 1)
+static ExprPtr program() {
+    auto f = lam("x", binop(BinOp::Add, var("x", at(2, 14)), lit_int(1, at(2, 18)), at(2, 16)), at(2, 9));
+    return let_("f", f, app(var("f", at(3, 1)), app(var("f", at(3, 4)), lit_int(1, at(3, 6)), at(3, 4)), at(3, 1)),
+                at(1, 1));
+}
+
+TEST(Profiler, CountsNodesAndCalls) {
+    auto e = program();
+    Profiler prof;
+    EvalContext ctx;
+    ctx.profiler = &prof;
+    EXPECT_EQ(showVal(eval(e, prelude(), ctx)), "3");
+
+    auto rows = prof.byLocation();
+    auto find = [&](int line, int col, const std::string& kind) -> const Profiler::NodeStats* {
+        for (auto& r : rows)
+            if (r.loc.line == line && r.loc.col == col && r.kind == kind) return &r;
+        return nullptr;
+    };
+    auto add = find(2, 16, "binop");
+    ASSERT_NE(add, nullptr);
+    EXPECT_EQ(add->count, 2u);
+    auto root = find(1, 1, "let");
+    ASSERT_NE(root, nullptr);
+    EXPECT_EQ(root->count, 1u);
+    EXPECT_GE(root->inclusiveNs, add->inclusiveNs);
+
+    auto calls = prof.lambdaCalls();
+    ASSERT_EQ(calls.size(), 1u);
+    EXPECT_EQ(calls[0].calls, 2u);
+    EXPECT_EQ(calls[0].loc.line, 2);
+}
+
+TEST(Profiler, FoldedStacksNameLambdas) {
+    auto e = program();
+    Profiler prof;
+    EvalContext ctx;
+    ctx.profiler = &prof;
+    eval(e, prelude(), ctx);
+
+    auto folded = prof.folded();
+    EXPECT_EQ(folded.rfind("main ", 0), 0u);
+    EXPECT_NE(folded.find("\nmain;lambda_2_9 "), std::string::npos);
+}
+
+TEST(Profiler, OffByDefault) {
+    EvalContext ctx;
+    EXPECT_EQ(ctx.profiler, nullptr);
+    EXPECT_EQ(showVal(eval(program(), prelude(), ctx)), "3");
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include "ProgramGen.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "semantic/ScopeCheck.hpp"
+#include "types/Infer.hpp"
+#include "evaluator/Eval.hpp"
+
+using namespace miniml;
+using namespace miniml::bench;
+
+static const ProgramShape kShapes[] = {ProgramShape::DeepLets, ProgramShape::WideTuples, ProgramShape::Polymorphic,
+                                       ProgramShape::Curried, ProgramShape::Mixed};
+
+TEST(ProgramGen, SameSeedSameProgram) {
+    for (auto shape : kShapes) {
+        GenOptions o{shape, 50, 7};
+        EXPECT_EQ(generateProgram(o), generateProgram(o)) << shapeName(shape);
+        GenOptions other{shape, 50, 8};
+        EXPECT_NE(generateProgram(o), generateProgram(other)) << shapeName(shape);
+    }
+}
+
+TEST(ProgramGen, ProgramsAreWellTypedAndRun) {
+    for (auto shape : kShapes) {
+        for (std::uint64_t seed = 1; seed <= 5; ++seed) {
+            auto code = generateProgram(GenOptions{shape, 40, seed});
+            SCOPED_TRACE(std::string(shapeName(shape)) + " seed " + std::to_string(seed));
+            auto ast = parse_to_ast(code, "<gen>");
+            ScopeChecker().check(ast);
+            TypeEnv gamma;
+            auto r = infer(ast, gamma);
+            EXPECT_EQ(apply_type(r.subst, r.type)->k, TKind::INT);
+            EXPECT_NO_THROW(eval(ast, prelude()));
+        }
+    }
+}
+
+TEST(ProgramGen, ShapeNamesRoundTrip) {
+    for (auto shape : kShapes) {
+        ProgramShape parsed;
+        ASSERT_TRUE(parseShape(shapeName(shape), parsed));
+        EXPECT_EQ(parsed, shape);
+    }
+    ProgramShape parsed;
+    EXPECT_FALSE(parseShape("bushy", parsed));
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "evaluator/Eval.hpp"
+#include "evaluator/Stats.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "semantic/Escape.hpp"
+#include "semantic/LastUse.hpp"
+
+using namespace miniml;
+
+// The reads of variables in 'e', in source order, as "name" or "name!" for a last use.
+static void reads(const Expr& e, std::string& out) {
+    std::visit([&](auto const& n) {
+        using T = std::decay_t<decltype(n)>;
+        if constexpr (std::is_same_v<T, EVar>) {
+            out += n.name + (n.lastUse ? "! " : " ");
+        } else if constexpr (std::is_same_v<T, ELitTuple>) {
+            for (auto& el : n.elems) reads(*el, out);
+        } else if constexpr (std::is_same_v<T, ELam>) {
+            reads(*n.body, out);
+        } else if constexpr (std::is_same_v<T, EApp>) {
+            reads(*n.fn, out);
+            reads(*n.arg, out);
+        } else if constexpr (std::is_same_v<T, ELet>) {
+            reads(*n.rhs, out);
+            reads(*n.body, out);
+        } else if constexpr (std::is_same_v<T, EIf>) {
+            reads(*n.cond, out);
+            reads(*n.thenE, out);
+            reads(*n.elseE, out);
+        } else if constexpr (std::is_same_v<T, EUnOp>) {
+            reads(*n.expr, out);
+        } else if constexpr (std::is_same_v<T, EBinOp>) {
+            reads(*n.lhs, out);
+            reads(*n.rhs, out);
+        }
+    }, e);
+}
+
+static std::string lastUses(const std::string& src) {
+    auto ast = parse_to_ast(src, "<test>");
+    analyzeLastUses(ast);
+    std::string out;
+    reads(*ast, out);
+    return out;
+}
+
+TEST(Reuse, LastUses) {
+    EXPECT_EQ(lastUses("let p = (1, 2) in let q = p in (q, q)"), "p! q q! ");
+    // either branch may be the last to read x, but not the condition
+    EXPECT_EQ(lastUses("let x = 1 in if x < 2 then x else 3"), "x x! ");
+    EXPECT_EQ(lastUses("let x = 1 in (if x < 2 then 0 else x, x)"), "x x x! ");
+    // read by a closure: never moved; the parameter inside is
+    EXPECT_EQ(lastUses("let x = 1 in let f = \\y -> x + y in (f 1, x)"), "x y! f! x ");
+    // shadowing: the inner x is dead after its read, the outer one is read later
+    EXPECT_EQ(lastUses("let x = 1 in (let x = 2 in x, x)"), "x! x! ");
+    // free variables belong to someone else
+    EXPECT_EQ(lastUses("\\a -> (a, b)"), "a! b ");
+}
+
+static std::string run(const std::string& src, EvalStats* stats) {
+    auto ast = parse_to_ast(src, "<test>");
+    analyzeEscapes(ast);
+    analyzeLastUses(ast);
+    EvalContext ctx;
+    ctx.stats = stats;
+    return showVal(eval(ast, prelude(), ctx));
+}
+
+TEST(Reuse, DeadTuplesHoldTheNextOnes) {
+    // each step hands its only reference to the tuple on to 'next', which
+    // compares it and builds a new one of the same arity
+    std::string src = "let next = \\p -> if p = (0, 0) then (1, 2) else (0, 0) in\nlet t0 = (0, 0) in\n";
+    for (int i = 1; i <= 40; ++i)
+        src += "let t" + std::to_string(i) + " = next t" + std::to_string(i - 1) + " in\n";
+    src += "t40";
+    EvalStats stats;
+    EXPECT_EQ(run(src, &stats), "(0, 0)");
+    auto& tuples = (*stats.heap)[HeapKind::Tuple];
+    EXPECT_EQ(tuples.count, 41u);
+    EXPECT_GE(tuples.reused, 40u);
+
+    // without last uses every t<i> lives as long as its frame
+    auto ast = parse_to_ast(src, "<test>");
+    analyzeEscapes(ast);
+    EvalStats kept;
+    EvalContext ctx;
+    ctx.stats = &kept;
+    eval(ast, prelude(), ctx);
+    EXPECT_GT(kept.heap->peakLiveBytes, 10 * stats.heap->peakLiveBytes);
+}
+
+TEST(Reuse, SharedValuesAcrossThreads) {
+    auto ast = parse_to_ast("let k = \\x -> \\y -> (x, y) in let f = k (1, true) in f", "<test>");
+    Val fn = eval(ast, prelude());
+    auto env = prelude();
+    env->m["f"] = fn;
+    markShared(*env);
+    auto call = parse_to_ast("(f 1, f 2)", "<test>");
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&] {
+            for (int i = 0; i < 2000; ++i) EXPECT_EQ(showVal(eval(call, env)), "(((1, true), 1), ((1, true), 2))");
+        });
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(std::get<Ref<Closure>>(fn).use_count(), 2);   // here and in the prelude frame
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "evaluator/Eval.hpp"
+#include "evaluator/Limits.hpp"
+#include "evaluator/Machine.hpp"
+#include "evaluator/Scheduler.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+// let twice = \f -> \x -> f (f x) in let inc = \n -> n + 1 in twice (twice ... inc) 0:
+// 2^k calls of inc, nested k deep
+static ExprPtr program(int k) {
+    ExprPtr fn = var("inc", L);
+    for (int i = 0; i < k; ++i) fn = app(var("twice", L), fn, L);
+    auto twice = lam("f", lam("x", app(var("f", L), app(var("f", L), var("x", L), L), L), L), L);
+    auto inc = lam("n", binop(BinOp::Add, var("n", L), lit_int(1, L), L), L);
+    return let_("twice", twice, let_("inc", inc, app(fn, lit_int(0, L), L), L), L);
+}
+
+// let p = (program k, k < 3 || false, not (1 = 2)) in if p = p then p else (0, false, false)
+static ExprPtr mixed(int k) {
+    auto t = lit_tuple({program(k), binop(BinOp::Or, binop(BinOp::Lt, lit_int(k, L), lit_int(3, L), L),
+                                          lit_bool(false, L), L),
+                        unop(UnOp::Not, binop(BinOp::Eq, lit_int(1, L), lit_int(2, L), L), L)}, L);
+    auto other = lit_tuple({lit_int(0, L), lit_bool(false, L), lit_bool(false, L)}, L);
+    return let_("p", t, if_(binop(BinOp::Eq, var("p", L), var("p", L), L), var("p", L), other, L), L);
+}
+
+TEST(Machine, ResumesToTheResultOfEval) {
+    for (int k : {0, 2, 5}) {
+        auto e = mixed(k);
+        auto expected = showVal(eval(e, prelude()));
+
+        Machine all(e, prelude());
+        EXPECT_TRUE(all.resume(SIZE_MAX));
+        EXPECT_EQ(showVal(all.result()), expected);
+
+        Machine stepwise(e, prelude());
+        std::size_t turns = 0;
+        while (!stepwise.resume(1)) ++turns;
+        EXPECT_EQ(showVal(stepwise.result()), expected);
+        EXPECT_EQ(stepwise.steps(), all.steps());
+        EXPECT_GT(turns, 10u);
+    }
+}
+
+TEST(Machine, FailsLikeEval) {
+    auto e = app(lit_int(1, L), lit_int(2, SrcLoc{"<test>", 1, 3}), SrcLoc{"<test>", 1, 2});
+    Machine m(e, prelude());
+    try {
+        m.resume(100);
+        FAIL() << "no error";
+    } catch (const std::runtime_error& err) {
+        EXPECT_EQ(std::string(err.what()), "<test>:1:2: runtime: trying to call a non-function");
+    }
+
+    CancellationToken token;
+    token.cancel();
+    Machine cancelled(program(3), prelude(), &token);
+    EXPECT_THROW(cancelled.resume(SIZE_MAX), EvalCancelled);
+}
+
+TEST(Scheduler, ShortEvaluationsAreNotStuckBehindLongOnes) {
+    Scheduler scheduler(1, 1000);
+    auto slow = scheduler.submit(program(20), prelude());
+    std::vector<Scheduler::Handle> quick;
+    for (int i = 0; i < 100; ++i) quick.push_back(scheduler.submit(program(i % 4), prelude()));
+
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(showVal(quick[i].get()), std::to_string(1 << (i % 4)));
+    EXPECT_FALSE(slow.done());
+    EXPECT_GE(scheduler.inFlight(), 1u);
+
+    slow.cancel();
+    EXPECT_THROW(slow.get(), EvalCancelled);
+    EXPECT_TRUE(slow.done());
+}
+
+TEST(Scheduler, HandlesCanBeResumedAndOutliveTheScheduler) {
+    Scheduler::Handle h = [] {
+        Scheduler scheduler(2, 64);
+        auto a = scheduler.submit(program(6), prelude());
+        while (!a.resume(16)) {}
+        EXPECT_EQ(showVal(a.get()), "64");
+        EXPECT_GT(scheduler.slices(), 1u);
+        return scheduler.submit(program(24), prelude());   // cancelled by ~Scheduler
+    }();
+    EXPECT_TRUE(h.done());
+    EXPECT_TRUE(h.resume(16));   // must not reach the destroyed scheduler
+    h.cancel();
+    EXPECT_THROW(h.get(), EvalCancelled);
+}
@@ -0,0 +1,13 @@
+#include <gtest/gtest.h>
+#include "ast/Nodes.hpp"
+#include "semantic/ScopeCheck.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+TEST(ScopeCheck, TupleElements) {
+    EXPECT_NO_THROW(ScopeChecker().check(lam("x", lit_tuple({var("x", L), lit_int(1, L)}, L), L)));
+    EXPECT_THROW(ScopeChecker().check(lit_tuple({lit_int(1, L), var("y", L)}, L)), ScopeError);
+    EXPECT_THROW(ScopeChecker().check(lit_tuple({lit_tuple({var("y", L)}, L)}, L)), ScopeError);
+}
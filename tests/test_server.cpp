@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include "driver/Server.hpp"
+
+using namespace miniml;
+
+static std::string request(const std::string& code, const std::string& file = "a.ml") {
+    return "RUN " + std::to_string(code.size()) + " " + file + "\n" + code;
+}
+
+static std::vector<std::string> lines(const std::string& s) {
+    std::vector<std::string> out;
+    std::istringstream in(s);
+    for (std::string l; std::getline(in, l);) out.push_back(l);
+    return out;
+}
+
+TEST(Server, AnswersTypeAndValueAndCachesRepeats) {
+    Pipeline pipeline;
+    CompileServer server(pipeline);
+    std::istringstream in(request("let id = \\x -> x in id 42") + request("let id = \\x -> x in id 42") +
+                          request("(1, true)", "b.ml") + "STATS\nQUIT\n" + request("1"));
+    std::ostringstream out;
+    server.serve(in, out);
+
+    auto r = lines(out.str());
+    ASSERT_EQ(r.size(), 4u);   // nothing after QUIT
+    EXPECT_EQ(r[0].rfind("{\"status\":\"ok\",\"type\":\"Int\",\"value\":\"42\",\"cached\":false,\"latency_us\":", 0), 0u)
+        << r[0];
+    EXPECT_NE(r[1].find("\"cached\":true"), std::string::npos) << r[1];
+    EXPECT_NE(r[2].find("\"value\":\"(1, true)\""), std::string::npos) << r[2];
+    EXPECT_EQ(r[3].rfind("{\"requests\":3,\"cache_hits\":1,\"cache_entries\":2,", 0), 0u) << r[3];
+}
+
+TEST(Server, TypesHaveTheFinalSubstitutionApplied) {
+    // y's type is fixed only by the second tuple element
+    Pipeline pipeline;
+    CompileServer server(pipeline);
+    std::istringstream in(request("\\y -> (y, y + 1)"));
+    std::ostringstream out;
+    server.serve(in, out);
+
+    auto r = lines(out.str());
+    ASSERT_EQ(r.size(), 1u);
+    EXPECT_NE(r[0].find("\"type\":\"Int -> (Int, Int)\""), std::string::npos) << r[0];
+    EXPECT_EQ(pipeline.run("\\y -> (y, y + 1)", "b.ml").type, "Int -> (Int, Int)");
+}
+
+TEST(Server, ReportsErrorsPerRequest) {
+    RunOptions opts;
+    opts.fuel = 10;
+    Pipeline pipeline(opts);
+    CompileServer server(pipeline);
+    std::istringstream in(request("1 + true") + request("y") + "HELLO\n" +
+                          request("let f = \\x -> x + 1 in f (f (f (f (f 1))))") + "RUN x\n");
+    std::ostringstream out;
+    server.serve(in, out);
+
+    auto r = lines(out.str());
+    ASSERT_EQ(r.size(), 5u);
+    EXPECT_EQ(r[0].rfind("{\"status\":\"type_error\",\"error\":\"a.ml:1:", 0), 0u) << r[0];
+    EXPECT_EQ(r[1].rfind("{\"status\":\"scope_error\",", 0), 0u) << r[1];
+    EXPECT_EQ(r[2].rfind("{\"status\":\"bad_request\",", 0), 0u) << r[2];
+    EXPECT_EQ(r[3].rfind("{\"status\":\"limit_error\",\"type\":\"Int\",", 0), 0u) << r[3];
+    EXPECT_EQ(r[4].rfind("{\"status\":\"bad_request\",", 0), 0u) << r[4];
+}
+
+TEST(Server, RejectsOversizedProgramsAndGoesOn) {
+    // the body of a rejected RUN is not read, so the next line is the next request
+    Pipeline pipeline;
+    CompileServer server(pipeline);
+    std::istringstream in("RUN 1000000000000000 big.ml\n" + request("(1, 2) = (1, 2)"));
+    std::ostringstream out;
+    server.serve(in, out);
+
+    auto r = lines(out.str());
+    ASSERT_EQ(r.size(), 2u);
+    EXPECT_EQ(r[0].rfind("{\"status\":\"bad_request\",\"error\":\"program longer than ", 0), 0u) << r[0];
+    EXPECT_NE(r[1].find("\"value\":\"true\""), std::string::npos) << r[1];
+
+    CompileServer small(pipeline, 256, 16);
+    std::istringstream in2("RUN 22\n" + request("7"));
+    std::ostringstream out2;
+    small.serve(in2, out2);
+    r = lines(out2.str());
+    ASSERT_EQ(r.size(), 2u);
+    EXPECT_EQ(r[0].rfind("{\"status\":\"bad_request\",\"error\":\"program longer than 16 bytes\"", 0), 0u) << r[0];
+    EXPECT_NE(r[1].find("\"value\":\"7\""), std::string::npos) << r[1];
+}
+
+TEST(Server, CacheEvictsLeastRecentlyUsed) {
+    ResultCache cache(2);
+    cache.insert("f", "1", RunResult{RunResult::Status::Ok, "Int", "1", ""});
+    cache.insert("f", "2", RunResult{RunResult::Status::Ok, "Int", "2", ""});
+    ASSERT_NE(cache.find("f", "1"), nullptr);   // now most recent
+    cache.insert("f", "3", RunResult{RunResult::Status::Ok, "Int", "3", ""});
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.find("f", "2"), nullptr);
+    ASSERT_NE(cache.find("f", "1"), nullptr);
+    EXPECT_EQ(cache.find("f", "1")->value, "1");
+    EXPECT_EQ(cache.find("g", "1"), nullptr);   // the file name is part of the key
+}
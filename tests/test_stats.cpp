@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "evaluator/Eval.hpp"
+#include "evaluator/Stats.hpp"
+#include "semantic/Escape.hpp"
+
+using namespace miniml;
+
+static const SrcLoc L{"<test>", 1, 1};
+
+// let f = \x -> (x, x) in let p = f 1 in f 2 = p
+static ExprPtr program() {
+    auto f = lam("x", lit_tuple({var("x", L), var("x", L)}, L), L);
+    return let_("f", f,
+                let_("p", app(var("f", L), lit_int(1, L), L),
+                     binop(BinOp::Eq, app(var("f", L), lit_int(2, L), L), var("p", L), L), L), L);
+}
+
+TEST(Stats, CountsHeapObjectsPerKind) {
+    auto e = program();
+    EvalStats stats;
+    EvalContext ctx;
+    ctx.stats = &stats;
+    EXPECT_EQ(showVal(eval(e, prelude(), ctx)), "false");
+
+    EXPECT_EQ((*stats.heap)[HeapKind::Closure].count, 1u);
+    EXPECT_EQ((*stats.heap)[HeapKind::Tuple].count, 2u);
+    EXPECT_GE((*stats.heap)[HeapKind::Env].count, 4u);   // f, p and two calls
+    EXPECT_GT((*stats.heap)[HeapKind::Tuple].bytes, 2 * sizeof(Tuple));
+    EXPECT_GT(stats.heap->peakLiveBytes, 0);
+    EXPECT_GT(stats.lookups, 0u);
+    EXPECT_GE(stats.maxDepth, 4u);
+    EXPECT_EQ(stats.depth, 0u);
+}
+
+TEST(Stats, EscapeAnalysisMovesObjectsToTheStack) {
+    auto e = program();
+    analyzeEscapes(e);
+    EvalStats stats;
+    EvalContext ctx;
+    ctx.stats = &stats;
+    EXPECT_EQ(showVal(eval(e, prelude(), ctx)), "false");
+
+    EXPECT_EQ((*stats.heap)[HeapKind::Closure].count, 0u);
+    EXPECT_EQ(stats.stackClosures, 1u);
+    EXPECT_GT(stats.stackFrames, 0u);
+}
+
+TEST(Stats, JsonHasEverySection) {
+    EvalStats stats;
+    EvalContext ctx;
+    ctx.stats = &stats;
+    eval(program(), prelude(), ctx);
+
+    auto json = stats.json();
+    for (auto key : {"\"heap\"", "\"env_frames\"", "\"peak_live_bytes\"", "\"stack\"", "\"env_lookups\"",
+                     "\"avg_hops\"", "\"max_eval_depth\""})
+        EXPECT_NE(json.find(key), std::string::npos) << key;
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include "evaluator/Eval.hpp"
+#include "evaluator/Machine.hpp"
+#include "evaluator/Stats.hpp"
+#include "parser/parse_to_ast.hpp"
+#include "semantic/Escape.hpp"
+
+using namespace miniml;
+
+static Val run(const std::string& src, EvalContext& ctx) {
+    auto ast = parse_to_ast(src, "<test>");
+    analyzeEscapes(ast);
+    return eval(ast, prelude(), ctx);
+}
+
+static Val run(const std::string& src) {
+    EvalContext ctx;
+    return run(src, ctx);
+}
+
+TEST(Tuples, IntsAndBoolsAreFlat) {
+    Val v = run("let x = 2 in (1, x < 3, x, (x, false))");
+    auto& t = *std::get<Ref<Tuple>>(v);
+    EXPECT_FALSE(t.flat());   // holds a tuple
+    auto& inner = *std::get<Ref<Tuple>>(t.vals()[3]);
+    ASSERT_TRUE(inner.flat());
+    EXPECT_EQ(inner.bools(), 0b10u);
+    EXPECT_EQ(inner.words()[0], 2);
+    EXPECT_EQ(showVal(v), "(1, true, 2, (2, false))");
+
+    Val flat = run("(1, true, 3)");
+    EXPECT_TRUE(std::get<Ref<Tuple>>(flat)->flat());
+    EXPECT_EQ(std::get<bool>(std::get<Ref<Tuple>>(flat)->at(1)), true);
+    EXPECT_EQ(std::get<long>(std::get<Ref<Tuple>>(flat)->at(2)), 3);
+
+    // the resumable evaluator builds the same layout
+    Machine m(parse_to_ast("(4, false)", "<test>"), prelude());
+    while (!m.resume(1)) {}
+    EXPECT_TRUE(std::get<Ref<Tuple>>(m.result())->flat());
+}
+
+TEST(Tuples, OneAllocationEach) {
+    EvalStats stats;
+    EvalContext ctx;
+    ctx.stats = &stats;
+    run("let f = \\x -> (x, x, x) in (f 1, f 2)", ctx);
+    auto& tuples = (*stats.heap)[HeapKind::Tuple];
+    EXPECT_EQ(tuples.count, 3u);
+    EXPECT_EQ(tuples.bytes, 3 * sizeof(Tuple) + 8 * sizeof(Val));
+}
+
+TEST(Tuples, Comparison) {
+    EXPECT_EQ(showVal(run("let f = \\x -> (x, 2, true) in (f 1 = f 1, f 1 = f 2, f 1 <> (1, 2, false))")),
+              "(true, false, true)");
+    // boxed against flat: thunks in a lazy run, nested tuples
+    EvalContext lazy;
+    lazy.lazy = true;
+    EXPECT_EQ(showVal(run("let a = 1 + 1 in let t = (a, a < 3) in let f = \\x -> x in t = f (2, true)", lazy)), "true");
+    EXPECT_EQ(showVal(run("let f = \\x -> ((x, 1), x) in (f 1 = f 1, f 1 = f 2)")), "(true, false)");
+    // element types are still checked
+    EXPECT_THROW(run("let f = \\x -> x in f (1, 2) = f (1, true)"), std::runtime_error);
+}
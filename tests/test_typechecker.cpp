@@ -1,15 +1,31 @@
 #include <gtest/gtest.h>
-#include "types/TypeCheck.hpp"
 #include "ast/Nodes.hpp"
+#include "types/Infer.hpp"
+#include "types/Pretty.hpp"
 
 using namespace miniml;
 
+static const SrcLoc L{"<test>", 1, 1};
+
+static std::string typeOf(const ExprPtr& e) {
+    auto r = infer(e, TypeEnv{});
+    return showType(apply_type(r.subst, r.type));
+}
+
 TEST(Typechecker, Id) {
-    TypeEnv env;
-    InferState st;
-    auto id = lam("x", var("x"));
-    auto ty = infer(env, st, *id);
+    auto r = infer(lam("x", var("x", L), L), TypeEnv{});
+    auto ty = apply_type(r.subst, r.type);
     EXPECT_EQ(ty->k, TKind::FUN);
     EXPECT_EQ(ty->f.a->k, TKind::VAR);
     EXPECT_EQ(ty->f.b->k, TKind::VAR);
 }
+
+TEST(Typechecker, OperatorsConstrainBothOperands) {
+    EXPECT_EQ(typeOf(lam("n", binop(BinOp::Add, var("n", L), lit_int(1, L), L), L)), "Int -> Int");
+    EXPECT_EQ(typeOf(lam("n", binop(BinOp::Add, lit_int(1, L), var("n", L), L), L)), "Int -> Int");
+    EXPECT_EQ(typeOf(lam("n", binop(BinOp::Lt, var("n", L), lit_int(1, L), L), L)), "Int -> Bool");
+    EXPECT_EQ(typeOf(lam("b", binop(BinOp::And, var("b", L), lit_bool(true, L), L), L)), "Bool -> Bool");
+    // the left operand's constraint reaches the argument
+    auto inc = lam("n", binop(BinOp::Add, var("n", L), lit_int(1, L), L), L);
+    EXPECT_THROW(infer(app(inc, lit_bool(true, L), L), TypeEnv{}), TypeError);
+}